@@ -0,0 +1,413 @@
+#include "BatchRunner.h"
+#include "SimulationRecording.h"
+#include "TaskScheduler.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTextStream>
+#include <QDebug>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <memory>
+
+// --- BatchSimulationRunner Implementation ---
+// Headless driver for throughput measurement and scenario pre-computation.
+// Only simulation time is measured; statistics and snapshot I/O are excluded.
+
+BatchSimulationRunner::BatchSimulationRunner(const BatchOptions& options)
+    : options(options), controller(data) {
+    controller.setThreadCount(options.threads);
+}
+
+int BatchSimulationRunner::run() {
+    if (!options.replayPath.isEmpty()) {
+        return runReplay();
+    }
+    if (options.shards > 0) {
+        return runSharded();
+    }
+    return runScenario();
+}
+
+// --- Run Modes ---
+int BatchSimulationRunner::runScenario() {
+    data.loadVehiclesFromJson(options.scenarioPath);
+    if (data.vehicles().empty()) {
+        qWarning() << "Batch Error: Scenario" << options.scenarioPath << "contains no vehicles.";
+        return 1;
+    }
+    if (options.scale > 1) {
+        scaleFleet();
+    }
+
+    if (options.seeded) {
+        controller.setRandomSeed(options.seed);
+    }
+    controller.setTimestep(options.timestep);
+    controller.setRateDivisors(options.rateDivisors);
+    controller.setMissionTargets(options.missionTargets);
+    controller.setProximityRadius(options.proximityRadius);
+    if (options.geodetic) {
+        controller.setGeodeticOrigin(options.originLatitude, options.originLongitude);
+        controller.setLargeAreaDistances(options.largeArea);
+    }
+
+    // --- Output Streams ---
+    QFile statsFile(options.statsPath);
+    QTextStream statsOut(stdout);
+    if (!options.statsPath.isEmpty()) {
+        if (!statsFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            qWarning() << "Batch Error: Unable to write statistics to" << options.statsPath;
+            return 1;
+        }
+        statsOut.setDevice(&statsFile);
+    }
+
+    QFile snapshotFile(options.snapshotPath);
+    std::unique_ptr<QTextStream> snapshotOut;
+    if (!options.snapshotPath.isEmpty()) {
+        if (!snapshotFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            qWarning() << "Batch Error: Unable to write snapshots to" << options.snapshotPath;
+            return 1;
+        }
+        snapshotOut = std::make_unique<QTextStream>(&snapshotFile);
+        *snapshotOut << "step,trackId,posX,posY,speed,heading,distanceToTarget,fuelLevel,ammunitionLevel\n";
+    }
+
+    if (!options.recordPath.isEmpty()) {
+        controller.startRecording(options.targetX, options.targetY);
+    }
+
+    // --- Stepping ---
+    statsOut << "step,simTime,vehicles,meanSpeed,meanDistance,minDistance,maxDistance,meanFuel,meanAmmunition,supplyAlerts,proximityPairs\n";
+
+    const std::uint64_t interval = options.reportInterval > 0 ? options.reportInterval : options.steps;
+    std::uint64_t done = 0;
+    qint64 simulationNs = 0;
+    QElapsedTimer timer;
+
+    while (done < options.steps) {
+        const std::uint64_t chunk = std::min(interval, options.steps - done);
+
+        timer.start();
+        controller.runSteps(chunk, options.targetX, options.targetY);
+        simulationNs += timer.nsecsElapsed();
+        done += chunk;
+        supplyAlerts += controller.takeSupplyEvents().size();
+
+        writeStatistics(statsOut, done);
+        if (snapshotOut) {
+            writeSnapshot(*snapshotOut, done);
+        }
+    }
+    statsOut.flush();
+
+    reportThroughput(done, simulationNs);
+
+    if (!options.recordPath.isEmpty()) {
+        const SimulationRecording recording = controller.stopRecording();
+        if (!recording.save(options.recordPath)) {
+            return 1;
+        }
+        QTextStream(stdout) << "Recording:        " << options.recordPath
+                            << " (digest " << QString::number(recording.finalDigest, 16) << ")\n";
+    }
+    return 0;
+}
+
+/**
+ * @brief Replays a recording headless and verifies bit-exactness.
+ * @return 0 when the final digest matches the recorded one, 2 on mismatch.
+ */
+int BatchSimulationRunner::runReplay() {
+    SimulationRecording recording;
+    if (!recording.load(options.replayPath)) {
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const std::uint64_t digest = controller.replay(recording);
+    const qint64 elapsedNs = timer.nsecsElapsed();
+
+    reportThroughput(recording.stepCount, elapsedNs);
+
+    QTextStream out(stdout);
+    out << "Replay digest:    " << QString::number(digest, 16);
+    if (digest != recording.finalDigest) {
+        out << " (MISMATCH, recorded " << QString::number(recording.finalDigest, 16) << ")\n";
+        return 2;
+    }
+    out << " (bit-exact)\n";
+    return 0;
+}
+
+/**
+ * @brief Runs the scenario across worker processes, merging their state into
+ *        the local dataset after every reporting interval.
+ */
+int BatchSimulationRunner::runSharded() {
+    data.loadVehiclesFromJson(options.scenarioPath);
+    if (data.vehicles().empty()) {
+        qWarning() << "Batch Error: Scenario" << options.scenarioPath << "contains no vehicles.";
+        return 1;
+    }
+    if (options.scale > 1) {
+        scaleFleet();
+    }
+    if (!options.recordPath.isEmpty()) {
+        qWarning() << "Batch Error: Recording is not supported in sharded runs.";
+        return 1;
+    }
+
+    ShardSettings settings;
+    settings.seeded = options.seeded;
+    settings.seed = options.seed;
+    settings.timestep = options.timestep;
+    // The workers share the machine, so they split the thread budget
+    settings.threads = std::max(1, options.threads / options.shards);
+    settings.rateDivisors = options.rateDivisors;
+    settings.missionTargets = options.missionTargets;
+    settings.proximityRadius = options.proximityRadius;
+    settings.geodetic = options.geodetic;
+    settings.originLatitude = options.originLatitude;
+    settings.originLongitude = options.originLongitude;
+    settings.largeArea = options.largeArea;
+
+    ShardCoordinator coordinator(data);
+    coordinator.setMigrationInterval(options.migrationInterval);
+    if (!coordinator.start(options.shards, options.shardPartition, settings)) {
+        return 1;
+    }
+
+    // --- Output Streams ---
+    QFile statsFile(options.statsPath);
+    QTextStream statsOut(stdout);
+    if (!options.statsPath.isEmpty()) {
+        if (!statsFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            qWarning() << "Batch Error: Unable to write statistics to" << options.statsPath;
+            return 1;
+        }
+        statsOut.setDevice(&statsFile);
+    }
+
+    QFile snapshotFile(options.snapshotPath);
+    std::unique_ptr<QTextStream> snapshotOut;
+    if (!options.snapshotPath.isEmpty()) {
+        if (!snapshotFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            qWarning() << "Batch Error: Unable to write snapshots to" << options.snapshotPath;
+            return 1;
+        }
+        snapshotOut = std::make_unique<QTextStream>(&snapshotFile);
+        *snapshotOut << "step,trackId,posX,posY,speed,heading,distanceToTarget,fuelLevel,ammunitionLevel\n";
+    }
+
+    // --- Stepping ---
+    statsOut << "step,simTime,vehicles,meanSpeed,meanDistance,minDistance,maxDistance,meanFuel,meanAmmunition,migrations\n";
+
+    const std::uint64_t interval = options.reportInterval > 0 ? options.reportInterval : options.steps;
+    std::uint64_t done = 0;
+    qint64 simulationNs = 0;
+    QElapsedTimer timer;
+
+    while (done < options.steps) {
+        const std::uint64_t chunk = std::min(interval, options.steps - done);
+
+        timer.start();
+        if (!coordinator.runSteps(chunk, options.targetX, options.targetY)) {
+            return 1;
+        }
+        simulationNs += timer.nsecsElapsed();
+        done += chunk;
+
+        writeShardStatistics(statsOut, done, coordinator);
+        if (snapshotOut) {
+            writeSnapshot(*snapshotOut, done);
+        }
+    }
+    statsOut.flush();
+
+    reportThroughput(done, simulationNs);
+
+    QTextStream out(stdout);
+    out << "Shards:           " << coordinator.shardCount()
+        << (options.shardPartition == ShardPartition::Spatial ? " (spatial)" : " (track hash)") << '\n';
+    for (int s = 0; s < coordinator.shardCount(); ++s) {
+        out << QString("Shard %1:").arg(s).leftJustified(18) << coordinator.shardSize(s) << '\n';
+    }
+    out << "Migrations:       " << coordinator.migrations() << '\n';
+
+    coordinator.stop();
+    return 0;
+}
+
+// --- Helpers ---
+/**
+ * @brief Replicates the loaded fleet on a square grid of offset copies.
+ *
+ * Copies keep their kinematics and get unique track IDs, so the scaled
+ * scenario exercises the same code paths at a larger size.
+ */
+void BatchSimulationRunner::scaleFleet() {
+    constexpr double COPY_SPACING = 100000.0; // meters between replica origins
+
+    const auto& source = data.vehicles();
+    const auto& sourceRoutes = data.routeWaypoints();
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(options.scale))));
+
+    std::deque<TacticalVehicle> scaled;
+    std::vector<RouteWaypoint> routes;
+    routes.reserve(sourceRoutes.size() * options.scale);
+    for (int copy = 0; copy < options.scale; ++copy) {
+        const double offsetX = (copy % side) * COPY_SPACING;
+        const double offsetY = (copy / side) * COPY_SPACING;
+
+        // Each replica gets its own shifted copy of the waypoint arena
+        const auto routeBase = static_cast<std::uint32_t>(routes.size());
+        for (RouteWaypoint waypoint : sourceRoutes) {
+            waypoint.x += offsetX;
+            waypoint.y += offsetY;
+            routes.push_back(waypoint);
+        }
+
+        for (const auto& original : source) {
+            TacticalVehicle v = original;
+            if (copy > 0) {
+                v.trackId += "-" + QString::number(copy);
+                v.callsign += " #" + QString::number(copy);
+            }
+            v.posX += offsetX;
+            v.posY += offsetY;
+            v.routeOffset += routeBase;
+            scaled.push_back(v);
+        }
+    }
+    data.replaceVehicles(std::move(scaled), std::move(routes));
+}
+
+void BatchSimulationRunner::writeStatistics(QTextStream& out, std::uint64_t step) {
+    const KinematicsBuffers& k = controller.kinematicState();
+    const std::size_t count = k.size();
+
+    double speedSum = 0.0;
+    double distanceSum = 0.0;
+    double fuelSum = 0.0;
+    double ammunitionSum = 0.0;
+    double minDistance = std::numeric_limits<double>::infinity();
+    double maxDistance = 0.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        speedSum += k.speed[i];
+        distanceSum += k.distanceToTarget[i];
+        minDistance = std::min(minDistance, k.distanceToTarget[i]);
+        maxDistance = std::max(maxDistance, k.distanceToTarget[i]);
+        fuelSum += k.fuelLevel[i];
+        ammunitionSum += k.ammunitionLevel[i];
+    }
+    const double n = count > 0 ? static_cast<double>(count) : 1.0;
+
+    out << step << ','
+        << QString::number(step * options.timestep, 'f', 1) << ','
+        << count << ','
+        << QString::number(speedSum / n, 'f', 2) << ','
+        << QString::number(distanceSum / n, 'f', 1) << ','
+        << QString::number(minDistance, 'f', 1) << ','
+        << QString::number(maxDistance, 'f', 1) << ','
+        << QString::number(fuelSum / n, 'f', 2) << ','
+        << QString::number(ammunitionSum / n, 'f', 2) << ','
+        << supplyAlerts << ','
+        << controller.proximityPairs().size() << '\n';
+}
+
+/**
+ * @brief Statistics row computed from the merged dataset (sharded runs have
+ *        no local kinematic buffers).
+ */
+void BatchSimulationRunner::writeShardStatistics(QTextStream& out, std::uint64_t step,
+                                                 const ShardCoordinator& coordinator) {
+    const auto& vehicles = data.vehicles();
+
+    double speedSum = 0.0;
+    double distanceSum = 0.0;
+    double fuelSum = 0.0;
+    double ammunitionSum = 0.0;
+    double minDistance = std::numeric_limits<double>::infinity();
+    double maxDistance = 0.0;
+    for (const auto& v : vehicles) {
+        speedSum += v.speed;
+        distanceSum += v.distanceToTarget;
+        minDistance = std::min(minDistance, v.distanceToTarget);
+        maxDistance = std::max(maxDistance, v.distanceToTarget);
+        fuelSum += v.fuelLevel;
+        ammunitionSum += v.ammunitionLevel;
+    }
+    const double n = vehicles.empty() ? 1.0 : static_cast<double>(vehicles.size());
+
+    out << step << ','
+        << QString::number(step * options.timestep, 'f', 1) << ','
+        << vehicles.size() << ','
+        << QString::number(speedSum / n, 'f', 2) << ','
+        << QString::number(distanceSum / n, 'f', 1) << ','
+        << QString::number(minDistance, 'f', 1) << ','
+        << QString::number(maxDistance, 'f', 1) << ','
+        << QString::number(fuelSum / n, 'f', 2) << ','
+        << QString::number(ammunitionSum / n, 'f', 2) << ','
+        << coordinator.migrations() << '\n';
+}
+
+void BatchSimulationRunner::writeSnapshot(QTextStream& out, std::uint64_t step) {
+    for (const auto& v : data.vehicles()) {
+        out << step << ',' << v.trackId << ','
+            << QString::number(v.posX, 'f', 2) << ','
+            << QString::number(v.posY, 'f', 2) << ','
+            << QString::number(v.speed, 'f', 1) << ','
+            << QString::number(v.heading, 'f', 1) << ','
+            << QString::number(v.distanceToTarget, 'f', 1) << ','
+            << QString::number(v.fuelLevel, 'f', 2) << ','
+            << QString::number(v.ammunitionLevel, 'f', 2) << '\n';
+    }
+}
+
+void BatchSimulationRunner::reportThroughput(std::uint64_t steps, qint64 elapsedNs) {
+    const double seconds = std::max<qint64>(elapsedNs, 1) / 1e9;
+    const double vehicles = static_cast<double>(data.vehicles().size());
+    const double stepsPerSecond = steps / seconds;
+
+    QTextStream out(stdout);
+    out << "Vehicles:         " << data.vehicles().size() << '\n'
+        << "Threads:          " << controller.threadCount() << '\n'
+        << "Steps:            " << steps << '\n'
+        << "Wall time:        " << QString::number(seconds, 'f', 3) << " s\n"
+        << "Steps/s:          " << QString::number(stepsPerSecond, 'f', 1) << '\n'
+        << "Vehicle-steps/s:  " << QString::number(stepsPerSecond * vehicles, 'e', 3) << '\n'
+        << "Real-time factor: " << QString::number(stepsPerSecond * controller.timestep(), 'f', 1) << "x\n";
+
+    reportTaskTimings();
+}
+
+/**
+ * @brief Prints where the shared task scheduler spent its time: per task
+ *        label, then per worker (the last row is the calling thread).
+ */
+void BatchSimulationRunner::reportTaskTimings() {
+    const TaskScheduler& scheduler = TaskScheduler::shared();
+
+    QTextStream out(stdout);
+    out << "Tasks:            label                      count   total ms    max ms\n";
+    for (const TaskTiming& timing : scheduler.timings()) {
+        out << "                  "
+            << QString("%1 %2 %3 %4\n")
+                   .arg(QString::fromLatin1(timing.label), -24)
+                   .arg(static_cast<qulonglong>(timing.tasks), 7)
+                   .arg(timing.totalMs, 10, 'f', 1)
+                   .arg(timing.maxMs, 9, 'f', 2);
+    }
+
+    const std::vector<double> busy = scheduler.workerBusyMs();
+    for (std::size_t w = 0; w < busy.size(); ++w) {
+        const QString name = w + 1 < busy.size() ? QString("Worker %1 busy:").arg(static_cast<qulonglong>(w)) : QString("Caller busy:");
+        out << QString("%1").arg(name, -18) << QString::number(busy[w], 'f', 1) << " ms\n";
+    }
+}
@@ -0,0 +1,99 @@
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include "ShardCoordinator.h"
+#include "TacticalVehicleController.h"
+#include "TacticalVehicleData.h"
+
+#include <QString>
+
+#include <cstdint>
+#include <vector>
+
+class QTextStream;
+
+/**
+ * @struct BatchOptions
+ * @brief Parameters of a headless simulation run, resolved from the command line.
+ */
+struct BatchOptions {
+    // --- Scenario ---
+    QString scenarioPath = ":/data/vehicles.json";
+    int scale = 1;                   ///< Fleet replication factor (load testing)
+
+    // --- Stepping ---
+    std::uint64_t steps = 3600;
+    double timestep = 1.0;           ///< Simulated seconds per step
+    int threads = 1;
+    bool seeded = false;
+    std::uint64_t seed = 0;
+    RateScheduler::Divisors rateDivisors{{1, 1, 1, 1}}; ///< Steps between updates: Flash, High, Routine, Low
+
+    // --- Mission Target ---
+    double targetX = 0.0;
+    double targetY = 0.0;
+    std::vector<MissionTarget> missionTargets; ///< Additional objectives (distance matrix)
+
+    // --- Geodetic Mode ---
+    bool geodetic = false;
+    double originLatitude = 0.0;
+    double originLongitude = 0.0;
+    bool largeArea = false;          ///< Haversine distances to the primary target
+
+    // --- Proximity ---
+    double proximityRadius = 1000.0; ///< Meters (0 = disabled)
+
+    // --- Sharding ---
+    int shards = 0;                  ///< Worker processes (0 = simulate in-process)
+    ShardPartition shardPartition = ShardPartition::TrackHash;
+    std::uint64_t migrationInterval = 1; ///< Steps between spatial migrations
+
+    // --- Output ---
+    std::uint64_t reportInterval = 0; ///< Steps between statistics rows / snapshots (0 = end only)
+    QString statsPath;                ///< CSV statistics ("" = stdout)
+    QString snapshotPath;             ///< CSV full-state snapshots ("" = disabled)
+
+    // --- Deterministic Replay ---
+    QString recordPath;              ///< Save a SimulationRecording of this run
+    QString replayPath;              ///< Replay and verify a recording instead of a scenario
+};
+
+/**
+ * @class BatchSimulationRunner
+ * @brief Drives TacticalVehicleController headless, as fast as the hardware allows.
+ *
+ * Loads a scenario, advances it for a fixed number of steps, periodically
+ * writes statistics and state snapshots, and reports simulation throughput.
+ */
+class BatchSimulationRunner {
+public:
+    explicit BatchSimulationRunner(const BatchOptions& options);
+
+    /**
+     * @brief Executes the configured run.
+     * @return Process exit code (0 on success).
+     */
+    int run();
+
+private:
+    // --- Run Modes ---
+    int runScenario();
+    int runReplay();
+    int runSharded();
+
+    // --- Helpers ---
+    void scaleFleet();
+    void writeStatistics(QTextStream& out, std::uint64_t step);
+    void writeShardStatistics(QTextStream& out, std::uint64_t step, const ShardCoordinator& coordinator);
+    void writeSnapshot(QTextStream& out, std::uint64_t step);
+    void reportThroughput(std::uint64_t steps, qint64 elapsedNs);
+    void reportTaskTimings();
+
+    // --- State ---
+    BatchOptions options;
+    TacticalVehicleData data;
+    TacticalVehicleController controller;
+    std::uint64_t supplyAlerts = 0; ///< Supply alerts raised so far (cumulative)
+};
+
+#endif // BATCHRUNNER_H
@@ -0,0 +1,281 @@
+#include "ClusterIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+// --- ClusterIndex Implementation ---
+// Incrementally maintained grid pyramid. Level k sums the centres of the
+// level k-1 cells, so a cell crossing only touches the levels whose cell
+// or child cell changed.
+
+namespace {
+constexpr std::uint32_t NO_CELL = 0xFFFFFFFFu;
+
+// Cell coordinates are packed into 32 bits each; tracks further out are left out
+constexpr std::int64_t MAX_CELL = 0x7FFFFFFF;
+
+// Highest level at which two level-0 cells still differ (-1 if equal)
+int highestDifferingLevel(std::int64_t ax, std::int64_t ay, std::int64_t bx, std::int64_t by) {
+    std::uint64_t diff = static_cast<std::uint64_t>(ax ^ bx) | static_cast<std::uint64_t>(ay ^ by);
+    int level = -1;
+    while (diff != 0) {
+        diff >>= 1;
+        ++level;
+    }
+    return level;
+}
+}
+
+// --- Configuration ---
+void ClusterIndex::configure(const std::uint8_t* affiliation, const std::uint8_t* domain, std::size_t count,
+                             double baseCellSize) {
+    m_baseCellSize = baseCellSize > 0.0 ? baseCellSize : 250.0;
+    m_affiliation.assign(affiliation, affiliation + count);
+    m_domain.assign(domain, domain + count);
+    m_slotCell.assign(count, NO_CELL);
+    m_cellX.assign(count, 0);
+    m_cellY.assign(count, 0);
+    m_posX.assign(count, 0.0);
+    m_posY.assign(count, 0.0);
+
+    for (Level& level : m_levels) {
+        level.cells.clear();
+        level.lookup.clear();
+        level.freeCells.clear();
+    }
+    ++m_revision;
+}
+
+// --- Incremental Update ---
+void ClusterIndex::update(const double* posX, const double* posY, std::size_t count) {
+    if (count != m_slotCell.size()) {
+        return;
+    }
+
+    const double inverse = 1.0 / m_baseCellSize;
+    bool changed = false;
+
+    for (std::size_t slot = 0; slot < count; ++slot) {
+        const double x = posX[slot];
+        const double y = posY[slot];
+        const bool indexed = m_slotCell[slot] != NO_CELL;
+
+        std::int64_t cellX = 0;
+        std::int64_t cellY = 0;
+        bool valid = std::isfinite(x) && std::isfinite(y);
+        if (valid) {
+            const double fx = std::floor(x * inverse);
+            const double fy = std::floor(y * inverse);
+            valid = std::fabs(fx) <= double(MAX_CELL) && std::fabs(fy) <= double(MAX_CELL);
+            cellX = static_cast<std::int64_t>(fx);
+            cellY = static_cast<std::int64_t>(fy);
+        }
+
+        if (!valid) {
+            if (indexed) {
+                removeTrack(slot, LEVEL_COUNT - 1);
+                m_slotCell[slot] = NO_CELL;
+                changed = true;
+            }
+            continue;
+        }
+
+        if (!indexed) {
+            insertTrack(slot, cellX, cellY, x, y, LEVEL_COUNT - 1);
+            changed = true;
+            continue;
+        }
+
+        if (cellX == m_cellX[slot] && cellY == m_cellY[slot]) {
+            // Same level-0 cell: only its position sum moves
+            if (x != m_posX[slot] || y != m_posY[slot]) {
+                Cell& cell = m_levels[0].cells[m_slotCell[slot]];
+                cell.sumX += x - m_posX[slot];
+                cell.sumY += y - m_posY[slot];
+                m_posX[slot] = x;
+                m_posY[slot] = y;
+                changed = true;
+            }
+            continue;
+        }
+
+        // Levels up to the highest changed cell, plus the one above whose
+        // sum holds that cell's centre
+        const int top = std::min(highestDifferingLevel(cellX, cellY, m_cellX[slot], m_cellY[slot]) + 1,
+                                 LEVEL_COUNT - 1);
+        removeTrack(slot, top);
+        insertTrack(slot, cellX, cellY, x, y, top);
+        changed = true;
+    }
+
+    if (changed) {
+        ++m_revision;
+    }
+}
+
+std::uint64_t ClusterIndex::keyOf(std::int64_t cellX, std::int64_t cellY) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX)) << 32) |
+           static_cast<std::uint32_t>(cellY);
+}
+
+std::uint32_t ClusterIndex::acquireCell(int level, std::int64_t cellX, std::int64_t cellY) {
+    Level& storage = m_levels[level];
+    const std::uint64_t key = keyOf(cellX, cellY);
+    auto it = storage.lookup.find(key);
+    if (it != storage.lookup.end()) {
+        return it->second;
+    }
+
+    std::uint32_t index;
+    if (!storage.freeCells.empty()) {
+        index = storage.freeCells.back();
+        storage.freeCells.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(storage.cells.size());
+        storage.cells.emplace_back();
+    }
+    Cell& cell = storage.cells[index];
+    cell = Cell();
+    cell.cellX = cellX;
+    cell.cellY = cellY;
+    storage.lookup.emplace(key, index);
+    return index;
+}
+
+void ClusterIndex::add(int level, std::uint32_t index, std::size_t slot, double x, double y) {
+    Cell& cell = m_levels[level].cells[index];
+    ++cell.count;
+    cell.slotSum += slot;
+    cell.sumX += x;
+    cell.sumY += y;
+    ++cell.affiliations[m_affiliation[slot]];
+    ++cell.domains[m_domain[slot]];
+}
+
+void ClusterIndex::remove(int level, std::uint32_t index, std::size_t slot, double x, double y) {
+    Level& storage = m_levels[level];
+    Cell& cell = storage.cells[index];
+    if (--cell.count == 0) {
+        // Dropping the cell also discards accumulated rounding in its sums
+        storage.lookup.erase(keyOf(cell.cellX, cell.cellY));
+        storage.freeCells.push_back(index);
+        cell = Cell();
+        return;
+    }
+    cell.slotSum -= slot;
+    cell.sumX -= x;
+    cell.sumY -= y;
+    --cell.affiliations[m_affiliation[slot]];
+    --cell.domains[m_domain[slot]];
+}
+
+/**
+ * @brief Adds a track to levels 0..topLevel and records its level-0 cell.
+ */
+void ClusterIndex::insertTrack(std::size_t slot, std::int64_t cellX, std::int64_t cellY, double x, double y,
+                               int topLevel) {
+    for (int level = 0; level <= topLevel; ++level) {
+        const std::uint32_t index = acquireCell(level, cellX >> level, cellY >> level);
+        if (level == 0) {
+            add(level, index, slot, x, y);
+            m_slotCell[slot] = index;
+        } else {
+            add(level, index, slot, cellCentre(level - 1, cellX >> (level - 1)),
+                cellCentre(level - 1, cellY >> (level - 1)));
+        }
+    }
+    m_cellX[slot] = cellX;
+    m_cellY[slot] = cellY;
+    m_posX[slot] = x;
+    m_posY[slot] = y;
+}
+
+/**
+ * @brief Removes a track from levels 0..topLevel, using its recorded cell.
+ */
+void ClusterIndex::removeTrack(std::size_t slot, int topLevel) {
+    const std::int64_t cellX = m_cellX[slot];
+    const std::int64_t cellY = m_cellY[slot];
+    for (int level = 0; level <= topLevel; ++level) {
+        if (level == 0) {
+            remove(level, m_slotCell[slot], slot, m_posX[slot], m_posY[slot]);
+            continue;
+        }
+        const Level& storage = m_levels[level];
+        auto it = storage.lookup.find(keyOf(cellX >> level, cellY >> level));
+        if (it != storage.lookup.end()) {
+            remove(level, it->second, slot, cellCentre(level - 1, cellX >> (level - 1)),
+                   cellCentre(level - 1, cellY >> (level - 1)));
+        }
+    }
+}
+
+// --- Queries ---
+int ClusterIndex::levelFor(double pixelsPerMeter, double minPixels) const {
+    // Level-0 cells more than twice the cluster size apart: tracks are
+    // spread far enough on screen to be drawn individually
+    if (m_baseCellSize * pixelsPerMeter > 2.0 * minPixels) {
+        return -1;
+    }
+    for (int level = 0; level < LEVEL_COUNT; ++level) {
+        if (cellSize(level) * pixelsPerMeter >= minPixels) {
+            return level;
+        }
+    }
+    return LEVEL_COUNT - 1;
+}
+
+std::size_t ClusterIndex::clusterCount(int level) const {
+    return level >= 0 && level < LEVEL_COUNT ? m_levels[level].lookup.size() : 0;
+}
+
+void ClusterIndex::query(int level, double minX, double minY, double maxX, double maxY,
+                         std::vector<ClusterSummary>& clusters) const {
+    if (level < 0 || level >= LEVEL_COUNT || !(minX <= maxX) || !(minY <= maxY)) {
+        return;
+    }
+    const Level& storage = m_levels[level];
+    const double inverse = 1.0 / cellSize(level);
+    const double levelLimit = double(MAX_CELL >> level);
+
+    const std::int64_t firstX = static_cast<std::int64_t>(std::max(std::floor(minX * inverse), -levelLimit - 1.0));
+    const std::int64_t lastX = static_cast<std::int64_t>(std::min(std::floor(maxX * inverse), levelLimit));
+    const std::int64_t firstY = static_cast<std::int64_t>(std::max(std::floor(minY * inverse), -levelLimit - 1.0));
+    const std::int64_t lastY = static_cast<std::int64_t>(std::min(std::floor(maxY * inverse), levelLimit));
+    if (firstX > lastX || firstY > lastY) {
+        return;
+    }
+
+    // Probe the rectangle's cells when it is smaller than the occupied set,
+    // otherwise scan the occupied cells (e.g. zoomed far out)
+    const double rectangleCells = double(lastX - firstX + 1) * double(lastY - firstY + 1);
+    if (rectangleCells <= double(storage.lookup.size())) {
+        for (std::int64_t cy = firstY; cy <= lastY; ++cy) {
+            for (std::int64_t cx = firstX; cx <= lastX; ++cx) {
+                auto it = storage.lookup.find(keyOf(cx, cy));
+                if (it != storage.lookup.end()) {
+                    summarize(storage.cells[it->second], clusters);
+                }
+            }
+        }
+        return;
+    }
+
+    for (const Cell& cell : storage.cells) {
+        if (cell.count != 0 && cell.cellX >= firstX && cell.cellX <= lastX &&
+            cell.cellY >= firstY && cell.cellY <= lastY) {
+            summarize(cell, clusters);
+        }
+    }
+}
+
+void ClusterIndex::summarize(const Cell& cell, std::vector<ClusterSummary>& clusters) const {
+    ClusterSummary summary;
+    summary.x = cell.sumX / cell.count;
+    summary.y = cell.sumY / cell.count;
+    summary.count = cell.count;
+    summary.slot = cell.count == 1 ? static_cast<std::uint32_t>(cell.slotSum) : 0;
+    summary.affiliations = cell.affiliations;
+    summary.domains = cell.domains;
+    clusters.push_back(summary);
+}
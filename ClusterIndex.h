@@ -0,0 +1,150 @@
+#ifndef CLUSTERINDEX_H
+#define CLUSTERINDEX_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @enum ClusterAffiliation
+ * @brief Affiliation class counted per cluster.
+ */
+enum ClusterAffiliation : std::uint8_t {
+    ClusterFriendly,
+    ClusterHostile,
+    ClusterNeutral,
+    ClusterUnknown,
+    CLUSTER_AFFILIATION_COUNT
+};
+
+/**
+ * @enum ClusterDomain
+ * @brief Operational domain counted per cluster (Electronic and unknown
+ *        domains count as Other).
+ */
+enum ClusterDomain : std::uint8_t {
+    ClusterLand,
+    ClusterSea,
+    ClusterAir,
+    ClusterSubsurface,
+    ClusterSpace,
+    ClusterOther,
+    CLUSTER_DOMAIN_COUNT
+};
+
+/**
+ * @struct ClusterSummary
+ * @brief One occupied cell of the pyramid, as returned by a query.
+ */
+struct ClusterSummary {
+    double x = 0.0;                 ///< Centroid (meters), of child cell centres above level 0
+    double y = 0.0;
+    std::uint32_t count = 0;        ///< Tracks in the cell
+    std::uint32_t slot = 0;         ///< Simulation slot of the track when count == 1
+    std::array<std::uint32_t, CLUSTER_AFFILIATION_COUNT> affiliations{};
+    std::array<std::uint32_t, CLUSTER_DOMAIN_COUNT> domains{};
+};
+
+/**
+ * @class ClusterIndex
+ * @brief Grid pyramid over track positions for zoom-dependent clustering.
+ *
+ * Level 0 has square cells of the base size and every level above doubles
+ * the cell edge, so the cell of a track at level k is its level-0 cell
+ * shifted right by k. Each level keeps only its occupied cells, with the
+ * track count, affiliation and domain counts and a position sum.
+ *
+ * update() is incremental. A track that stays in its level-0 cell only
+ * moves that cell's position sum. A track that changes cell is moved only
+ * on the levels whose cell or child cell changed, since level k sums the
+ * centres of level k-1 cells rather than raw positions. A tick therefore
+ * costs about one array update per track plus a few hash updates per
+ * cell crossing, independent of the number of levels.
+ *
+ * Qt-free so it can be maintained next to the kinematics kernels.
+ */
+class ClusterIndex {
+public:
+    static constexpr int LEVEL_COUNT = 18; ///< 250 m base cells reach ~32,000 km
+
+    /**
+     * @brief Assigns the per-slot classes and clears the pyramid; the next
+     *        update() inserts every track.
+     * @param baseCellSize Edge of a level-0 cell (meters), > 0.
+     */
+    void configure(const std::uint8_t* affiliation, const std::uint8_t* domain, std::size_t count,
+                   double baseCellSize);
+
+    /// Moves the tracks to their new positions; non-finite positions are left out.
+    void update(const double* posX, const double* posY, std::size_t count);
+
+    // --- Queries ---
+    /**
+     * @brief Lowest level whose cells are at least minPixels wide at the
+     *        given scale, or -1 when level-0 cells are more than twice that
+     *        (tracks are then far enough apart to draw individually).
+     */
+    int levelFor(double pixelsPerMeter, double minPixels) const;
+
+    double cellSize(int level) const { return m_baseCellSize * double(std::uint64_t(1) << level); }
+
+    /**
+     * @brief Appends the clusters of one level whose cell intersects the
+     *        rectangle (meters). Runs in time proportional to the smaller
+     *        of the rectangle's cell count and the level's occupied cells.
+     */
+    void query(int level, double minX, double minY, double maxX, double maxY,
+               std::vector<ClusterSummary>& clusters) const;
+
+    std::size_t clusterCount(int level) const;
+    std::size_t size() const { return m_slotCell.size(); }
+
+    /// Incremented by every update() that changed a cluster.
+    std::uint64_t revision() const { return m_revision; }
+
+private:
+    struct Cell {
+        std::int64_t cellX = 0;
+        std::int64_t cellY = 0;
+        std::uint32_t count = 0;
+        std::uint64_t slotSum = 0;  ///< Sum of member slots; the member itself when count == 1
+        double sumX = 0.0;          ///< Raw positions at level 0, child cell centres above
+        double sumY = 0.0;
+        std::array<std::uint32_t, CLUSTER_AFFILIATION_COUNT> affiliations{};
+        std::array<std::uint32_t, CLUSTER_DOMAIN_COUNT> domains{};
+    };
+
+    struct Level {
+        std::vector<Cell> cells;
+        std::unordered_map<std::uint64_t, std::uint32_t> lookup; ///< Packed cell coordinates -> cells index
+        std::vector<std::uint32_t> freeCells;                    ///< Emptied cells available for reuse
+    };
+
+    static std::uint64_t keyOf(std::int64_t cellX, std::int64_t cellY);
+    double cellCentre(int level, std::int64_t cell) const { return (double(cell) + 0.5) * cellSize(level); }
+
+    std::uint32_t acquireCell(int level, std::int64_t cellX, std::int64_t cellY);
+    void add(int level, std::uint32_t cell, std::size_t slot, double x, double y);
+    void remove(int level, std::uint32_t cell, std::size_t slot, double x, double y);
+    void insertTrack(std::size_t slot, std::int64_t cellX, std::int64_t cellY, double x, double y, int topLevel);
+    void removeTrack(std::size_t slot, int topLevel);
+    void summarize(const Cell& cell, std::vector<ClusterSummary>& clusters) const;
+
+    double m_baseCellSize = 250.0;
+    std::array<Level, LEVEL_COUNT> m_levels;
+
+    // --- Per-slot State ---
+    std::vector<std::uint8_t> m_affiliation;
+    std::vector<std::uint8_t> m_domain;
+    std::vector<std::uint32_t> m_slotCell;  ///< Level-0 cell index (NO_CELL when not indexed)
+    std::vector<std::int64_t> m_cellX;      ///< Level-0 cell coordinates
+    std::vector<std::int64_t> m_cellY;
+    std::vector<double> m_posX;             ///< Positions as of the last update
+    std::vector<double> m_posY;
+
+    std::uint64_t m_revision = 0;
+};
+
+#endif // CLUSTERINDEX_H
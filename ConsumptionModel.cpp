@@ -0,0 +1,86 @@
+#include "ConsumptionModel.h"
+
+// --- ConsumptionModel Implementation ---
+// Coefficients are calibrated to typical endurance figures at cruise speed
+// (e.g. ~8 h for a main battle tank at 40 km/h, ~2 h for a fighter at
+// 900 km/h, ~24 h for a tactical UAV) rather than to specific platforms.
+
+namespace {
+
+enum FuelClass : std::uint8_t {
+    FuelDefault = 0,
+    FuelWheeled,
+    FuelTrackedHeavy,
+    FuelTrackedMedium,
+    FuelFixedWing,
+    FuelUnmannedAir,
+    FuelMaritime,
+    FuelClassCount
+};
+
+// { idle, linear, quadratic } in %/h, %/h per km/h, %/h per (km/h)^2
+constexpr double FUEL_TABLE[FuelClassCount][3] = {
+    {0.50, 0.0500, 0.000800},  // Default
+    {0.50, 0.0500, 0.000800},  // Wheeled
+    {2.00, 0.1000, 0.004000},  // Tracked, heavy (MBT)
+    {1.50, 0.0800, 0.002500},  // Tracked, medium (IFV, APC, SP systems)
+    {10.0, 0.0200, 0.000025},  // Fixed-wing aircraft
+    {1.00, 0.0100, 0.000050},  // Unmanned aerial
+    {0.30, 0.0100, 0.000300},  // Maritime
+};
+
+FuelClass fuelClassFor(const QString& propulsion, const QString& classification) {
+    if (propulsion == "Tracked") {
+        return classification == "Main Battle Tank" ? FuelTrackedHeavy : FuelTrackedMedium;
+    }
+    if (propulsion == "Wheeled" || propulsion == "Legged") {
+        return FuelWheeled;
+    }
+    if (propulsion == "Aerial") {
+        return classification.contains("UAV", Qt::CaseInsensitive) ? FuelUnmannedAir : FuelFixedWing;
+    }
+    if (propulsion == "Maritime") {
+        return FuelMaritime;
+    }
+    return FuelDefault;
+}
+
+// Ammunition expenditure while in motion (%/h), keyed by classification keyword
+struct AmmunitionRate {
+    const char* keyword;
+    double rate;
+};
+
+constexpr AmmunitionRate AMMUNITION_TABLE[] = {
+    {"Artillery",        6.0},
+    {"Mortar",           6.0},
+    {"Air Defense",      4.0},
+    {"Fighter",          5.0},
+    {"Multirole",        5.0},
+    {"IFV",              3.0},
+    {"Missile Boat",     3.0},
+    {"Main Battle Tank", 2.0},
+    {"APC",              1.5},
+    {"Light Vehicle",    1.0},
+    {"Tactical",         1.0},
+};
+
+} // namespace
+
+ConsumptionProfile ConsumptionModel::profileFor(const QString& propulsion, const QString& classification) {
+    const FuelClass fuel = fuelClassFor(propulsion, classification);
+
+    ConsumptionProfile profile;
+    profile.fuelIdle = FUEL_TABLE[fuel][0];
+    profile.fuelLinear = FUEL_TABLE[fuel][1];
+    profile.fuelQuadratic = FUEL_TABLE[fuel][2];
+
+    // Logistics, medical and civilian traffic default to zero expenditure
+    for (const auto& entry : AMMUNITION_TABLE) {
+        if (classification.contains(QLatin1String(entry.keyword), Qt::CaseInsensitive)) {
+            profile.ammunition = entry.rate;
+            break;
+        }
+    }
+    return profile;
+}
@@ -0,0 +1,37 @@
+#ifndef CONSUMPTIONMODEL_H
+#define CONSUMPTIONMODEL_H
+
+#include <QString>
+
+#include <cstdint>
+
+/**
+ * @struct ConsumptionProfile
+ * @brief Burn-rate coefficients for one vehicle type (percent per hour).
+ *
+ * Fuel burn while moving: idle + linear * v + quadratic * v^2 (v in km/h).
+ * Ammunition expenditure is a flat rate while the vehicle is in motion.
+ * Vehicles at rest consume nothing.
+ */
+struct ConsumptionProfile {
+    double fuelIdle = 0.0;
+    double fuelLinear = 0.0;
+    double fuelQuadratic = 0.0;
+    double ammunition = 0.0;
+};
+
+/**
+ * @class ConsumptionModel
+ * @brief Compact lookup table mapping vehicle type to a ConsumptionProfile.
+ *
+ * Fuel coefficients are keyed by propulsion (with a heavy/light split for
+ * tracked and aerial platforms); ammunition expenditure is keyed by
+ * classification. The lookup is string-based and therefore only performed
+ * when the simulation binds a dataset, never per step.
+ */
+class ConsumptionModel {
+public:
+    static ConsumptionProfile profileFor(const QString& propulsion, const QString& classification);
+};
+
+#endif // CONSUMPTIONMODEL_H
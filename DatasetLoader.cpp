@@ -0,0 +1,99 @@
+#include "DatasetLoader.h"
+
+#include <QMetaObject>
+#include <QSet>
+
+#include <algorithm>
+#include <utility>
+
+// --- DatasetLoader Implementation ---
+
+namespace {
+constexpr std::size_t FIRST_CHUNK_RECORDS = 2048;  ///< Small, so the first vehicles show quickly
+constexpr std::size_t MAX_CHUNK_RECORDS = 65536;   ///< Chunk size doubles up to this
+}
+
+DatasetLoader::DatasetLoader(QObject *parent) : QObject(parent) {}
+
+DatasetLoader::~DatasetLoader() {
+    m_cancel = true;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+// --- Requests (GUI Thread) ---
+void DatasetLoader::load(const QString& path) {
+    if (m_loading) {
+        return;
+    }
+    // A finished load's thread has delivered its last event already
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    m_loading = true;
+    m_cancel = false;
+    m_thread = std::thread([this, path]() { run(path); });
+}
+
+std::vector<DatasetChunk> DatasetLoader::takeChunks() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::exchange(m_chunks, {});
+}
+
+// --- Loader Thread ---
+void DatasetLoader::run(const QString& path) {
+    QMetaObject::invokeMethod(this, [this]() { emit progress(0, 0); }, Qt::QueuedConnection);
+
+    QJsonArray records;
+    if (!TacticalVehicleData::readJsonRecords(path, records)) {
+        QMetaObject::invokeMethod(this, [this]() {
+            m_loading = false;
+            emit finished(false, 0);
+        }, Qt::QueuedConnection);
+        return;
+    }
+
+    const std::size_t total = static_cast<std::size_t>(records.size());
+    QSet<QString> seenCallsigns;
+    QSet<QString> seenTrackIds;
+    std::size_t loaded = 0;
+    std::size_t chunkRecords = FIRST_CHUNK_RECORDS;
+
+    while (loaded < total && !m_cancel) {
+        const std::size_t end = std::min(total, loaded + chunkRecords);
+        DatasetChunk chunk;
+        chunk.batch = TacticalVehicleData::parseRecords(records, loaded, end);
+
+        for (const TacticalVehicle& v : chunk.batch.vehicles) {
+            if (!v.callsign.isEmpty() && !seenCallsigns.contains(v.callsign)) {
+                seenCallsigns.insert(v.callsign);
+                chunk.callsigns << v.callsign;
+            }
+            if (!v.trackId.isEmpty() && !seenTrackIds.contains(v.trackId)) {
+                seenTrackIds.insert(v.trackId);
+                chunk.trackIds << v.trackId;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_chunks.push_back(std::move(chunk));
+        }
+        loaded = end;
+        chunkRecords = std::min(chunkRecords * 2, MAX_CHUNK_RECORDS);
+
+        QMetaObject::invokeMethod(this, [this, loaded, total]() {
+            emit chunkReady();
+            emit progress(static_cast<int>(loaded), static_cast<int>(total));
+        }, Qt::QueuedConnection);
+    }
+
+    if (m_cancel) {
+        return;
+    }
+    QMetaObject::invokeMethod(this, [this, total]() {
+        m_loading = false;
+        emit finished(true, static_cast<int>(total));
+    }, Qt::QueuedConnection);
+}
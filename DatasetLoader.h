@@ -0,0 +1,73 @@
+#ifndef DATASETLOADER_H
+#define DATASETLOADER_H
+
+#include "TacticalVehicleData.h"
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct DatasetChunk
+ * @brief Records parsed by the loader, with the search terms they add.
+ */
+struct DatasetChunk {
+    TacticalVehicleData::VehicleBatch batch;
+    QStringList callsigns;  ///< Callsigns not seen in earlier chunks
+    QStringList trackIds;   ///< Track IDs not seen in earlier chunks
+};
+
+/**
+ * @class DatasetLoader
+ * @brief Reads and parses a vehicle dataset on a background thread.
+ *
+ * The file is read and parsed as a whole, then its records are converted
+ * in chunks of growing size, so the first vehicles arrive quickly and
+ * later chunks amortize the cost of rebinding the simulation. Completer
+ * terms are deduplicated on the loader thread as well.
+ *
+ * Chunks are queued until the GUI thread takes them with takeChunks();
+ * chunkReady() and progress() are delivered on the thread the loader
+ * lives in. Destroying the loader cancels a load between chunks (reading
+ * and parsing the document itself cannot be interrupted).
+ */
+class DatasetLoader : public QObject {
+    Q_OBJECT
+
+public:
+    explicit DatasetLoader(QObject *parent = nullptr);
+    ~DatasetLoader();
+
+    /// Starts loading path; ignored while a load is in progress.
+    void load(const QString& path);
+
+    bool isLoading() const { return m_loading; }
+
+    /// Chunks delivered since the last call, in file order.
+    std::vector<DatasetChunk> takeChunks();
+
+signals:
+    /// Records converted so far; total is 0 while the document is being parsed.
+    void progress(int loaded, int total);
+    void chunkReady();
+    /// Emitted after the last chunkReady(); ok is false if the file could not be read.
+    void finished(bool ok, int total);
+
+private:
+    void run(const QString& path);
+
+    bool m_loading = false;
+
+    // --- Hand-off From The Loader Thread ---
+    std::mutex m_mutex;
+    std::vector<DatasetChunk> m_chunks;
+    std::atomic<bool> m_cancel{false};
+    std::thread m_thread;
+};
+
+#endif // DATASETLOADER_H
@@ -0,0 +1,97 @@
+#include "FilterWorker.h"
+
+#include <QMetaObject>
+#include <QTimer>
+
+#include <utility>
+
+// --- FilterWorker Implementation ---
+
+namespace {
+constexpr int DEBOUNCE_MS = 30; ///< Idle input time before a request is evaluated
+}
+
+FilterWorker::FilterWorker(const TacticalVehicleController& controller, QObject *parent)
+    : QObject(parent), m_controller(controller) {
+    m_debounce = new QTimer(this);
+    m_debounce->setSingleShot(true);
+    m_debounce->setInterval(DEBOUNCE_MS);
+    connect(m_debounce, &QTimer::timeout, this, &FilterWorker::dispatch);
+
+    m_thread = std::thread([this]() { run(); });
+}
+
+FilterWorker::~FilterWorker() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+        m_cancel = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+// --- Requests (GUI Thread) ---
+void FilterWorker::request(const FilterCriteria& criteria) {
+    m_pending = criteria;
+    m_hasPending = true;
+    ++m_latestRequest;
+    m_debounce->start();
+}
+
+void FilterWorker::flush() {
+    m_debounce->stop();
+    dispatch();
+}
+
+/**
+ * @brief Hands the latest criteria to the evaluation thread, cancelling the
+ *        evaluation in flight (its result would be stale anyway).
+ */
+void FilterWorker::dispatch() {
+    if (!m_hasPending) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_next = std::move(m_pending);
+        m_nextRequest = m_latestRequest;
+        m_hasNext = true;
+        m_cancel = true;
+    }
+    m_hasPending = false;
+    m_wake.notify_one();
+}
+
+// --- Evaluation Thread ---
+void FilterWorker::run() {
+    for (;;) {
+        FilterCriteria criteria;
+        std::uint64_t requestId = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this]() { return m_hasNext || m_stopping; });
+            if (m_stopping) {
+                return;
+            }
+            criteria = std::move(m_next);
+            requestId = m_nextRequest;
+            m_hasNext = false;
+            m_cancel = false;
+        }
+
+        std::vector<const TacticalVehicle*> result = m_controller.evaluateFilter(criteria, &m_cancel);
+        if (m_cancel) {
+            continue;
+        }
+
+        // Delivered on the GUI thread; dropped if a newer request exists by then
+        QMetaObject::invokeMethod(this, [this, criteria, requestId, result = std::move(result)]() {
+            if (requestId != m_latestRequest) {
+                return;
+            }
+            m_delivered = requestId;
+            emit filterReady(criteria, result);
+        }, Qt::QueuedConnection);
+    }
+}
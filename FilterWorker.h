@@ -0,0 +1,71 @@
+#ifndef FILTERWORKER_H
+#define FILTERWORKER_H
+
+#include "TacticalVehicleController.h"
+
+#include <QObject>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class QTimer;
+
+/**
+ * @class FilterWorker
+ * @brief Evaluates filter criteria on a background thread.
+ *
+ * Requests are debounced, so a burst of input (typing, dragging a slider)
+ * is coalesced into one evaluation of the latest criteria. A request that
+ * arrives while an evaluation runs cancels it. Results are delivered on
+ * the thread the worker lives in (the GUI thread) through filterReady(),
+ * and only for the most recent request; the receiver installs them with
+ * TacticalVehicleController::installFilter().
+ */
+class FilterWorker : public QObject {
+    Q_OBJECT
+
+public:
+    explicit FilterWorker(const TacticalVehicleController& controller, QObject *parent = nullptr);
+    ~FilterWorker();
+
+    /// Schedules criteria for evaluation once input has been idle for the debounce interval.
+    void request(const FilterCriteria& criteria);
+
+    /// Starts evaluating the pending request now instead of after the debounce interval.
+    void flush();
+
+    /// True while a request is waiting or being evaluated.
+    bool isBusy() const { return m_delivered != m_latestRequest; }
+
+signals:
+    void filterReady(const FilterCriteria& criteria, const std::vector<const TacticalVehicle*>& result);
+
+private:
+    void dispatch();
+    void run();
+
+    const TacticalVehicleController& m_controller;
+    QTimer *m_debounce;
+
+    // --- GUI Thread State ---
+    FilterCriteria m_pending;
+    bool m_hasPending = false;
+    std::uint64_t m_latestRequest = 0;
+    std::uint64_t m_delivered = 0;
+
+    // --- Hand-off To The Evaluation Thread ---
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    FilterCriteria m_next;
+    std::uint64_t m_nextRequest = 0;
+    bool m_hasNext = false;
+    bool m_stopping = false;
+    std::atomic<bool> m_cancel{false};
+    std::thread m_thread;
+};
+
+#endif // FILTERWORKER_H
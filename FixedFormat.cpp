@@ -0,0 +1,46 @@
+#include "FixedFormat.h"
+
+#include <cmath>
+
+// --- FixedFormat Implementation ---
+
+namespace {
+// Scaled values below 2^53 are exact integers in a double
+constexpr double MAX_EXACT_SCALED = 9007199254740992.0;
+}
+
+int formatFixed(double value, int decimals, char* buffer) {
+    static constexpr double SCALE[] = {1.0, 10.0, 100.0, 1000.0};
+    if (!std::isfinite(value) || decimals < 0 || decimals > 3) {
+        return 0;
+    }
+    const double product = value * SCALE[decimals];
+    if (!(std::fabs(product) < MAX_EXACT_SCALED)) {
+        return 0;
+    }
+    long long scaled = std::llround(product);
+    const bool negative = scaled < 0;
+    if (negative) {
+        scaled = -scaled;
+    }
+
+    // Digits are written backwards from the end of a scratch area
+    char digits[24];
+    int count = 0;
+    do {
+        if (count == decimals && decimals > 0) {
+            digits[count++] = '.';
+        }
+        digits[count++] = char('0' + scaled % 10);
+        scaled /= 10;
+    } while (scaled != 0 || count <= decimals);
+
+    int length = 0;
+    if (negative) {
+        buffer[length++] = '-';
+    }
+    while (count > 0) {
+        buffer[length++] = digits[--count];
+    }
+    return length;
+}
@@ -0,0 +1,16 @@
+#ifndef FIXEDFORMAT_H
+#define FIXEDFORMAT_H
+
+/**
+ * @brief Formats value with a fixed number of decimals (0-3) into buffer
+ *        (at least 24 chars) using integer arithmetic; returns the length,
+ *        or 0 when the value is out of range for the fast path (the
+ *        scaled value must be an exact integer, below 2^53).
+ *
+ * Avoids the generic double conversion and intermediate QStrings of
+ * QString::number() for the short numbers shown in the table. Values round
+ * half away from zero; the result is not null-terminated.
+ */
+int formatFixed(double value, int decimals, char* buffer);
+
+#endif // FIXEDFORMAT_H
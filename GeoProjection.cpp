@@ -0,0 +1,226 @@
+#include "GeoProjection.h"
+#include "SimdSupport.h"
+
+#include <algorithm>
+#include <cmath>
+
+// --- GeoProjection Implementation ---
+// WGS-84 constants and batched conversions between geodetic coordinates and
+// the Cartesian frame used by the simulation.
+
+namespace {
+constexpr double PI_CONST = 3.14159265358979323846;
+constexpr double DEG_TO_RAD = PI_CONST / 180.0;
+
+// WGS-84 ellipsoid
+constexpr double WGS84_A  = 6378137.0;
+constexpr double WGS84_F  = 1.0 / 298.257223563;
+constexpr double WGS84_E2 = WGS84_F * (2.0 - WGS84_F);
+
+#ifdef TVG_KERNEL_SSE2
+// --- Vector Trigonometry For The Haversine Kernel ---
+// SSE2 has no transcendental instructions, so sine and arcsine are
+// evaluated as polynomials after range reduction. Both stay within a few
+// ulp of the libm results over the inputs the kernel produces.
+
+// Taylor coefficients (-1)^j / (2j+1)! of sin(r) / r
+constexpr double SIN_SERIES[] = {
+    1.0, -1.0 / 6.0, 1.0 / 120.0, -1.0 / 5040.0, 1.0 / 362880.0, -1.0 / 39916800.0,
+    1.0 / 6227020800.0, -1.0 / 1307674368000.0, 1.0 / 355687428096000.0,
+    -1.0 / 121645100408832000.0, 1.0 / 51090942171709440000.0
+};
+constexpr std::size_t SIN_TERMS = sizeof(SIN_SERIES) / sizeof(SIN_SERIES[0]);
+
+// Taylor coefficients (2n)! / (4^n (n!)^2 (2n+1)) of asin(y) / y in y^2
+constexpr std::size_t ASIN_TERMS = 19;
+struct AsinSeries {
+    double c[ASIN_TERMS] = {};
+    constexpr AsinSeries() {
+        double central = 1.0; // (2n)! / (4^n (n!)^2)
+        for (std::size_t n = 0; n < ASIN_TERMS; ++n) {
+            if (n > 0) {
+                central *= (2.0 * n - 1.0) / (2.0 * n);
+            }
+            c[n] = central / (2.0 * n + 1.0);
+        }
+    }
+};
+constexpr AsinSeries ASIN_SERIES;
+
+constexpr double PI_HI = 3.141592653589793116;    // pi rounded to double
+constexpr double PI_LO = 1.2246467991473532e-16;  // pi - PI_HI
+
+/**
+ * @brief sin(x) for |x| below 2^31 * pi: x = k * pi + r with |r| <= pi/2,
+ *        sin(x) = (-1)^k * sin(r).
+ */
+inline __m128d sinPd(__m128d x) {
+    const __m128i k = _mm_cvtpd_epi32(_mm_mul_pd(x, _mm_set1_pd(1.0 / PI_CONST)));
+    const __m128d kd = _mm_cvtepi32_pd(k);
+    const __m128d r = _mm_sub_pd(_mm_sub_pd(x, _mm_mul_pd(kd, _mm_set1_pd(PI_HI))),
+                                 _mm_mul_pd(kd, _mm_set1_pd(PI_LO)));
+    const __m128d r2 = _mm_mul_pd(r, r);
+
+    __m128d p = _mm_set1_pd(SIN_SERIES[SIN_TERMS - 1]);
+    for (std::size_t j = SIN_TERMS - 1; j-- > 0;) {
+        p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(SIN_SERIES[j]));
+    }
+
+    // Odd k flips the sign: move bit 0 of each k into the sign bit of its lane
+    const __m128i parity = _mm_slli_epi64(_mm_shuffle_epi32(k, _MM_SHUFFLE(1, 1, 0, 0)), 63);
+    return _mm_xor_pd(_mm_mul_pd(r, p), _mm_castsi128_pd(parity));
+}
+
+/**
+ * @brief 2 * asin(sqrt(a)) for a in [0, 1].
+ *
+ * Two half-angle steps, sin^2(t/2) = a / (2 (1 + sqrt(1 - a))), bring the
+ * argument below sin^2(pi/8) where the series converges quickly.
+ */
+inline __m128d centralAnglePd(__m128d a) {
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d two = _mm_set1_pd(2.0);
+    for (int step = 0; step < 2; ++step) {
+        const __m128d cosine = _mm_sqrt_pd(_mm_sub_pd(one, a));
+        a = _mm_div_pd(a, _mm_mul_pd(two, _mm_add_pd(one, cosine)));
+    }
+
+    __m128d p = _mm_set1_pd(ASIN_SERIES.c[ASIN_TERMS - 1]);
+    for (std::size_t n = ASIN_TERMS - 1; n-- > 0;) {
+        p = _mm_add_pd(_mm_mul_pd(p, a), _mm_set1_pd(ASIN_SERIES.c[n]));
+    }
+    return _mm_mul_pd(_mm_set1_pd(8.0), _mm_mul_pd(_mm_sqrt_pd(a), p));
+}
+#endif
+}
+
+// --- Lifecycle & Configuration ---
+LocalTangentPlane::LocalTangentPlane(double originLatitude, double originLongitude) {
+    setOrigin(originLatitude, originLongitude);
+}
+
+void LocalTangentPlane::setOrigin(double latitude, double longitude) {
+    m_originLatitude = latitude;
+    m_originLongitude = longitude;
+
+    const double phi = latitude * DEG_TO_RAD;
+    const double sinPhi = std::sin(phi);
+    const double w = 1.0 - WGS84_E2 * sinPhi * sinPhi;
+
+    const double meridional = WGS84_A * (1.0 - WGS84_E2) / (w * std::sqrt(w)); // M
+    const double primeVertical = WGS84_A / std::sqrt(w);                        // N
+
+    m_metersPerDegreeLatitude = meridional * DEG_TO_RAD;
+    m_metersPerDegreeLongitude = primeVertical * std::cos(phi) * DEG_TO_RAD;
+}
+
+// --- Batched Projection ---
+void LocalTangentPlane::toEnu(const double* latitude, const double* longitude,
+                              double* east, double* north, std::size_t count) const {
+    std::size_t i = 0;
+
+#ifdef TVG_KERNEL_SSE2
+    const __m128d lat0 = _mm_set1_pd(m_originLatitude);
+    const __m128d lon0 = _mm_set1_pd(m_originLongitude);
+    const __m128d kLat = _mm_set1_pd(m_metersPerDegreeLatitude);
+    const __m128d kLon = _mm_set1_pd(m_metersPerDegreeLongitude);
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(east + i, _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(longitude + i), lon0), kLon));
+        _mm_storeu_pd(north + i, _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(latitude + i), lat0), kLat));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        east[i] = (longitude[i] - m_originLongitude) * m_metersPerDegreeLongitude;
+        north[i] = (latitude[i] - m_originLatitude) * m_metersPerDegreeLatitude;
+    }
+}
+
+void LocalTangentPlane::toGeodetic(const double* east, const double* north,
+                                   double* latitude, double* longitude, std::size_t count) const {
+    std::size_t i = 0;
+
+#ifdef TVG_KERNEL_SSE2
+    const __m128d lat0 = _mm_set1_pd(m_originLatitude);
+    const __m128d lon0 = _mm_set1_pd(m_originLongitude);
+    const __m128d kLat = _mm_set1_pd(m_metersPerDegreeLatitude);
+    const __m128d kLon = _mm_set1_pd(m_metersPerDegreeLongitude);
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(longitude + i, _mm_add_pd(lon0, _mm_div_pd(_mm_loadu_pd(east + i), kLon)));
+        _mm_storeu_pd(latitude + i, _mm_add_pd(lat0, _mm_div_pd(_mm_loadu_pd(north + i), kLat)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        longitude[i] = m_originLongitude + east[i] / m_metersPerDegreeLongitude;
+        latitude[i] = m_originLatitude + north[i] / m_metersPerDegreeLatitude;
+    }
+}
+
+// --- Reference Path ---
+void LocalTangentPlane::toEnuExact(double latitude, double longitude, double& east, double& north) const {
+    auto toEcef = [](double latDeg, double lonDeg, double& x, double& y, double& z) {
+        const double phi = latDeg * DEG_TO_RAD;
+        const double lambda = lonDeg * DEG_TO_RAD;
+        const double sinPhi = std::sin(phi);
+        const double n = WGS84_A / std::sqrt(1.0 - WGS84_E2 * sinPhi * sinPhi);
+        x = n * std::cos(phi) * std::cos(lambda);
+        y = n * std::cos(phi) * std::sin(lambda);
+        z = n * (1.0 - WGS84_E2) * sinPhi;
+    };
+
+    double x0, y0, z0, x, y, z;
+    toEcef(m_originLatitude, m_originLongitude, x0, y0, z0);
+    toEcef(latitude, longitude, x, y, z);
+
+    const double dx = x - x0;
+    const double dy = y - y0;
+    const double dz = z - z0;
+    const double phi0 = m_originLatitude * DEG_TO_RAD;
+    const double lambda0 = m_originLongitude * DEG_TO_RAD;
+
+    east = -std::sin(lambda0) * dx + std::cos(lambda0) * dy;
+    north = -std::sin(phi0) * std::cos(lambda0) * dx
+            - std::sin(phi0) * std::sin(lambda0) * dy
+            + std::cos(phi0) * dz;
+}
+
+// --- Great-Circle Distances ---
+void GeodeticDistance::haversine(const double* latitude, const double* longitude, std::size_t count,
+                                 double targetLatitude, double targetLongitude, double* distance) {
+    // Target terms are hoisted; per point this leaves three sin/cos and one asin
+    const double phiT = targetLatitude * DEG_TO_RAD;
+    const double cosPhiT = std::cos(phiT);
+    std::size_t i = 0;
+
+#ifdef TVG_KERNEL_SSE2
+    const __m128d vDegToRad = _mm_set1_pd(DEG_TO_RAD);
+    const __m128d vHalf = _mm_set1_pd(0.5);
+    const __m128d vPhiT = _mm_set1_pd(phiT);
+    const __m128d vCosPhiT = _mm_set1_pd(cosPhiT);
+    const __m128d vLambdaT = _mm_set1_pd(targetLongitude);
+    const __m128d vHalfPi = _mm_set1_pd(PI_CONST * 0.5);
+    const __m128d vRadius = _mm_set1_pd(EARTH_RADIUS);
+    const __m128d vZero = _mm_setzero_pd();
+    const __m128d vOne = _mm_set1_pd(1.0);
+    for (; i + 2 <= count; i += 2) {
+        const __m128d phi = _mm_mul_pd(_mm_loadu_pd(latitude + i), vDegToRad);
+        const __m128d sinHalfDPhi = sinPd(_mm_mul_pd(_mm_sub_pd(phi, vPhiT), vHalf));
+        const __m128d sinHalfDLambda = sinPd(_mm_mul_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(longitude + i), vLambdaT),
+                                                                   vDegToRad), vHalf));
+        const __m128d cosPhi = sinPd(_mm_add_pd(phi, vHalfPi));
+        __m128d a = _mm_add_pd(_mm_mul_pd(sinHalfDPhi, sinHalfDPhi),
+                               _mm_mul_pd(_mm_mul_pd(cosPhi, vCosPhiT), _mm_mul_pd(sinHalfDLambda, sinHalfDLambda)));
+        a = _mm_min_pd(vOne, _mm_max_pd(vZero, a));
+        _mm_storeu_pd(distance + i, _mm_mul_pd(vRadius, centralAnglePd(a)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        const double phi = latitude[i] * DEG_TO_RAD;
+        const double sinHalfDPhi = std::sin((phi - phiT) * 0.5);
+        const double sinHalfDLambda = std::sin((longitude[i] - targetLongitude) * DEG_TO_RAD * 0.5);
+        const double a = sinHalfDPhi * sinHalfDPhi + std::cos(phi) * cosPhiT * sinHalfDLambda * sinHalfDLambda;
+        distance[i] = 2.0 * EARTH_RADIUS * std::asin(std::sqrt(std::min(1.0, a)));
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef GEOPROJECTION_H
+#define GEOPROJECTION_H
+
+#include <cstddef>
+
+/**
+ * @class LocalTangentPlane
+ * @brief WGS-84 geodetic <-> local east/north (ENU) projection around an origin.
+ *
+ * The fast path linearizes the ellipsoid at the origin using the meridional
+ * (M) and prime-vertical (N) radii of curvature: one subtract and one
+ * multiply per axis, batched over contiguous arrays. The error grows
+ * quadratically with distance from the origin (roughly 0.1% at 10 km at
+ * mid latitudes); toEnuExact() goes through ECEF and serves as the reference.
+ *
+ * Angles are in degrees, distances in meters. East maps to posX, north to posY.
+ */
+class LocalTangentPlane {
+public:
+    LocalTangentPlane(double originLatitude = 0.0, double originLongitude = 0.0);
+
+    // --- Configuration ---
+    void setOrigin(double latitude, double longitude);
+    double originLatitude() const { return m_originLatitude; }
+    double originLongitude() const { return m_originLongitude; }
+
+    // --- Batched Projection ---
+    void toEnu(const double* latitude, const double* longitude,
+               double* east, double* north, std::size_t count) const;
+    void toGeodetic(const double* east, const double* north,
+                    double* latitude, double* longitude, std::size_t count) const;
+
+    // --- Reference Path ---
+    /// Exact projection via ECEF rotation (ellipsoid height 0); up component dropped.
+    void toEnuExact(double latitude, double longitude, double& east, double& north) const;
+
+private:
+    double m_originLatitude = 0.0;
+    double m_originLongitude = 0.0;
+    double m_metersPerDegreeLatitude = 0.0;  ///< M * pi/180
+    double m_metersPerDegreeLongitude = 0.0; ///< N * cos(lat0) * pi/180
+};
+
+/**
+ * @class GeodeticDistance
+ * @brief Great-circle distances for areas too large for a single tangent plane.
+ */
+class GeodeticDistance {
+public:
+    /// Mean Earth radius (IUGG), meters.
+    static constexpr double EARTH_RADIUS = 6371008.8;
+
+    /**
+     * @brief Haversine distance from count points to one target (meters).
+     *
+     * Spherical model: error stays below ~0.5% versus the ellipsoid at any
+     * range, which is adequate for theater-scale filtering and sorting.
+     * Two points per iteration with SSE2 (polynomial sine and arcsine).
+     */
+    static void haversine(const double* latitude, const double* longitude, std::size_t count,
+                          double targetLatitude, double targetLongitude, double* distance);
+};
+
+#endif // GEOPROJECTION_H
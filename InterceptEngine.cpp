@@ -0,0 +1,291 @@
+#include "InterceptEngine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// --- InterceptEngine Implementation ---
+// Constant-velocity CPA geometry: with relative position r and relative
+// velocity v, the CPA occurs at tau = -(r.v)/|v|^2 and the separation there
+// is |r + v*tau|. Both are invariant while velocities are unchanged.
+
+namespace {
+constexpr double PI_CONST = 3.14159265358979323846;
+constexpr double KMH_PER_MPS = 3.6;
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+// A cached velocity is kept while the current one is within this distance
+// of it (the larger of the two), so jitter does not re-solve every pair
+constexpr double VELOCITY_TOLERANCE = 0.5;           // m/s
+constexpr double VELOCITY_RELATIVE_TOLERANCE = 0.03; // of the current speed
+
+constexpr double MIN_CELL_SIZE = 1.0; // meters, for a radius of 0 and a stationary fleet
+constexpr std::uint8_t ROLE_FRIENDLY = 1;
+constexpr std::uint8_t ROLE_HOSTILE = 2;
+}
+
+// --- Configuration ---
+void InterceptEngine::configure(const std::vector<std::uint32_t>& friendly, const std::vector<std::uint32_t>& hostile,
+                                std::size_t slotCount) {
+    m_friendly = friendly;
+    m_hostile = hostile;
+
+    // Union of the sets; a slot listed in both keeps both roles
+    std::vector<std::uint8_t> role(slotCount, 0);
+    for (const std::uint32_t slot : m_friendly) {
+        if (slot < slotCount) role[slot] |= ROLE_FRIENDLY;
+    }
+    for (const std::uint32_t slot : m_hostile) {
+        if (slot < slotCount) role[slot] |= ROLE_HOSTILE;
+    }
+    m_members.clear();
+    m_role.clear();
+    for (std::size_t slot = 0; slot < slotCount; ++slot) {
+        if (role[slot]) {
+            m_members.push_back(static_cast<std::uint32_t>(slot));
+            m_role.push_back(role[slot]);
+        }
+    }
+
+    m_velocityX.assign(slotCount, 0.0);
+    m_velocityY.assign(slotCount, 0.0);
+    m_cachedSpeed.assign(slotCount, std::numeric_limits<double>::quiet_NaN());
+    m_cachedHeading.assign(slotCount, std::numeric_limits<double>::quiet_NaN());
+    m_changed.assign(slotCount, 1);
+
+    m_pairKeys.clear();
+    m_pairTime.clear();
+    m_pairDistance.clear();
+    m_pairSpeedSq.clear();
+    m_pairsValid = false;
+
+    m_timeToCpa.assign(slotCount, INF);
+    m_cpaDistance.assign(slotCount, INF);
+    m_cpaPartner.assign(slotCount, -1);
+}
+
+void InterceptEngine::setHorizon(double seconds) {
+    m_horizon = std::max(0.0, seconds);
+}
+
+void InterceptEngine::invalidate() {
+    m_pairsValid = false;
+}
+
+// --- Velocity Cache ---
+/**
+ * @brief Re-derives velocity vectors for slots whose speed or heading changed
+ *        and replaces the cached ones that moved beyond the tolerance.
+ *
+ * Same heading convention as the kinematics kernel (navigational degrees,
+ * -90° offset into the Cartesian frame).
+ */
+void InterceptEngine::refreshVelocities(const KinematicsBuffers& k) {
+    const std::size_t count = std::min(k.size(), m_velocityX.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        m_changed[i] = 0;
+        if (k.speed[i] == m_cachedSpeed[i] && k.heading[i] == m_cachedHeading[i]) {
+            continue;
+        }
+        const bool first = std::isnan(m_cachedSpeed[i]);
+        m_cachedSpeed[i] = k.speed[i];
+        m_cachedHeading[i] = k.heading[i];
+
+        const double rad = (k.heading[i] - 90.0) * (PI_CONST / 180.0);
+        const double metersPerSecond = k.speed[i] / KMH_PER_MPS;
+        const double vx = metersPerSecond * std::cos(rad);
+        const double vy = metersPerSecond * std::sin(rad);
+        const double tolerance = std::max(VELOCITY_TOLERANCE, VELOCITY_RELATIVE_TOLERANCE * std::fabs(metersPerSecond));
+        if (!first && std::hypot(vx - m_velocityX[i], vy - m_velocityY[i]) <= tolerance) {
+            continue;
+        }
+        m_velocityX[i] = vx;
+        m_velocityY[i] = vy;
+        m_changed[i] = 1;
+    }
+}
+
+// --- Broad Phase ---
+/**
+ * @brief Fills m_nextKeys with the pairs that can close to the threat
+ *        radius within the horizon, sorted.
+ *
+ * Each pair is looked up from its member with the longer reach, whose
+ * search range (radius plus twice its reach) then covers the pair's
+ * closing distance. The grid cell is sized for the median reach, so a few
+ * fast tracks widen only their own searches.
+ */
+void InterceptEngine::collectCandidates(const KinematicsBuffers& k, double threatRadius) {
+    const std::size_t members = m_members.size();
+    m_memberX.resize(members);
+    m_memberY.resize(members);
+    m_reach.resize(members);
+    for (std::size_t m = 0; m < members; ++m) {
+        const std::uint32_t slot = m_members[m];
+        m_memberX[m] = k.posX[slot];
+        m_memberY[m] = k.posY[slot];
+        m_reach[m] = std::fabs(k.speed[slot]) / KMH_PER_MPS * m_horizon;
+    }
+
+    m_nextKeys.clear();
+    if (members == 0 || m_friendly.empty() || m_hostile.empty()) {
+        return;
+    }
+
+    std::vector<double> reaches(m_reach);
+    auto median = reaches.begin() + reaches.size() / 2;
+    std::nth_element(reaches.begin(), median, reaches.end());
+    const double cellSize = std::max(MIN_CELL_SIZE, threatRadius + 2.0 * *median);
+    m_grid.build(m_memberX.data(), m_memberY.data(), members, cellSize);
+
+    for (std::size_t a = 0; a < members; ++a) {
+        const double reachA = m_reach[a];
+        m_grid.forEachNear(a, threatRadius + 2.0 * reachA, [&](std::uint32_t b) {
+            // Every pair once, from the member with the longer reach
+            if (b == a || m_reach[b] > reachA || (m_reach[b] == reachA && b < a)) {
+                return;
+            }
+            const bool forward = (m_role[a] & ROLE_FRIENDLY) && (m_role[b] & ROLE_HOSTILE);
+            const bool backward = (m_role[a] & ROLE_HOSTILE) && (m_role[b] & ROLE_FRIENDLY);
+            if (!forward && !backward) {
+                return;
+            }
+            const double closing = threatRadius + reachA + m_reach[b];
+            const double dx = m_memberX[b] - m_memberX[a];
+            const double dy = m_memberY[b] - m_memberY[a];
+            if (dx * dx + dy * dy > closing * closing) {
+                return;
+            }
+            const std::uint64_t slotA = m_members[a];
+            const std::uint64_t slotB = m_members[b];
+            if (forward) m_nextKeys.push_back(slotA << 32 | slotB);
+            if (backward) m_nextKeys.push_back(slotB << 32 | slotA);
+        });
+    }
+
+    std::sort(m_nextKeys.begin(), m_nextKeys.end());
+    m_nextKeys.erase(std::unique(m_nextKeys.begin(), m_nextKeys.end()), m_nextKeys.end());
+}
+
+// --- Pair Solution ---
+void InterceptEngine::solvePair(const KinematicsBuffers& k, std::size_t pair,
+                                std::uint32_t f, std::uint32_t h, double now) {
+    const double rx = k.posX[h] - k.posX[f];
+    const double ry = k.posY[h] - k.posY[f];
+    const double vx = m_velocityX[h] - m_velocityX[f];
+    const double vy = m_velocityY[h] - m_velocityY[f];
+    const double speedSq = vx * vx + vy * vy;
+
+    if (speedSq > 0.0) {
+        const double tau = -(rx * vx + ry * vy) / speedSq;
+        const double cx = rx + vx * tau;
+        const double cy = ry + vy * tau;
+        m_nextTime[pair] = now + tau;
+        m_nextDistance[pair] = std::sqrt(cx * cx + cy * cy);
+    } else {
+        // No relative motion: the separation is constant and already minimal
+        m_nextTime[pair] = now;
+        m_nextDistance[pair] = std::sqrt(rx * rx + ry * ry);
+    }
+    m_nextSpeedSq[pair] = speedSq;
+}
+
+// --- Update ---
+std::size_t InterceptEngine::update(const KinematicsBuffers& k, double now, double threatRadius) {
+    if (k.size() != m_velocityX.size()) {
+        return 0;
+    }
+
+    refreshVelocities(k);
+    collectCandidates(k, threatRadius);
+
+    // Merge-join with the previous candidates: pairs that stay keep their
+    // invariants unless a member's cached velocity was replaced
+    const std::size_t pairs = m_nextKeys.size();
+    m_nextTime.resize(pairs);
+    m_nextDistance.resize(pairs);
+    m_nextSpeedSq.resize(pairs);
+
+    std::size_t solved = 0;
+    std::size_t previous = 0;
+    for (std::size_t p = 0; p < pairs; ++p) {
+        const std::uint64_t key = m_nextKeys[p];
+        const auto f = static_cast<std::uint32_t>(key >> 32);
+        const auto h = static_cast<std::uint32_t>(key);
+        while (previous < m_pairKeys.size() && m_pairKeys[previous] < key) {
+            ++previous;
+        }
+        const bool known = m_pairsValid && previous < m_pairKeys.size() && m_pairKeys[previous] == key;
+        if (known && !m_changed[f] && !m_changed[h]) {
+            m_nextTime[p] = m_pairTime[previous];
+            m_nextDistance[p] = m_pairDistance[previous];
+            m_nextSpeedSq[p] = m_pairSpeedSq[previous];
+        } else {
+            solvePair(k, p, f, h, now);
+            ++solved;
+        }
+    }
+    m_pairKeys.swap(m_nextKeys);
+    m_pairTime.swap(m_nextTime);
+    m_pairDistance.swap(m_nextDistance);
+    m_pairSpeedSq.swap(m_nextSpeedSq);
+    m_pairsValid = true;
+
+    std::fill(m_timeToCpa.begin(), m_timeToCpa.end(), INF);
+    std::fill(m_cpaDistance.begin(), m_cpaDistance.end(), INF);
+    std::fill(m_cpaPartner.begin(), m_cpaPartner.end(), -1);
+
+    // Threats (CPA inside the radius) rank by time, everything else by distance
+    auto consider = [this, threatRadius](std::uint32_t slot, std::uint32_t partner, double time, double distance) {
+        const bool threat = distance <= threatRadius;
+        const bool bestThreat = m_cpaDistance[slot] <= threatRadius;
+        const bool better = threat != bestThreat ? threat
+                          : threat ? time < m_timeToCpa[slot]
+                                   : distance < m_cpaDistance[slot];
+        if (better) {
+            m_timeToCpa[slot] = time;
+            m_cpaDistance[slot] = distance;
+            m_cpaPartner[slot] = static_cast<std::int32_t>(partner);
+        }
+    };
+
+    for (std::size_t p = 0; p < pairs; ++p) {
+        const auto f = static_cast<std::uint32_t>(m_pairKeys[p] >> 32);
+        const auto h = static_cast<std::uint32_t>(m_pairKeys[p]);
+
+        // Past the CPA the separation grows along the relative velocity,
+        // perpendicular to the CPA offset
+        const double remaining = m_pairTime[p] - now;
+        double time = remaining;
+        double distance = m_pairDistance[p];
+        if (remaining < 0.0) {
+            time = 0.0;
+            distance = std::sqrt(distance * distance + m_pairSpeedSq[p] * remaining * remaining);
+        }
+
+        consider(f, h, time, distance);
+        consider(h, f, time, distance);
+    }
+
+    return solved;
+}
+
+// --- Target ETA ---
+void InterceptEngine::computeEta(const KinematicsBuffers& k, double targetX, double targetY, double* eta) const {
+    const std::size_t count = std::min(k.size(), m_velocityX.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        const double rx = targetX - k.posX[i];
+        const double ry = targetY - k.posY[i];
+        const double rangeSq = rx * rx + ry * ry;
+
+        // range / closing speed == range^2 / (v . r)
+        const double closing = m_velocityX[i] * rx + m_velocityY[i] * ry;
+        if (rangeSq == 0.0) {
+            eta[i] = 0.0;
+        } else if (closing > 0.0) {
+            eta[i] = rangeSq / closing;
+        } else {
+            eta[i] = INF;
+        }
+    }
+}
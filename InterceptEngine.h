@@ -0,0 +1,123 @@
+#ifndef INTERCEPTENGINE_H
+#define INTERCEPTENGINE_H
+
+#include "ProximityGrid.h"
+#include "SimulationKernel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class InterceptEngine
+ * @brief Closest point of approach (CPA) and ETA engine for friendly x hostile sets.
+ *
+ * Only pairs that can close to the threat radius within the horizon are
+ * evaluated: a track covers at most speed * horizon meters in that time,
+ * so a ProximityGrid broad phase over the set members keeps the pairs whose
+ * separation is at most the radius plus both reaches. The candidate list is
+ * sorted, so each update merge-joins it with the previous one.
+ *
+ * Velocities are derived from speed and heading and cached per slot; a
+ * cached velocity is only replaced when the current one deviates from it by
+ * more than max(0.5 m/s, 3 %), so speed jitter does not invalidate every
+ * pair. For a pair moving at constant velocities the absolute CPA time, the
+ * CPA distance and the relative speed are invariants, so they are kept per
+ * candidate and only re-solved when either member's cached velocity
+ * changed. Between re-solves, time-to-CPA is the cached CPA time minus the
+ * clock, and the separation of a pair that has already passed its CPA
+ * follows from Pythagoras.
+ *
+ * Each set member is then reduced to its most urgent candidate opponent:
+ * the earliest CPA inside the threat radius or, if none, the closest CPA.
+ * Members without candidates report no CPA (infinite time and distance).
+ */
+class InterceptEngine {
+public:
+    // --- Configuration ---
+    /**
+     * @brief Installs the friendly and hostile slot sets and invalidates all
+     *        cached solutions. Storage is per slot only.
+     */
+    void configure(const std::vector<std::uint32_t>& friendly, const std::vector<std::uint32_t>& hostile,
+                   std::size_t slotCount);
+
+    /// Seconds ahead a pair must be able to reach the threat radius in (default 300).
+    void setHorizon(double seconds);
+    double horizon() const { return m_horizon; }
+
+    /// Forces every pair to be re-solved on the next update (e.g. after positions were reset).
+    void invalidate();
+
+    // --- Update ---
+    /**
+     * @brief Refreshes velocities and candidates, re-solves changed pairs and
+     *        reduces per slot.
+     * @param now Simulation clock (seconds).
+     * @return Number of pairs that had to be re-solved.
+     */
+    std::size_t update(const KinematicsBuffers& k, double now, double threatRadius);
+
+    /**
+     * @brief Seconds until each slot reaches (targetX, targetY) at its current
+     *        closing speed; infinity when not closing.
+     *
+     * Requires velocities refreshed by update().
+     */
+    void computeEta(const KinematicsBuffers& k, double targetX, double targetY, double* eta) const;
+
+    // --- Results (per slot) ---
+    double timeToCpa(std::size_t slot) const { return m_timeToCpa[slot]; }
+    double cpaDistance(std::size_t slot) const { return m_cpaDistance[slot]; }
+    std::int32_t cpaPartner(std::size_t slot) const { return m_cpaPartner[slot]; }
+    /// Candidate pairs of the last update.
+    std::size_t pairCount() const { return m_pairKeys.size(); }
+    std::size_t slotCount() const { return m_timeToCpa.size(); }
+    const std::vector<std::uint32_t>& friendlySlots() const { return m_friendly; }
+    const std::vector<std::uint32_t>& hostileSlots() const { return m_hostile; }
+
+private:
+    void refreshVelocities(const KinematicsBuffers& k);
+    void collectCandidates(const KinematicsBuffers& k, double threatRadius);
+    void solvePair(const KinematicsBuffers& k, std::size_t pair, std::uint32_t f, std::uint32_t h, double now);
+
+    // --- Sets ---
+    std::vector<std::uint32_t> m_friendly;
+    std::vector<std::uint32_t> m_hostile;
+    std::vector<std::uint32_t> m_members;   ///< Union of both sets, ascending
+    std::vector<std::uint8_t> m_role;       ///< Per member: 1 = friendly, 2 = hostile (or both)
+    double m_horizon = 300.0;
+
+    // --- Velocity Cache (per slot) ---
+    std::vector<double> m_velocityX;      ///< m/s, east
+    std::vector<double> m_velocityY;      ///< m/s, north
+    std::vector<double> m_cachedSpeed;    ///< Speed last seen (NaN = never)
+    std::vector<double> m_cachedHeading;
+    std::vector<std::uint8_t> m_changed;  ///< Cached velocity replaced in the last refresh
+
+    // --- Broad Phase (per member) ---
+    ProximityGrid m_grid;
+    std::vector<double> m_memberX;
+    std::vector<double> m_memberY;
+    std::vector<double> m_reach;          ///< Meters coverable within the horizon
+
+    // --- Candidate Pairs (sorted by friendly slot << 32 | hostile slot) ---
+    std::vector<std::uint64_t> m_pairKeys;
+    std::vector<double> m_pairTime;       ///< Absolute (unclamped) CPA time
+    std::vector<double> m_pairDistance;   ///< Separation at CPA
+    std::vector<double> m_pairSpeedSq;    ///< |relative velocity|^2
+
+    // Next candidate list, swapped in by update(); kept to reuse its storage
+    std::vector<std::uint64_t> m_nextKeys;
+    std::vector<double> m_nextTime;
+    std::vector<double> m_nextDistance;
+    std::vector<double> m_nextSpeedSq;
+    bool m_pairsValid = false;
+
+    // --- Results (per slot) ---
+    std::vector<double> m_timeToCpa;
+    std::vector<double> m_cpaDistance;
+    std::vector<std::int32_t> m_cpaPartner;
+};
+
+#endif // INTERCEPTENGINE_H
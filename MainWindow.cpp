@@ -1,6 +1,13 @@
 #include "MainWindow.h"
+#include "DatasetLoader.h"
+#include "FilterWorker.h"
 #include "TacticalVehicleData.h"
+#include "PerformanceMonitor.h"
 #include "RangeSlider.h"
+#include "TacticalMapView.h"
+#include "TaskScheduler.h"
+#include "TrackUpdateBus.h"
+#include "VehicleTableModel.h"
 
 #include <QApplication>
 #include <QObject>
@@ -14,6 +21,8 @@
 #include <QString>
 #include <QStringList>
 #include <QCompleter>
+#include <QStringListModel>
+#include <QProgressBar>
 #include <QIcon>
 #include <QFile>
 #include <QHBoxLayout>
@@ -25,10 +34,23 @@
 #include <QIntValidator>
 #include <QDialog>
 #include <QListWidgetItem>
+#include <QTabWidget>
+#include <QTableView>
+#include <QHeaderView>
+#include <QFontMetrics>
+#include <QDebug>
 
 #include <vector>
 #include <algorithm>
 
+namespace {
+constexpr int SIM_TICK_MS = 100;        ///< Simulation base tick
+constexpr int LIST_REFRESH_TICKS = 10;  ///< Base ticks per result list refresh
+constexpr int DISPLAY_FRAME_MS = 33;    ///< Extrapolated view refresh (~30 Hz)
+constexpr int PERFORMANCE_SAMPLE_MS = 100;       ///< Event-loop lag probe interval
+constexpr int PERFORMANCE_REFRESH_SAMPLES = 5;   ///< Lag probes per performance panel refresh
+}
+
 /**
  * @brief Constructs and wires the main tactical gateway UI.
  *
@@ -41,7 +63,14 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent) {
     // --- DATA & CORE INITIALIZATION ---
     tacticalVehicleDb = std::make_unique<TacticalVehicleData>();
     controller = std::make_unique<TacticalVehicleController>(*tacticalVehicleDb);
-    tacticalVehicleDb->loadVehiclesFromJson(":/data/vehicles.json");
+    trackBus = new TrackUpdateBus(*tacticalVehicleDb, *controller, this);
+    filterWorker = std::make_unique<FilterWorker>(*controller);
+    connect(filterWorker.get(), &FilterWorker::filterReady, this, &MainWindow::filterResultsReady);
+    // The dataset is loaded in the background once the window is built
+    datasetLoader = std::make_unique<DatasetLoader>();
+    connect(datasetLoader.get(), &DatasetLoader::chunkReady, this, &MainWindow::datasetChunksReady);
+    connect(datasetLoader.get(), &DatasetLoader::progress, this, &MainWindow::datasetProgress);
+    connect(datasetLoader.get(), &DatasetLoader::finished, this, &MainWindow::datasetFinished);
     choiceDeletion = QIcon::fromTheme(QIcon::ThemeIcon::WindowClose);
 
     setMinimumSize(1000, 720);
@@ -211,6 +240,15 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent) {
     coordLayout->addWidget(targetYLine);
     teleGrid->addLayout(coordLayout, 4, 1, 1, 2);
 
+    teleGrid->addWidget(new QLabel("Within " + QString::number(controller->proximityRadius() / 1000.0) + " km of:"), 5, 0);
+    proximityButton = new QPushButton("No Constraint");
+    proximityMenu = new QMenu(this);
+    proximityMenu->addAction("No Constraint");
+    proximityMenu->addAction("Friendly");
+    proximityMenu->addAction("Hostile");
+    proximityButton->setMenu(proximityMenu);
+    teleGrid->addWidget(proximityButton, 5, 1, 1, 2);
+
     teleGroup->setLayout(teleGrid);
     leftPanel->addWidget(teleGroup);
 
@@ -252,6 +290,34 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent) {
     headerLayout->setContentsMargins(10, 5, 10, 5);
     rightPanel->addWidget(headerBar);
 
+    // Simulation Clock Controls
+    QHBoxLayout *clockBarLayout = new QHBoxLayout();
+    clockBarLayout->setContentsMargins(0, 10, 0, 0);
+    pauseButton = new QPushButton("Pause");
+    pauseButton->setCheckable(true);
+    stepButton = new QPushButton("Step");
+    stepButton->setEnabled(false);
+    warpButton = new QPushButton("Warp: 1x");
+    warpMenu = new QMenu(this);
+    for (const int factor : {1, 10, 60, 300}) {
+        warpMenu->addAction(QString("Warp: %1x").arg(factor))->setData(factor);
+    }
+    warpButton->setMenu(warpMenu);
+    clockLabel = new QLabel();
+    clockLabel->setContentsMargins(10, 0, 10, 0);
+    clockBarLayout->addWidget(pauseButton);
+    clockBarLayout->addWidget(stepButton);
+    clockBarLayout->addWidget(warpButton);
+    clockBarLayout->addWidget(clockLabel);
+    clockBarLayout->addStretch();
+    loadProgress = new QProgressBar();
+    loadProgress->setMaximumWidth(260);
+    loadProgress->setTextVisible(true);
+    loadProgress->setFormat("Loading assets: %v / %m");
+    loadProgress->hide();
+    clockBarLayout->addWidget(loadProgress);
+    rightPanel->addLayout(clockBarLayout);
+
     // Sort Menu Actions
     QHBoxLayout *sortBarLayout = new QHBoxLayout();
     clearButton = new QPushButton("Clear all filters");
@@ -262,6 +328,15 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent) {
     sortBarLayout->addWidget(clearButton);
     sortBarLayout->addWidget(liveUpdateLabel);
     sortBarLayout->addWidget(liveUpdatesBox);
+    QLabel *performanceBoxLabel = new QLabel("Performance");
+    performanceBoxLabel->setContentsMargins(10, 0, 10, 0);
+    performanceBox = new QCheckBox;
+    sortBarLayout->addWidget(performanceBoxLabel);
+    sortBarLayout->addWidget(performanceBox);
+    supplyAlertLabel = new QLabel();
+    supplyAlertLabel->setStyleSheet("color: #e0a000;");
+    supplyAlertLabel->setContentsMargins(10, 0, 10, 0);
+    sortBarLayout->addWidget(supplyAlertLabel);
     sortBarLayout->addStretch();
     sortButton = new QPushButton("Sort");
     sortMenu = new QMenu(this);
@@ -273,14 +348,48 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent) {
     QAction* actionPriorityDesc = new QAction("Priority (Z-A)", this);
     QAction* actionClassAsc = new QAction("Classification (A-Z)", this);
     QAction* actionClassDesc = new QAction("Classification (Z-A)", this);
-    sortMenu->addActions({actionDistAsc, actionDistDesc, actionFuelAsc, actionFuelDesc, actionPriorityAsc, actionPriorityDesc, actionClassAsc, actionClassDesc});
+    QAction* actionInterceptAsc = new QAction("Intercept: Soonest First", this);
+    QAction* actionEtaAsc = new QAction("ETA to Target: Soonest First", this);
+    sortMenu->addActions({actionDistAsc, actionDistDesc, actionFuelAsc, actionFuelDesc, actionPriorityAsc, actionPriorityDesc, actionClassAsc, actionClassDesc, actionInterceptAsc, actionEtaAsc});
     sortButton->setMenu(sortMenu);
     sortBarLayout->addWidget(sortButton);
     rightPanel->addLayout(sortBarLayout);
 
-    // Result List
-    resultsList = new QListWidget();
-    rightPanel->addWidget(resultsList);
+    // Result Table
+    // Fixed row heights let the view map the scroll position to rows without
+    // measuring them, so only the visible rows are ever formatted.
+    resultsModel = new VehicleTableModel(this);
+    resultsTable = new QTableView();
+    resultsTable->setModel(resultsModel);
+    QFont monoFont("Lucida Console", 12);
+    monoFont.setStyleHint(QFont::Monospace);
+    resultsTable->setFont(monoFont);
+    resultsTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+    resultsTable->setSelectionMode(QAbstractItemView::SingleSelection);
+    resultsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    resultsTable->setShowGrid(false);
+    resultsTable->setWordWrap(false);
+    resultsTable->verticalHeader()->hide();
+    resultsTable->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    resultsTable->verticalHeader()->setDefaultSectionSize(QFontMetrics(monoFont).height() + 6);
+    resultsTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
+    resultsTable->horizontalHeader()->setStretchLastSection(true);
+
+    // Tactical Map
+    mapView = new TacticalMapView(*controller, [this]() { return displayTime(); });
+
+    QTabWidget *resultsTabs = new QTabWidget();
+    resultsTabs->addTab(resultsTable, "List");
+    resultsTabs->addTab(mapView, "Map");
+    rightPanel->addWidget(resultsTabs);
+
+    // Performance Panel (hidden until enabled)
+    performanceLabel = new QLabel();
+    performanceLabel->setFont(monoFont);
+    performanceLabel->setContentsMargins(10, 6, 10, 6);
+    performanceLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    performanceLabel->hide();
+    rightPanel->addWidget(performanceLabel);
 
     // --- FINAL LAYOUT ASSEMBLY ---
     mainLayout->addLayout(leftPanel, 1);
@@ -304,6 +413,10 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent) {
 
     // Strategic Menus
     connect(affiliationMenu, &QMenu::triggered, this, &MainWindow::affiliationActionClicked);
+    connect(proximityMenu, &QMenu::triggered, this, &MainWindow::proximityActionClicked);
+    connect(warpMenu, &QMenu::triggered, this, &MainWindow::warpActionClicked);
+    connect(pauseButton, &QPushButton::toggled, this, &MainWindow::pauseToggled);
+    connect(stepButton, &QPushButton::clicked, this, &MainWindow::stepClicked);
     connect(domainMenu, &QMenu::triggered, this, &MainWindow::domainActionClicked);
     connect(domainButtonSelectionPressed_Btn, &QPushButton::clicked, this, &MainWindow::domainSelectionPressed);
     connect(propulsionMenu, &QMenu::triggered, this, &MainWindow::propulsionActionClicked);
@@ -325,6 +438,9 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent) {
     connect(targetXLine, &QLineEdit::textChanged, this, &MainWindow::filterFunction);
     connect(targetYLine, &QLineEdit::textChanged, this, &MainWindow::filterFunction);
 
+    // Instrumentation
+    connect(performanceBox, &QCheckBox::toggled, this, &MainWindow::performanceToggled);
+
     // Filter Clearing
     connect(clearButton, &QPushButton::clicked, this, &MainWindow::filtersCleared);
 
@@ -338,35 +454,53 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent) {
     connect(actionPriorityDesc, &QAction::triggered, this, &MainWindow::sortByPriorityDesc);
     connect(actionClassAsc, &QAction::triggered, this, &MainWindow::sortByClassificationAsc);
     connect(actionClassDesc, &QAction::triggered, this, &MainWindow::sortByClassificationDesc);
+    connect(actionInterceptAsc, &QAction::triggered, this, &MainWindow::sortByInterceptAsc);
+    connect(actionEtaAsc, &QAction::triggered, this, &MainWindow::sortByEtaAsc);
     connect(exitButton, &QPushButton::clicked, qApp, &QApplication::quit);
 
-    // Listwidget dialog
-    connect(resultsList, &QListWidget::itemDoubleClicked, this, &MainWindow::listItemDoubleclicked);
+    // Results table dialog
+    connect(resultsTable, &QTableView::doubleClicked, this, &MainWindow::resultDoubleClicked);
 
     // --- AUTO-COMPLETE & DYNAMIC UPDATES ---
-    // Populate Search Data
-    for (const auto& v : tacticalVehicleDb->vehicles()) {
-        if (!v.callsign.isEmpty() && !callsignList.contains(v.callsign)) {
-            callsignList << v.callsign;
-        }
-        if (!v.trackId.isEmpty() && !trackIdList.contains(v.trackId)) {
-            trackIdList << v.trackId;
-        }
-    }
-
-    callsignCompleter = new QCompleter(callsignList, this);
+    // Search terms arrive with the dataset chunks (see datasetChunksReady())
+    callsignModel = new QStringListModel(this);
+    callsignCompleter = new QCompleter(callsignModel, this);
     callsignCompleter->setCaseSensitivity(Qt::CaseInsensitive);
     callsignLine->setCompleter(callsignCompleter);
 
-    trackIdCompleter = new QCompleter(trackIdList, this);
+    trackIdModel = new QStringListModel(this);
+    trackIdCompleter = new QCompleter(trackIdModel, this);
     trackIdCompleter->setCaseSensitivity(Qt::CaseInsensitive);
     trackIdCompleter->setFilterMode(Qt::MatchContains);
     trackIdLine->setCompleter(trackIdCompleter);
 
     // Simulation Heartbeat
+    // 10 Hz base tick: Flash/High tracks update every step, Routine at 2 Hz
+    // and Low at 1 Hz; lagging tracks are dead-reckoned between updates.
+    // Under warp the clock sub-steps within half of each tick.
+    simClock.setBaseTimestep(SIM_TICK_MS / 1000.0);
+    simClock.setStepBudget(SIM_TICK_MS / 2000.0);
+    controller->setTimestep(simClock.baseTimestep());
+    controller->setRateDivisors({1, 1, 5, 10});
+    controller->setThreadCount(static_cast<int>(TaskScheduler::shared().concurrency()));
+    controller->setClusteringEnabled(true);
+    updateClockLabel();
+
     simTimer = new QTimer(this);
     connect(simTimer, &QTimer::timeout, this, &MainWindow::onSimulationTick);
-    simTimer->start(1000);
+    simTimer->start(SIM_TICK_MS);
+    tickClock.start();
+
+    // Views dead-reckon between ticks instead of waiting for the next step
+    displayTimer = new QTimer(this);
+    connect(displayTimer, &QTimer::timeout, this, [this]() { trackBus->publishFrame(displayTime()); });
+    displayTimer->start(DISPLAY_FRAME_MS);
+
+    performanceTimer = new QTimer(this);
+    performanceTimer->setTimerType(Qt::PreciseTimer);
+    connect(performanceTimer, &QTimer::timeout, this, &MainWindow::samplePerformance);
+
+    datasetLoader->load(":/data/vehicles.json");
 }
 
 // --- Filtering Logic ---
@@ -412,8 +546,85 @@ void MainWindow::filterFunction() {
     // --- Affiliation ---
     criteria.affiliation = affiliationButton->text();
 
-    controller->applyFilter(criteria);
+    // --- Proximity ---
+    criteria.proximityActive = proximityButton->text() != "No Constraint";
+    criteria.proximityAffiliation = proximityButton->text();
+
+    // Evaluated off the GUI thread; see filterResultsReady()
+    filterWorker->request(criteria);
+}
+
+// Installs the result of the latest filter request.
+void MainWindow::filterResultsReady(const FilterCriteria& criteria,
+                                    const std::vector<const TacticalVehicle*>& result) {
+    controller->installFilter(criteria, result);
+    controller->publishDeferred();
+    updateResultCount();
+
+    if (displayRequested) {
+        displayRequested = false;
+        manualUpdateRequested = true;
+        printList();
+        sortByDistanceAsc();
+        manualUpdateRequested = false;
+    } else if (datasetGrew) {
+        // Rows shown while the dataset loads follow it as chunks arrive;
+        // the rows already displayed keep their order and selection
+        datasetGrew = false;
+        if (resultsModel->rowCount() > 0) {
+            resultsModel->updateRows(resultRows(), controller->filterRevision());
+        }
+    }
+}
+
+// --- Background Dataset Load ---
+// Chunks are appended as they arrive, so the tables, map and search are
+// usable on the records loaded so far; the simulation rebinds on its next
+// step and the current criteria are re-evaluated over the grown dataset.
+void MainWindow::datasetChunksReady() {
+    std::vector<DatasetChunk> chunks = datasetLoader->takeChunks();
+    if (chunks.empty()) return;
+
+    for (DatasetChunk& chunk : chunks) {
+        controller->appendVehicles(std::move(chunk.batch));
+        appendCompletions(callsignModel, chunk.callsigns);
+        appendCompletions(trackIdModel, chunk.trackIds);
+        callsignList += chunk.callsigns;
+        trackIdList += chunk.trackIds;
+    }
+
+    datasetGrew = true;
+    updateResultCount();
+    filterFunction();
+}
+
+void MainWindow::datasetProgress(int loaded, int total) {
+    // An empty range shows a busy indicator while the document is parsed
+    loadProgress->setRange(0, total);
+    loadProgress->setValue(loaded);
+    loadProgress->show();
+}
+
+void MainWindow::datasetFinished(bool ok, int total) {
+    loadProgress->hide();
+    if (!ok) {
+        supplyAlertLabel->setText("Dataset could not be loaded");
+        return;
+    }
+    qDebug() << "Tactical System: Successfully indexed" << total << "assets.";
+}
+
+// Appends new terms without resetting the model, so an open completer popup stays in place.
+void MainWindow::appendCompletions(QStringListModel *model, const QStringList& terms) {
+    if (terms.isEmpty()) return;
+    const int first = model->rowCount();
+    model->insertRows(first, terms.size());
+    for (int i = 0; i < terms.size(); ++i) {
+        model->setData(model->index(first + i), terms.at(i));
+    }
+}
 
+void MainWindow::updateResultCount() {
     if (!controller->isFilterActive()) {
         displayButton->setText(
             "DISPLAY RESULTS (" +
@@ -472,6 +683,7 @@ void MainWindow::filtersCleared() {
 
     // --- Affiliation ---
     affiliationButton->setText("All Types");
+    proximityButton->setText("No Constraint");
 
     filterFunction();
 }
@@ -543,6 +755,11 @@ void MainWindow::affiliationActionClicked(QAction* action) {
     filterFunction();
 }
 
+void MainWindow::proximityActionClicked(QAction* action) {
+    proximityButton->setText(action->text());
+    filterFunction();
+}
+
 void MainWindow::domainActionClicked(QAction* action) {
     domainButton->setText(action->text());
     domainButtonSelectionPressed_Btn->setVisible(true);
@@ -775,149 +992,244 @@ void MainWindow::fuelInputMaxChanged(const QString &fuelString) {
 void MainWindow::onSimulationTick() {
     const double targetX = targetXLine->text().toDouble();
     const double targetY = targetYLine->text().toDouble();
-    controller->updateSimulation(targetX, targetY);
-    if (resultsList->count() > 0 && liveUpdatesBox->isChecked()) {
-        manualUpdateRequested = true;
-        if (sortButton->text() == "Distance: Closest First") {
-            sortByDistanceAsc();
-        }
-        else if (sortButton->text() == "Distance: Farthest First") {
-            sortByDistanceDesc();
-        } else {
+
+    // Measured wall time, so timer jitter and stalls do not skew the warp.
+    // A recording fixes the timestep, so the clock sheds time instead
+    simClock.setCoarseningEnabled(!controller->isRecording());
+    const ClockTick tick = simClock.advance(tickClock.restart() / 1000.0);
+    if (tick.steps > 0) {
+        // Coarse timesteps are whole base multiples, so this is a no-op
+        // (no slot synchronization) until the multiple changes
+        controller->setTimestep(tick.timestep);
+        QElapsedTimer stepTimer;
+        stepTimer.start();
+        controller->advanceSteps(tick.steps, targetX, targetY);
+        simClock.reportStepCost(stepTimer.nsecsElapsed() / 1e9, tick.steps);
+    }
+    updateClockLabel();
+    if (tick.steps == 0) return;
+
+    // Only integration runs every tick; the map and entity dialogs dead-reckon
+    // in between. Proximity, intercepts, clusters and the records are
+    // refreshed at the list cadence, or at once for a single step
+    if (++simulationTicks % LIST_REFRESH_TICKS != 0 && !simClock.isPaused()) return;
+    controller->publish();
+
+    // The controller re-filters itself when fuel crosses the filter band
+    updateResultCount();
+    fuelSlider->setHistogram(controller->fuelHistogram().counts());
+    distanceSlider->setHistogram(controller->distanceHistogram().counts());
+    showSupplyAlerts(controller->takeSupplyEvents());
+
+    // Subscribed entity dialogs and the result table hear about the changes
+    // published since the last refresh
+    const VehicleChangeSet changes = controller->takeChanges();
+    trackBus->publish(changes, displayTime());
+    if (changes.reloaded()) {
+        mapView->invalidateTracks();
+        // The rows and their slot index refer to the old layout, so the
+        // table is rebuilt at once even while live updates are off
+        tableChanges.clear();
+        if (resultsModel->rowCount() > 0) {
+            manualUpdateRequested = true;
             printList();
+            manualUpdateRequested = false;
         }
-        manualUpdateRequested = false;
+    } else {
+        if (changes.relayout()) {
+            // Appended chunks moved vehicles to new slots; the records and
+            // rows stay, only slot-keyed caches are rebuilt
+            mapView->invalidateTracks();
+            resultsModel->invalidateSlotIndex();
+        }
+        tableChanges.merge(changes);
+    }
+
+    if (resultsModel->rowCount() > 0 && liveUpdatesBox->isChecked()) {
+        ScopedLatency latency(LatencyRender);
+        if (resultsModel->filterRevision() != controller->filterRevision()) {
+            resultsModel->updateRows(resultRows(), controller->filterRevision());
+        }
+        // Only changed cells are announced; sorts on live keys re-order
+        resultsModel->applyChanges(tableChanges);
+    }
+    tableChanges.clear();
+}
+
+// --- Instrumentation ---
+// The monitor only records while the panel is shown, so its timers cost a
+// single flag check otherwise.
+void MainWindow::performanceToggled(bool enabled) {
+    PerformanceMonitor& monitor = PerformanceMonitor::shared();
+    monitor.reset();
+    monitor.setEnabled(enabled);
+    performanceLabel->setVisible(enabled);
+    performanceLabel->setText("Collecting samples...");
+    if (enabled) {
+        performanceSamples = 0;
+        performanceClock.start();
+        performanceTimer->start(PERFORMANCE_SAMPLE_MS);
+    } else {
+        performanceTimer->stop();
+    }
+}
+
+// Event-loop lag is the lateness of this timer; the panel is refreshed every
+// few probes with rolling percentiles of every metric.
+void MainWindow::samplePerformance() {
+    PerformanceMonitor& monitor = PerformanceMonitor::shared();
+    const qint64 late = performanceClock.restart() - PERFORMANCE_SAMPLE_MS;
+    monitor.record(LatencyEventLoop, static_cast<double>(std::max<qint64>(late, 0)));
+
+    if (++performanceSamples % PERFORMANCE_REFRESH_SAMPLES != 0) return;
+
+    QString text = QString("%1%2%3%4%5%6\n").arg("(ms)", -16).arg("p50", 9).arg("p95", 9)
+                       .arg("p99", 9).arg("max", 9).arg("n", 6);
+    for (int m = 0; m < LATENCY_METRIC_COUNT; ++m) {
+        const LatencyMetric metric = static_cast<LatencyMetric>(m);
+        const LatencySummary summary = monitor.summary(metric);
+        text += QString("%1%2%3%4%5%6\n")
+                    .arg(QString::fromLatin1(PerformanceMonitor::name(metric)), -16)
+                    .arg(summary.p50, 9, 'f', 2)
+                    .arg(summary.p95, 9, 'f', 2)
+                    .arg(summary.p99, 9, 'f', 2)
+                    .arg(summary.max, 9, 'f', 2)
+                    .arg(static_cast<qulonglong>(summary.samples), 6);
+    }
+    text += QString("Fleet size: %1 tracks").arg(static_cast<qulonglong>(tacticalVehicleDb->vehicles().size()));
+    performanceLabel->setText(text);
+}
+
+// Maps wall time since the last tick onto simulated time at the pace of the
+// last tick, capped at one tick so a stalled heartbeat does not extrapolate
+// tracks indefinitely. Paused clocks do not advance.
+double MainWindow::displayTime() const {
+    const double fraction = std::min<double>(tickClock.elapsed(), SIM_TICK_MS) / SIM_TICK_MS;
+    return controller->simulationClock() + fraction * simClock.lastAdvance();
+}
+
+// --- Simulation Clock Controls ---
+void MainWindow::pauseToggled(bool paused) {
+    simClock.setPaused(paused);
+    pauseButton->setText(paused ? "Resume" : "Pause");
+    stepButton->setEnabled(paused);
+    updateClockLabel();
+}
+
+void MainWindow::stepClicked() {
+    simClock.requestSingleStep();
+}
+
+void MainWindow::warpActionClicked(QAction* action) {
+    warpButton->setText(action->text());
+    simClock.setWarp(action->data().toDouble());
+}
+
+// Shows simulated time (T+hh:mm:ss) and the warp actually achieved; the
+// latter turns amber when the clock had to coarsen steps or shed time.
+void MainWindow::updateClockLabel() {
+    const qint64 seconds = static_cast<qint64>(controller->simulationClock());
+    const QString time = QString("T+%1:%2:%3")
+                             .arg(seconds / 3600, 2, 10, QChar('0'))
+                             .arg(seconds / 60 % 60, 2, 10, QChar('0'))
+                             .arg(seconds % 60, 2, 10, QChar('0'));
+
+    if (simClock.isPaused()) {
+        clockLabel->setText(time + "  Paused");
+        clockLabel->setStyleSheet("");
+        return;
+    }
+    clockLabel->setText(time + "  " + QString::number(simClock.achievedWarp(), 'f', 1) + "x achieved");
+    clockLabel->setStyleSheet(simClock.isSaturated() ? "color: #e0a000;" : "");
+}
+
+// Shows the most recent threshold crossings next to the sort bar.
+void MainWindow::showSupplyAlerts(const std::vector<SupplyEvent>& events) {
+    if (events.empty()) return;
+
+    // Newest alerts first; older ones scroll off after a few entries
+    QStringList alerts;
+    for (auto it = events.rbegin(); it != events.rend() && alerts.size() < 3; ++it) {
+        const TacticalVehicle* vehicle = controller->vehicleForSlot(it->slot);
+        if (!vehicle) continue;
+        const QString kind = it->kind == SupplyKind::Fuel ? "fuel" : "ammo";
+        alerts << QString("%1 %2 < %3%").arg(vehicle->callsign, kind, QString::number(it->threshold, 'f', 0));
+    }
+    if (!alerts.isEmpty()) {
+        supplyAlertLabel->setText("Supply: " + alerts.join(", "));
     }
 }
 
 // --- Sorting Logic ---
 // UI-driven handlers for ordering asset views by operational metrics.
 void MainWindow::sortByFuelAsc() {
-    if (resultsList->count() == 0) return;
+    if (resultsModel->rowCount() == 0) return;
 
-    auto& fv = controller->filteredVehicles;
-    auto& av = tacticalVehicleDb->vehiclesMutable();
-
-    if (controller->isFilterActive()) {
-        std::sort(fv.begin(), fv.end(), TacticalVehicleData::sortByFuelAsc);
-    } else {
-        std::sort(av.begin(), av.end(), [](const auto& a, const auto& b) { return TacticalVehicleData::sortByFuelAsc(&a, &b); });
-    }
+    resultsModel->sortRows(TacticalVehicleData::sortByFuelAsc, VehicleChangeSet::Fuel);
     sortButton->setText("Fuel: Critical First");
-    manualUpdateRequested = true;
-    printList();
 }
 
 void MainWindow::sortByFuelDesc() {
-    if (resultsList->count() == 0) return;
-
-    auto& fv = controller->filteredVehicles;
-    auto& av = tacticalVehicleDb->vehiclesMutable();
+    if (resultsModel->rowCount() == 0) return;
 
-    if (controller->isFilterActive()) {
-        std::sort(fv.begin(), fv.end(), TacticalVehicleData::sortByFuelDesc);
-    } else {
-        std::sort(av.begin(), av.end(), [](const auto& a, const auto& b) { return TacticalVehicleData::sortByFuelDesc(&a, &b); });
-    }
+    resultsModel->sortRows(TacticalVehicleData::sortByFuelDesc, VehicleChangeSet::Fuel);
     sortButton->setText("Fuel: Full First");
-    manualUpdateRequested = true;
-    printList();
 }
 
-void MainWindow::sortByPriorityAsc() {
-    if (resultsList->count() == 0) return;
+void MainWindow::sortByInterceptAsc() {
+    if (resultsModel->rowCount() == 0) return;
 
-    auto& fv = controller->filteredVehicles;
-    auto& av = tacticalVehicleDb->vehiclesMutable();
+    resultsModel->sortRows(TacticalVehicleData::sortByTimeToCpaAsc, VehicleChangeSet::Intercept);
+    sortButton->setText("Intercept: Soonest First");
+}
 
-    if (controller->isFilterActive()) {
-        std::sort(fv.begin(), fv.end(), TacticalVehicleData::sortByPriorityAsc);
-    } else {
-        std::sort(av.begin(), av.end(), [](const auto& a, const auto& b) { return TacticalVehicleData::sortByPriorityAsc(&a, &b); });
-    }
+void MainWindow::sortByEtaAsc() {
+    if (resultsModel->rowCount() == 0) return;
+
+    resultsModel->sortRows(TacticalVehicleData::sortByEtaAsc, VehicleChangeSet::Eta);
+    sortButton->setText("ETA to Target: Soonest First");
+}
+
+void MainWindow::sortByPriorityAsc() {
+    if (resultsModel->rowCount() == 0) return;
+
+    resultsModel->sortRows(TacticalVehicleData::sortByPriorityAsc);
     sortButton->setText("Priority (A-Z)");
-    manualUpdateRequested = true;
-    printList();
 }
 
 void MainWindow::sortByPriorityDesc() {
-    if (resultsList->count() == 0) return;
-
-    auto& fv = controller->filteredVehicles;
-    auto& av = tacticalVehicleDb->vehiclesMutable();
+    if (resultsModel->rowCount() == 0) return;
 
-    if (controller->isFilterActive()) {
-        std::sort(fv.begin(), fv.end(), TacticalVehicleData::sortByPriorityDesc);
-    } else {
-        std::sort(av.begin(), av.end(), [](const auto& a, const auto& b) { return TacticalVehicleData::sortByPriorityDesc(&a, &b); });
-    }
+    resultsModel->sortRows(TacticalVehicleData::sortByPriorityDesc);
     sortButton->setText("Priority (Z-A)");
-    manualUpdateRequested = true;
-    printList();
 }
 
 void MainWindow::sortByClassificationAsc() {
-    if (resultsList->count() == 0) return;
-
-    auto& fv = controller->filteredVehicles;
-    auto& av = tacticalVehicleDb->vehiclesMutable();
+    if (resultsModel->rowCount() == 0) return;
 
-    if (controller->isFilterActive()) {
-        std::sort(fv.begin(), fv.end(), TacticalVehicleData::sortByClassificationAsc);
-    } else {
-        std::sort(av.begin(), av.end(), [](const auto& a, const auto& b) { return TacticalVehicleData::sortByClassificationAsc(&a, &b); });
-    }
+    resultsModel->sortRows(TacticalVehicleData::sortByClassificationAsc);
     sortButton->setText("Classification (A-Z)");
-    manualUpdateRequested = true;
-    printList();
 }
 
 void MainWindow::sortByClassificationDesc() {
-    if (resultsList->count() == 0) return;
+    if (resultsModel->rowCount() == 0) return;
 
-    auto& fv = controller->filteredVehicles;
-    auto& av = tacticalVehicleDb->vehiclesMutable();
-
-    if (controller->isFilterActive()) {
-        std::sort(fv.begin(), fv.end(), TacticalVehicleData::sortByClassificationDesc);
-    } else {
-        std::sort(av.begin(), av.end(), [](const auto& a, const auto& b) { return TacticalVehicleData::sortByClassificationDesc(&a, &b); });
-    }
+    resultsModel->sortRows(TacticalVehicleData::sortByClassificationDesc);
     sortButton->setText("Classification (Z-A)");
-    manualUpdateRequested = true;
-    printList();
 }
 
 void MainWindow::sortByDistanceAsc() {
-    if (resultsList->count() == 0) return;
-
-    auto& fv = controller->filteredVehicles;
-    auto& av = tacticalVehicleDb->vehiclesMutable();
+    if (resultsModel->rowCount() == 0) return;
 
-    if (controller->isFilterActive()) {
-        std::sort(fv.begin(), fv.end(), TacticalVehicleData::sortByDistanceAsc);
-    } else {
-        std::sort(av.begin(), av.end(), [](const auto& a, const auto& b) { return TacticalVehicleData::sortByDistanceAsc(&a, &b); });
-    }
+    resultsModel->sortRows(TacticalVehicleData::sortByDistanceAsc, VehicleChangeSet::Distance);
     sortButton->setText("Distance: Closest First");
-    manualUpdateRequested = true;
-    printList();
 }
 
 void MainWindow::sortByDistanceDesc() {
-    if (resultsList->count() == 0) return;
+    if (resultsModel->rowCount() == 0) return;
 
-    auto& fv = controller->filteredVehicles;
-    auto& av = tacticalVehicleDb->vehiclesMutable();
-
-    if (controller->isFilterActive()) {
-        std::sort(fv.begin(), fv.end(), TacticalVehicleData::sortByDistanceDesc);
-    } else {
-        std::sort(av.begin(), av.end(), [](const auto& a, const auto& b) { return TacticalVehicleData::sortByDistanceDesc(&a, &b); });
-    }
+    resultsModel->sortRows(TacticalVehicleData::sortByDistanceDesc, VehicleChangeSet::Distance);
     sortButton->setText("Distance: Farthest First");
-    manualUpdateRequested = true;
-    printList();
 }
 
 // --- Display Logic  ---
@@ -925,72 +1237,42 @@ void MainWindow::sortByDistanceDesc() {
 
 // Displays results and applies default distance-based ordering.
 void MainWindow::displayButtonClicked() {
-    manualUpdateRequested = true;
+    // Shown once the current criteria have been evaluated
+    displayRequested = true;
     filterFunction();
-    printList();
-    sortByDistanceAsc();
-    manualUpdateRequested = false;
+    filterWorker->flush();
 }
 
+// Points the results model at the current view (see resultRows()). Cells
+// are formatted lazily by the model, so this costs one pointer per row and
+// no string work.
 void MainWindow::printList() {
     if (!manualUpdateRequested) return;
+    ScopedLatency latency(LatencyRender);
 
-    resultsList->clear();
-
-    QFont monoFont("Lucida Console", 12);
-    monoFont.setStyleHint(QFont::Monospace);
-    resultsList->setFont(monoFont);
-
-    auto populateRow = [&](const QString& callsign, const QString& type, const QString& trackId,
-                           double fuel, double dist, int prot, const QString& affiliation) {
-
-        QString cSign = callsign.leftJustified(18, ' ');
-        QString vType = type.leftJustified(20, ' ');
-        QString tId   = ("ID: " + trackId).leftJustified(18, ' ');
-        QString dDist = ("Distance to target: " + QString::number(dist, 'f', 0) + " m").leftJustified(32, ' ');
-        QString fFuel = ("Est. fuel level: " + QString::number(fuel, 'f', 1) + " %").leftJustified(24, ' ');
-        QString pProt = ("Protection level: " + QString::number(prot)).leftJustified(22, ' ');
-
-        QString row = QString("%1 | %2 | %3 | %4 | %5 | %6")
-                          .arg(cSign).arg(vType).arg(tId).arg(dDist).arg(fFuel).arg(pProt);
-
-        QListWidgetItem* item = new QListWidgetItem(row, resultsList);
-
-        if (affiliation.contains("Friendly", Qt::CaseInsensitive)) {
-            item->setForeground(QColor(0, 162, 232));
-        } else if (affiliation.contains("Hostile", Qt::CaseInsensitive)) {
-            item->setForeground(Qt::red);
-        } else {
-            item->setForeground(Qt::white);
-        }
-    };
+    resultsModel->setRows(resultRows(), controller->filterRevision());
+}
 
+// The filtered vehicles, or the whole dataset when no filter narrows it.
+std::vector<const TacticalVehicle*> MainWindow::resultRows() const {
     if (controller->isFilterActive()) {
-        for (const auto* vehicle : controller->filteredVehicles) {
-            populateRow(vehicle->callsign,
-                        vehicle->type,
-                        vehicle->trackId,
-                        vehicle->fuelLevel,
-                        vehicle->distanceToTarget,
-                        vehicle->protectionLevel,
-                        vehicle->affiliation);
-        }
-    } else {
-        for (const auto& vehicle : tacticalVehicleDb->vehicles()) {
-            populateRow(vehicle.callsign,
-                        vehicle.type,
-                        vehicle.trackId,
-                        vehicle.fuelLevel,
-                        vehicle.distanceToTarget,
-                        vehicle.protectionLevel,
-                        vehicle.affiliation);
-        }
+        return controller->filteredVehicles;
     }
+    std::vector<const TacticalVehicle*> rows;
+    const auto& vehicles = tacticalVehicleDb->vehicles();
+    rows.reserve(vehicles.size());
+    for (const auto& vehicle : vehicles) {
+        rows.push_back(&vehicle);
+    }
+    return rows;
 }
 
 // --- Dialog Logic  ---
 // Slot responsible for entity dialog.
-void MainWindow::listItemDoubleclicked(QListWidgetItem *item) {
+void MainWindow::resultDoubleClicked(const QModelIndex &index) {
+    const TacticalVehicle *selected = resultsModel->vehicleAt(index.row());
+    if (!selected) return;
+
     entityDialog = new QDialog(this);
     entityDialog->setAttribute(Qt::WA_DeleteOnClose);
     entityDialog->show();
@@ -999,7 +1281,7 @@ void MainWindow::listItemDoubleclicked(QListWidgetItem *item) {
     entityDialog->setSizeGripEnabled(true);
     entityDialog->setBaseSize(375, 375);
 
-    QString extractedCallsign = item->text().split('|').first().trimmed();
+    const QString extractedCallsign = selected->callsign;
 
     QHBoxLayout *entityTopPanel = new QHBoxLayout();
     QLabel *entityLiveUpdatesLabel = new QLabel("Live Updates");
@@ -1020,99 +1302,120 @@ void MainWindow::listItemDoubleclicked(QListWidgetItem *item) {
     entityFont.setStyleHint(QFont::Monospace);
     entityList->setFont(entityFont);
 
-    QListWidgetItem *distanceItem = new QListWidgetItem;
-    QListWidgetItem *speedItem = new QListWidgetItem;
-    QListWidgetItem *headingItem = new QListWidgetItem;
-    for (const auto& vehicle : tacticalVehicleDb->vehicles()) {
-        if (vehicle.callsign == extractedCallsign) {
-            QString dCall =  ("Callsign:           " + extractedCallsign);
-            QString dTrack = ("Track ID:           " + vehicle.trackId);
-            QString dPrio =  ("Strategic Priority: " + vehicle.priority);
-            QString dDom =   ("Domain:             " + vehicle.domain);
-            QString dClas =  ("Classification:     " + vehicle.classification);
-            QString dTyp =   ("Type:               " + vehicle.type);
-            QString dDist =  ("Distance to target: " + QString::number(vehicle.distanceToTarget, 'f', 0) + " m");
-            QString dSpe =   ("Speed:              " + QString::number(vehicle.speed, 'f', 0) + " km/h");
-            QString dHea =   ("Heading:            " + QString::number(vehicle.heading, 'f', 0) + "°");
-            QString dFue =   ("Est. fuel level:    " + QString::number(vehicle.fuelLevel, 'f', 1) + " %");
-            QString dAmm =   ("Est. amm. level:    " + QString::number(vehicle.ammunitionLevel, 'f', 1) + " %");
-            QString dUnm;
-            if (vehicle.isUnmanned) {
-                dUnm = "Yes";
-            }
-            else {
-                dUnm = "No";
-            }
-            dUnm =           ("Unmanned:           " + dUnm);
-            QString dSat;
-            if (vehicle.hasSatCom) {
-                dSat = "Yes";
-            }
-            else {
-                dSat = "No";
-            }
-            dSat =           ("Has SatCom:         " + dSat);
-            QString dAct;
-            if (vehicle.hasActiveDefense) {
-                dAct = "Yes";
-            }
-            else {
-                dAct = "No";
-            }
-            dAct =           ("Has Active Defence: " + dAct);
-            QString dAmp;
-            if (vehicle.isAmphibious) {
-                dAmp = "Yes";
-            }
-            else {
-                dAmp = "No";
-            }
-
-            dAmp =           ("Is Amphibious:      " + dAmp);
-            QString dProt =  ("Protection Level:   " + QString::number(vehicle.protectionLevel, 'f', 0));
-            QString dMSpe =  ("Maximum Speed:      " + QString::number(vehicle.maxSpeed, 'f', 0) + " km/h");
-            QString dProp =  ("Propulsion:         " + vehicle.propulsion);
-            new QListWidgetItem(dCall, entityList);
-            new QListWidgetItem(dTrack, entityList);
-            new QListWidgetItem(dPrio, entityList);
-            new QListWidgetItem(dClas, entityList);
-            new QListWidgetItem(dDom, entityList);
-            new QListWidgetItem(dTyp, entityList);
-            distanceItem->setText(dDist);
-            entityList->insertItem(7, distanceItem);
-            speedItem->setText(dSpe);
-            entityList->insertItem(8, speedItem);
-            headingItem->setText(dHea);
-            entityList->insertItem(9, headingItem);
-            new QListWidgetItem(dFue, entityList);
-            new QListWidgetItem(dAmm, entityList);
-            new QListWidgetItem(dUnm, entityList);
-            new QListWidgetItem(dSat, entityList);
-            new QListWidgetItem(dAct, entityList);
-            new QListWidgetItem(dAmp, entityList);
-            new QListWidgetItem(dProt, entityList);
-            new QListWidgetItem(dMSpe, entityList);
-            new QListWidgetItem(dProp, entityList);
-
-            if (vehicle.affiliation.contains("Friendly", Qt::CaseInsensitive)) {
-                entityList->setStyleSheet("QListWidget { color: rgb(0, 162, 232); }");
-            } else if (vehicle.affiliation.contains("Hostile", Qt::CaseInsensitive)) {
-                entityList->setStyleSheet("QListWidget { color: red; }");
-            } else {
-                entityList->setStyleSheet("QListWidget { color: white; }");
-            }
+    const TacticalVehicle& vehicle = *selected;
+    QString dCall =  ("Callsign:           " + extractedCallsign);
+    QString dTrack = ("Track ID:           " + vehicle.trackId);
+    QString dPrio =  ("Strategic Priority: " + vehicle.priority);
+    QString dDom =   ("Domain:             " + vehicle.domain);
+    QString dClas =  ("Classification:     " + vehicle.classification);
+    QString dTyp =   ("Type:               " + vehicle.type);
+    QString dUnm;
+    if (vehicle.isUnmanned) {
+        dUnm = "Yes";
+    }
+    else {
+        dUnm = "No";
+    }
+    dUnm =           ("Unmanned:           " + dUnm);
+    QString dSat;
+    if (vehicle.hasSatCom) {
+        dSat = "Yes";
+    }
+    else {
+        dSat = "No";
+    }
+    dSat =           ("Has SatCom:         " + dSat);
+    QString dAct;
+    if (vehicle.hasActiveDefense) {
+        dAct = "Yes";
+    }
+    else {
+        dAct = "No";
+    }
+    dAct =           ("Has Active Defence: " + dAct);
+    QString dAmp;
+    if (vehicle.isAmphibious) {
+        dAmp = "Yes";
+    }
+    else {
+        dAmp = "No";
+    }
+
+    dAmp =           ("Is Amphibious:      " + dAmp);
+    QString dProt =  ("Protection Level:   " + QString::number(vehicle.protectionLevel, 'f', 0));
+    QString dMSpe =  ("Maximum Speed:      " + QString::number(vehicle.maxSpeed, 'f', 0) + " km/h");
+    QString dProp =  ("Propulsion:         " + vehicle.propulsion);
+    new QListWidgetItem(dCall, entityList);
+    new QListWidgetItem(dTrack, entityList);
+    new QListWidgetItem(dPrio, entityList);
+    new QListWidgetItem(dClas, entityList);
+    new QListWidgetItem(dDom, entityList);
+    new QListWidgetItem(dTyp, entityList);
+
+    // Telemetry rows are filled by the track update bus (see below)
+    QListWidgetItem *distanceItem = new QListWidgetItem(entityList);
+    QListWidgetItem *speedItem = new QListWidgetItem(entityList);
+    QListWidgetItem *headingItem = new QListWidgetItem(entityList);
+    QListWidgetItem *fuelItem = new QListWidgetItem(entityList);
+    QListWidgetItem *ammunitionItem = new QListWidgetItem(entityList);
+    new QListWidgetItem(dUnm, entityList);
+    new QListWidgetItem(dSat, entityList);
+    new QListWidgetItem(dAct, entityList);
+    new QListWidgetItem(dAmp, entityList);
+    new QListWidgetItem(dProt, entityList);
+    new QListWidgetItem(dMSpe, entityList);
+    new QListWidgetItem(dProp, entityList);
+
+    if (vehicle.affiliation.contains("Friendly", Qt::CaseInsensitive)) {
+        entityList->setStyleSheet("QListWidget { color: rgb(0, 162, 232); }");
+    } else if (vehicle.affiliation.contains("Hostile", Qt::CaseInsensitive)) {
+        entityList->setStyleSheet("QListWidget { color: red; }");
+    } else {
+        entityList->setStyleSheet("QListWidget { color: white; }");
+    }
 
+    // Only the rows whose fields changed are re-formatted
+    auto showUpdate = [=](const TrackUpdate& update) {
+        // The track is not in the reloaded dataset: the subscription has
+        // ended and the dialog's record is stale, so live updates stay off
+        if (!update.vehicle) {
+            entityLiveUpdatesBox->setChecked(false);
+            entityLiveUpdatesBox->setEnabled(false);
+            entityLiveUpdatesLabel->setText("Live Updates (track removed)");
+            return;
         }
-    }
-    connect(simTimer, &QTimer::timeout, entityDialog, [=]() {
-        if (!entityDialog || !entityDialog->isVisible()) return;
-
-        for (const auto &vehicleUpdate : tacticalVehicleDb->vehicles()) {
-            if (vehicleUpdate.callsign == extractedCallsign && entityLiveUpdatesBox->isChecked()) {
-                distanceItem->setText("Distance to target: " +QString::number(vehicleUpdate.distanceToTarget, 'f', 0) + " m");
-                speedItem->setText   ("Speed:              " + QString::number(vehicleUpdate.speed, 'f', 0) + " km/h");
-                headingItem->setText ("Heading:            " + QString::number(vehicleUpdate.heading, 'f', 0) + "°");
-            }
+        if (update.changed & VehicleChangeSet::Distance) {
+            distanceItem->setText("Distance to target: " + QString::number(update.state.distanceToTarget, 'f', 0) + " m");
+        }
+        if (update.changed & VehicleChangeSet::Speed) {
+            speedItem->setText   ("Speed:              " + QString::number(update.state.speed, 'f', 0) + " km/h");
+        }
+        if (update.changed & VehicleChangeSet::Heading) {
+            headingItem->setText ("Heading:            " + QString::number(update.state.heading, 'f', 0) + "°");
+        }
+        if (update.changed & VehicleChangeSet::Fuel) {
+            fuelItem->setText    ("Est. fuel level:    " + QString::number(update.vehicle->fuelLevel, 'f', 1) + " %");
+        }
+        if (update.changed & VehicleChangeSet::Ammunition) {
+            ammunitionItem->setText("Est. amm. level:    " + QString::number(update.vehicle->ammunitionLevel, 'f', 1) + " %");
+        }
+    };
+    TrackUpdate initial;
+    initial.vehicle = &vehicle;
+    initial.state.distanceToTarget = vehicle.distanceToTarget;
+    initial.state.speed = vehicle.speed;
+    initial.state.heading = vehicle.heading;
+    initial.changed = VehicleChangeSet::AllFields;
+    showUpdate(initial);
+
+    // Live updates subscribe the dialog to its track; closing the dialog
+    // (WA_DeleteOnClose) ends the subscription
+    QDialog *dialog = entityDialog;
+    connect(entityLiveUpdatesBox, &QCheckBox::toggled, dialog, [=](bool live) {
+        if (live) {
+            trackBus->subscribe(dialog, *selected, showUpdate);
+        } else {
+            trackBus->unsubscribe(dialog);
         }
     });
 }
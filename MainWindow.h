@@ -1,8 +1,10 @@
 #ifndef MAINWINDOW_H
 #define MAINWINDOW_H
 
+#include "SimulationClock.h"
 #include "TacticalVehicleController.h"
 
+#include <QElapsedTimer>
 #include <QWidget>
 
 // Forward declarations (compile-time optimization)
@@ -11,15 +13,22 @@ class QCheckBox;
 class QCompleter;
 class QLabel;
 class QLineEdit;
-class QListWidget;
 class QMenu;
+class QModelIndex;
+class QProgressBar;
 class QPushButton;
+class QStringListModel;
 class QTimer;
 class QDialog;
-class QListWidgetItem;
+class QTableView;
 
 class RangeSlider;
+class DatasetLoader;
+class FilterWorker;
+class TacticalMapView;
 class TacticalVehicleData;
+class TrackUpdateBus;
+class VehicleTableModel;
 
 /**
  * @class MainWindow
@@ -39,9 +48,16 @@ private slots:
     // --- Core Logic ---
     void displayButtonClicked();                       ///< Explicit trigger to refresh displayed results
     void filterFunction();                             ///< Resolves UI state into filter criteria
+    void filterResultsReady(const FilterCriteria& criteria,
+                            const std::vector<const TacticalVehicle*>& result); ///< Installs a background filter result
     void filtersCleared();
-    void printList();                                  ///< Populates resultsList from current data view
-    void listItemDoubleclicked(QListWidgetItem *item); ///< Shows dialog with entity info when QListWidget item clicked.
+    void printList();                                  ///< Points the results table at the current data view
+    void resultDoubleClicked(const QModelIndex &index); ///< Shows dialog with entity info for a results row
+
+    // --- Background Dataset Load ---
+    void datasetChunksReady();                         ///< Appends loaded records and refreshes the views
+    void datasetProgress(int loaded, int total);
+    void datasetFinished(bool ok, int total);
 
     // --- Identity & Search Management ---
     void callsignChanged(const QString& text);
@@ -54,6 +70,7 @@ private slots:
 
     // --- Strategic Classification Menus ---
     void affiliationActionClicked(QAction* action);
+    void proximityActionClicked(QAction* action);
 
     void domainActionClicked(QAction* action);
     void domainSelectionPressed();
@@ -88,21 +105,44 @@ private slots:
     void sortByFuelAsc();
     void sortByFuelDesc();
 
+    void sortByInterceptAsc();
+    void sortByEtaAsc();
+
     void sortByPriorityAsc();
     void sortByPriorityDesc();
 
     // --- Simulation & Background Tasks ---
     void onSimulationTick();        ///< Periodic update for dynamic asset data
+    void pauseToggled(bool paused);
+    void stepClicked();             ///< Advances one step while paused
+    void warpActionClicked(QAction* action);
+
+    // --- Instrumentation ---
+    void performanceToggled(bool enabled); ///< Shows the performance panel and starts recording
+    void samplePerformance();              ///< Probes event-loop lag, refreshes the panel
 
 private:
+    // --- Presentation Helpers ---
+    void updateResultCount();                                    ///< Refreshes the DISPLAY RESULTS counter
+    std::vector<const TacticalVehicle*> resultRows() const;      ///< Rows the results table should show
+    void showSupplyAlerts(const std::vector<SupplyEvent>& events); ///< Surfaces low fuel / ammunition alerts
+    double displayTime() const;                                  ///< Simulated time to extrapolate views to
+    void updateClockLabel();                                     ///< Simulated time and achieved warp
+    void appendCompletions(QStringListModel *model, const QStringList& terms); ///< Grows a completer model
+
     // --- Backend Data & Controllers ---
     std::unique_ptr<TacticalVehicleData> tacticalVehicleDb;
     std::unique_ptr<TacticalVehicleController> controller;
+    std::unique_ptr<FilterWorker> filterWorker; ///< Declared after controller: stops before it is destroyed
+    std::unique_ptr<DatasetLoader> datasetLoader; ///< Cancelled on destruction; holds no references to the dataset
 
     QStringList trackIdList;
     QStringList callsignList;
 
     bool manualUpdateRequested = false; ///< Guards explicit list rendering phases
+    bool displayRequested = false;      ///< Show results once the pending filter result arrives
+    bool datasetGrew = false;           ///< A chunk arrived since the last filter result
+    int simulationTicks = 0;            ///< Base ticks since start; paces full list refreshes
 
     // --- Capability Flags ---
     QCheckBox *cbHasActiveDefense;
@@ -113,9 +153,11 @@ private:
     // --- Search & Auto-complete ---
     QLineEdit *callsignLine;
     QCompleter *callsignCompleter;
+    QStringListModel *callsignModel;
 
     QLineEdit *trackIdLine;
     QCompleter *trackIdCompleter;
+    QStringListModel *trackIdModel;
 
     // --- Navigation & Menu Structures ---
     QPushButton *domainButton;
@@ -134,8 +176,18 @@ private:
 
     QPushButton *affiliationButton;
     QMenu *affiliationMenu;
+    QPushButton *proximityButton;
+    QMenu *proximityMenu;
     QMenu *sortMenu;
 
+    // --- Simulation Clock Controls ---
+    QPushButton *pauseButton;
+    QPushButton *stepButton;
+    QPushButton *warpButton;
+    QMenu *warpMenu;
+    QLabel *clockLabel;
+    QProgressBar *loadProgress;  ///< Background dataset load (hidden when done)
+
     // --- Telemetry & Target Inputs ---
     RangeSlider *distanceSlider;
     QLineEdit *distanceInputMax;
@@ -153,6 +205,7 @@ private:
     QPushButton *sortButton;
     QPushButton *clearButton;
     QCheckBox *liveUpdatesBox;
+    QCheckBox *performanceBox;
 
     QIcon choiceDeletion;
 
@@ -167,13 +220,25 @@ private:
 
     // --- Information Display ---
     QLabel *labelLogo;
-    QListWidget *resultsList;
+    QLabel *supplyAlertLabel;
+    QTableView *resultsTable;
+    VehicleTableModel *resultsModel;   ///< Virtualized rows over the current view
+    TacticalMapView *mapView;          ///< Plan view of all tracks
+    QLabel *performanceLabel;          ///< Rolling latency percentiles (optional panel)
 
     // --- Dialogs ---
     QDialog *entityDialog;
+    TrackUpdateBus *trackBus;    ///< Per-track live updates for entity dialogs
 
     // --- Timing & Helpers ---
     QTimer *simTimer;
+    QTimer *displayTimer;       ///< Display-rate refresh of extrapolated views
+    QElapsedTimer tickClock;    ///< Wall time since the last simulation tick
+    SimulationClock simClock;   ///< Warp, pause and sub-stepping of the heartbeat
+    VehicleChangeSet tableChanges; ///< Changes since the last result table refresh
+    QTimer *performanceTimer;          ///< Event-loop lag probe while the performance panel is shown
+    QElapsedTimer performanceClock;    ///< Wall time since the last lag probe
+    int performanceSamples = 0;
 };
 
 #endif // MAINWINDOW_H
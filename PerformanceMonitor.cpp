@@ -0,0 +1,76 @@
+#include "PerformanceMonitor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// --- PerformanceMonitor Implementation ---
+// Ring buffers per metric; percentiles by selection on a copy, so readers
+// never reorder the window writers append to.
+
+PerformanceMonitor& PerformanceMonitor::shared() {
+    static PerformanceMonitor instance;
+    return instance;
+}
+
+void PerformanceMonitor::record(LatencyMetric metric, double milliseconds) {
+    if (metric >= LATENCY_METRIC_COUNT || !isEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Window& window = m_windows[metric];
+    window.samples[window.next] = milliseconds;
+    window.next = (window.next + 1) % WINDOW;
+    window.count = std::min(window.count + 1, WINDOW);
+}
+
+/**
+ * @brief Nearest-rank percentiles over the samples currently in the window.
+ */
+LatencySummary PerformanceMonitor::summary(LatencyMetric metric) const {
+    LatencySummary result;
+    if (metric >= LATENCY_METRIC_COUNT) {
+        return result;
+    }
+
+    std::vector<double> samples;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const Window& window = m_windows[metric];
+        samples.assign(window.samples.begin(), window.samples.begin() + window.count);
+    }
+    if (samples.empty()) {
+        return result;
+    }
+
+    auto percentile = [&samples](double fraction) {
+        const std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * samples.size()));
+        const std::size_t index = std::min(samples.size() - 1, rank > 0 ? rank - 1 : 0);
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index];
+    };
+
+    result.samples = samples.size();
+    result.p50 = percentile(0.50);
+    result.p95 = percentile(0.95);
+    result.p99 = percentile(0.99);
+    result.max = *std::max_element(samples.begin(), samples.end());
+    return result;
+}
+
+void PerformanceMonitor::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_windows = {};
+}
+
+const char* PerformanceMonitor::name(LatencyMetric metric) {
+    switch (metric) {
+    case LatencyTick:      return "Tick";
+    case LatencyPublish:   return "Publish";
+    case LatencyFilter:    return "Filter";
+    case LatencySort:      return "Sort";
+    case LatencyRender:    return "Render";
+    case LatencyEventLoop: return "Event loop lag";
+    default:               return "";
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef PERFORMANCEMONITOR_H
+#define PERFORMANCEMONITOR_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @enum LatencyMetric
+ * @brief Operations whose latency is sampled by the PerformanceMonitor.
+ */
+enum LatencyMetric : std::uint8_t {
+    LatencyTick,      ///< Simulation steps (TacticalVehicleController::advanceSteps)
+    LatencyPublish,   ///< Derived passes plus record writes (TacticalVehicleController::publish)
+    LatencyFilter,    ///< One completed filter evaluation
+    LatencySort,      ///< Sorting the results view
+    LatencyRender,    ///< Results table refresh and map frames
+    LatencyEventLoop, ///< Lateness of a periodic GUI timer
+    LATENCY_METRIC_COUNT
+};
+
+/**
+ * @struct LatencySummary
+ * @brief Percentiles over the rolling window of one metric (milliseconds).
+ */
+struct LatencySummary {
+    std::size_t samples = 0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+};
+
+/**
+ * @class PerformanceMonitor
+ * @brief Rolling latency windows for the instrumentation overlay.
+ *
+ * Each metric keeps its last WINDOW samples in a ring buffer; percentiles
+ * are computed only when summary() is called. Recording is off by default:
+ * a disabled ScopedLatency costs one relaxed atomic load and takes no
+ * timestamps, so the timers can stay in hot paths.
+ *
+ * Thread-safe, since filters are evaluated on a worker thread. One
+ * process-wide instance (shared()) is fed by the controller, the table
+ * model and the views.
+ */
+class PerformanceMonitor {
+public:
+    static constexpr std::size_t WINDOW = 256;
+
+    static PerformanceMonitor& shared();
+
+    void setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    void record(LatencyMetric metric, double milliseconds);
+    LatencySummary summary(LatencyMetric metric) const;
+    void reset();
+
+    static const char* name(LatencyMetric metric);
+
+private:
+    struct Window {
+        std::array<double, WINDOW> samples{};
+        std::size_t next = 0;
+        std::size_t count = 0;
+    };
+
+    mutable std::mutex m_mutex;
+    std::array<Window, LATENCY_METRIC_COUNT> m_windows;
+    std::atomic<bool> m_enabled{false};
+};
+
+/**
+ * @class ScopedLatency
+ * @brief Records the lifetime of a scope into the shared monitor, unless
+ *        discarded (e.g. a cancelled evaluation).
+ */
+class ScopedLatency {
+public:
+    explicit ScopedLatency(LatencyMetric metric)
+        : m_metric(metric), m_active(PerformanceMonitor::shared().isEnabled()) {
+        if (m_active) {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedLatency() {
+        if (m_active) {
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_start;
+            PerformanceMonitor::shared().record(m_metric, elapsed.count());
+        }
+    }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+    void discard() { m_active = false; }
+
+private:
+    LatencyMetric m_metric;
+    bool m_active;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif // PERFORMANCEMONITOR_H
@@ -0,0 +1,187 @@
+#include "ProximityGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+// --- ProximityGrid Implementation ---
+// Broad-phase pair search over a hashed uniform grid. Qt-free so it can run
+// on worker threads next to the kinematics kernels.
+
+// --- Hashing ---
+std::size_t ProximityGrid::bucketOf(std::int64_t cellX, std::int64_t cellY) const {
+    // Large odd multipliers spread neighbouring cells across the table
+    const std::uint64_t h = static_cast<std::uint64_t>(cellX) * 0x9E3779B97F4A7C15ULL ^
+                            static_cast<std::uint64_t>(cellY) * 0xC2B2AE3D27D4EB4FULL;
+    return static_cast<std::size_t>(h ^ (h >> 29)) & m_bucketMask;
+}
+
+// --- Construction ---
+/**
+ * @brief Counting sort of all slots by hashed cell.
+ *
+ * The table has at least twice as many buckets as slots (power of two), so
+ * the expected bucket occupancy stays below one for sparse fleets.
+ */
+void ProximityGrid::build(const double* posX, const double* posY, std::size_t count, double cellSize) {
+    m_cellSize = cellSize;
+    const double inverse = 1.0 / cellSize;
+
+    std::size_t buckets = 16;
+    while (buckets < count * 2) {
+        buckets <<= 1;
+    }
+    m_bucketMask = buckets - 1;
+
+    m_cellX.resize(count);
+    m_cellY.resize(count);
+    m_valid.resize(count);
+    m_bucketStart.assign(buckets + 1, 0);
+
+    std::vector<std::uint32_t> slotBucket(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const double x = posX[i];
+        const double y = posY[i];
+        m_valid[i] = std::isfinite(x) && std::isfinite(y);
+        if (!m_valid[i]) {
+            continue;
+        }
+        m_cellX[i] = static_cast<std::int64_t>(std::floor(x * inverse));
+        m_cellY[i] = static_cast<std::int64_t>(std::floor(y * inverse));
+        slotBucket[i] = static_cast<std::uint32_t>(bucketOf(m_cellX[i], m_cellY[i]));
+        ++m_bucketStart[slotBucket[i] + 1];
+    }
+
+    for (std::size_t b = 0; b < buckets; ++b) {
+        m_bucketStart[b + 1] += m_bucketStart[b];
+    }
+
+    // Scatter in slot order, so each bucket lists its slots ascending
+    m_sortedSlots.resize(m_bucketStart[buckets]);
+    std::vector<std::uint32_t> cursor(m_bucketStart.begin(), m_bucketStart.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (m_valid[i]) {
+            m_sortedSlots[cursor[slotBucket[i]]++] = static_cast<std::uint32_t>(i);
+        }
+    }
+}
+
+// --- Query ---
+/**
+ * @brief Buckets of the 3x3 cell neighbourhood of a slot; neighbouring cells
+ *        may share a bucket, so each is listed once.
+ */
+std::size_t ProximityGrid::neighbourBuckets(std::size_t slot, std::size_t (&buckets)[9]) const {
+    std::size_t count = 0;
+    for (std::int64_t dy = -1; dy <= 1; ++dy) {
+        for (std::int64_t dx = -1; dx <= 1; ++dx) {
+            const std::size_t bucket = bucketOf(m_cellX[slot] + dx, m_cellY[slot] + dy);
+            bool seen = false;
+            for (std::size_t v = 0; v < count; ++v) {
+                seen = seen || buckets[v] == bucket;
+            }
+            if (!seen) {
+                buckets[count++] = bucket;
+            }
+        }
+    }
+    return count;
+}
+
+void ProximityGrid::findPairs(const double* posX, const double* posY,
+                              const std::uint8_t* group, const std::uint8_t* interacts, double radius,
+                              std::size_t begin, std::size_t end, std::vector<ProximityPair>& pairs) const {
+    const double radiusSquared = radius * radius;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::uint8_t partners = interacts[group[i]];
+        if (!m_valid[i] || partners == 0) {
+            continue;
+        }
+
+        std::size_t visited[9];
+        const std::size_t visitedCount = neighbourBuckets(i, visited);
+
+        const double x = posX[i];
+        const double y = posY[i];
+        for (std::size_t v = 0; v < visitedCount; ++v) {
+            for (std::uint32_t k = m_bucketStart[visited[v]]; k < m_bucketStart[visited[v] + 1]; ++k) {
+                const std::uint32_t j = m_sortedSlots[k];
+
+                // Each pair is reported once, from its lower slot
+                if (j <= i || !(partners & (1u << group[j]))) {
+                    continue;
+                }
+                const double ddx = posX[j] - x;
+                const double ddy = posY[j] - y;
+                const double distanceSquared = ddx * ddx + ddy * ddy;
+                if (distanceSquared <= radiusSquared) {
+                    ProximityPair pair;
+                    pair.first = static_cast<std::uint32_t>(i);
+                    pair.second = j;
+                    pair.distance = std::sqrt(distanceSquared);
+                    pairs.push_back(pair);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Closest approach of each candidate pair over the move.
+ *
+ * With relative offsets r0 before and r1 after the move, the offset is
+ * r0 + t (r1 - r0) for t in [0, 1]; its minimum is at the clamped
+ * projection of the origin onto that segment. Slots without a finite start
+ * position are treated as standing at their end position.
+ */
+void ProximityGrid::findSweptPairs(const double* fromX, const double* fromY, const double* toX, const double* toY,
+                                   const std::uint8_t* group, const std::uint8_t* interacts, double radius,
+                                   std::size_t begin, std::size_t end, std::vector<ProximityPair>& pairs) const {
+    const double radiusSquared = radius * radius;
+    auto startX = [fromX, fromY, toX](std::uint32_t s) {
+        return std::isfinite(fromX[s]) && std::isfinite(fromY[s]) ? fromX[s] : toX[s];
+    };
+    auto startY = [fromX, fromY, toY](std::uint32_t s) {
+        return std::isfinite(fromX[s]) && std::isfinite(fromY[s]) ? fromY[s] : toY[s];
+    };
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::uint8_t partners = interacts[group[i]];
+        if (!m_valid[i] || partners == 0) {
+            continue;
+        }
+
+        std::size_t visited[9];
+        const std::size_t visitedCount = neighbourBuckets(i, visited);
+
+        const auto self = static_cast<std::uint32_t>(i);
+        const double x0 = startX(self);
+        const double y0 = startY(self);
+        for (std::size_t v = 0; v < visitedCount; ++v) {
+            for (std::uint32_t k = m_bucketStart[visited[v]]; k < m_bucketStart[visited[v] + 1]; ++k) {
+                const std::uint32_t j = m_sortedSlots[k];
+                if (j <= i || !(partners & (1u << group[j]))) {
+                    continue;
+                }
+                const double r0x = startX(j) - x0;
+                const double r0y = startY(j) - y0;
+                const double dx = (toX[j] - toX[i]) - r0x;
+                const double dy = (toY[j] - toY[i]) - r0y;
+                const double lengthSquared = dx * dx + dy * dy;
+                const double t = lengthSquared > 0.0
+                    ? std::clamp(-(r0x * dx + r0y * dy) / lengthSquared, 0.0, 1.0)
+                    : 0.0;
+                const double cx = r0x + t * dx;
+                const double cy = r0y + t * dy;
+                const double distanceSquared = cx * cx + cy * cy;
+                if (distanceSquared <= radiusSquared) {
+                    ProximityPair pair;
+                    pair.first = self;
+                    pair.second = j;
+                    pair.distance = std::sqrt(distanceSquared);
+                    pairs.push_back(pair);
+                }
+            }
+        }
+    }
+}
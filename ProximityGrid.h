@@ -0,0 +1,137 @@
+#ifndef PROXIMITYGRID_H
+#define PROXIMITYGRID_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum ProximityClass
+ * @brief Affiliation class used by the proximity broad phase.
+ *
+ * Mask bits in TacticalVehicle::proximityMask are (1 << ProximityClass).
+ */
+enum ProximityClass : std::uint8_t {
+    ProximityOther = 0,
+    ProximityFriendly = 1,
+    ProximityHostile = 2
+};
+
+/**
+ * @struct ProximityPair
+ * @brief Two simulation slots (first < second) closer than the proximity radius.
+ */
+struct ProximityPair {
+    std::uint32_t first = 0;
+    std::uint32_t second = 0;
+    double distance = 0.0; ///< Meters
+};
+
+/**
+ * @class ProximityGrid
+ * @brief Spatial hash broad phase for "every pair within r meters" queries.
+ *
+ * Positions are binned into square cells of the query radius and the slots
+ * are counting-sorted by hashed cell, so each bucket is a contiguous run of
+ * slot indices. A query then only visits the 3x3 cell neighbourhood of each
+ * slot, which keeps the pass roughly linear in the fleet size as long as
+ * tracks are not packed far denser than the radius.
+ *
+ * Hash collisions only add candidates; every candidate is confirmed by an
+ * exact distance test.
+ */
+class ProximityGrid {
+public:
+    /// Rebuilds the hash for count positions; cellSize must be > 0.
+    void build(const double* posX, const double* posY, std::size_t count, double cellSize);
+
+    /**
+     * @brief Appends every pair within radius whose groups interact, for
+     *        first slots in [begin, end).
+     *
+     * A pair (i, j) is considered when interacts[group[i]] has bit
+     * (1 << group[j]) set; the interaction table must be symmetric. radius
+     * must not exceed the cell size the grid was built with. Pairs are
+     * appended in ascending first-slot order.
+     */
+    void findPairs(const double* posX, const double* posY,
+                   const std::uint8_t* group, const std::uint8_t* interacts, double radius,
+                   std::size_t begin, std::size_t end, std::vector<ProximityPair>& pairs) const;
+
+    /**
+     * @brief Like findPairs(), for tracks moving in a straight line from
+     *        (fromX, fromY) to the positions the grid was built with.
+     *
+     * A pair is reported when its closest approach during the move is
+     * within radius, with that distance. The cell size must be at least
+     * radius plus twice the longest move.
+     */
+    void findSweptPairs(const double* fromX, const double* fromY, const double* toX, const double* toY,
+                        const std::uint8_t* group, const std::uint8_t* interacts, double radius,
+                        std::size_t begin, std::size_t end, std::vector<ProximityPair>& pairs) const;
+
+    /**
+     * @brief Calls visit(j) once for every slot j (including slot itself)
+     *        whose cell is within range of slot's cell along both axes, a
+     *        superset of the slots within range.
+     *
+     * Ranges spanning more cells than the table has buckets visit every
+     * slot in the grid instead.
+     */
+    template <typename Visit>
+    void forEachNear(std::size_t slot, double range, Visit visit) const;
+
+    double cellSize() const { return m_cellSize; }
+
+private:
+    std::size_t bucketOf(std::int64_t cellX, std::int64_t cellY) const;
+    std::size_t neighbourBuckets(std::size_t slot, std::size_t (&buckets)[9]) const;
+
+    double m_cellSize = 1.0;
+    std::size_t m_bucketMask = 0;
+    std::vector<std::uint32_t> m_bucketStart;  ///< Prefix offsets into m_sortedSlots (bucket count + 1)
+    std::vector<std::uint32_t> m_sortedSlots;  ///< Slot indices grouped by bucket
+    std::vector<std::int64_t> m_cellX;         ///< Per-slot cell coordinates
+    std::vector<std::int64_t> m_cellY;
+    std::vector<std::uint8_t> m_valid;         ///< 0 for slots with non-finite positions
+};
+
+template <typename Visit>
+void ProximityGrid::forEachNear(std::size_t slot, double range, Visit visit) const {
+    if (!m_valid[slot]) {
+        return;
+    }
+    const std::int64_t cellX = m_cellX[slot];
+    const std::int64_t cellY = m_cellY[slot];
+    const double cells = std::ceil(range / m_cellSize);
+    const double side = 2.0 * cells + 1.0;
+
+    if (!(side * side < static_cast<double>(m_bucketMask + 1))) {
+        const double limit = cells;
+        for (const std::uint32_t j : m_sortedSlots) {
+            if (std::fabs(static_cast<double>(m_cellX[j] - cellX)) <= limit &&
+                std::fabs(static_cast<double>(m_cellY[j] - cellY)) <= limit) {
+                visit(j);
+            }
+        }
+        return;
+    }
+
+    // A bucket may hold several cells; a slot is only taken from its own
+    // cell, so colliding cells never report it twice
+    const auto reach = static_cast<std::int64_t>(cells);
+    for (std::int64_t y = cellY - reach; y <= cellY + reach; ++y) {
+        for (std::int64_t x = cellX - reach; x <= cellX + reach; ++x) {
+            const std::size_t bucket = bucketOf(x, y);
+            for (std::uint32_t k = m_bucketStart[bucket]; k < m_bucketStart[bucket + 1]; ++k) {
+                const std::uint32_t j = m_sortedSlots[k];
+                if (m_cellX[j] == x && m_cellY[j] == y) {
+                    visit(j);
+                }
+            }
+        }
+    }
+}
+
+#endif // PROXIMITYGRID_H
@@ -3,6 +3,8 @@
 #include <QPainter>
 #include <QMouseEvent>
 
+#include <algorithm>
+
 // --- Rendering & Interaction ---
 // Implements custom painting, mouse interaction, and value-to-pixel mapping
 
@@ -44,6 +46,16 @@ void RangeSlider::setValues(int min, int max) {
     update();
 }
 
+void RangeSlider::setHistogram(const std::vector<std::uint32_t>& counts) {
+    // Repaint only when the distribution actually changed
+    if (counts == m_histogram) {
+        return;
+    }
+    m_histogram = counts;
+    m_histogramPeak = m_histogram.empty() ? 0 : *std::max_element(m_histogram.begin(), m_histogram.end());
+    update();
+}
+
 // --- Rendering ---
 void RangeSlider::paintEvent(QPaintEvent *event) {
     Q_UNUSED(event);
@@ -55,6 +67,27 @@ void RangeSlider::paintEvent(QPaintEvent *event) {
     const int xUpper = valueToPosition(m_upperValue);
     const int margin = 15;
 
+    // 0. Draw Histogram (O(buckets); selected buckets highlighted)
+    if (m_histogramPeak > 0) {
+        const int xMin = valueToPosition(m_minimumRange);
+        const double bucketWidth = double(valueToPosition(m_maximumRange) - xMin) / m_histogram.size();
+        const double barHeight = height() - 4.0;
+        painter.setPen(Qt::NoPen);
+        for (std::size_t i = 0; i < m_histogram.size(); ++i) {
+            if (m_histogram[i] == 0) {
+                continue;
+            }
+            const double left = xMin + i * bucketWidth;
+            const double centre = left + bucketWidth * 0.5;
+            const bool selected = centre >= xLower && centre <= xUpper;
+            painter.setBrush(selected ? QColor(0, 120, 215, 70) : QColor(160, 160, 160, 60));
+
+            // At least one pixel, so sparse buckets stay visible
+            const double h = std::max(1.0, barHeight * m_histogram[i] / m_histogramPeak);
+            painter.drawRect(QRectF(left, height() - 2.0 - h, std::max(1.0, bucketWidth - 1.0), h));
+        }
+    }
+
     // 1. Draw Background Track
     painter.setPen(QPen(Qt::lightGray, 6, Qt::SolidLine, Qt::RoundCap));
     painter.drawLine(margin, yCenter, width() - margin, yCenter);
@@ -3,12 +3,16 @@
 
 #include <QWidget>
 
+#include <cstdint>
+#include <vector>
+
 /**
  * @class RangeSlider
  * @brief Dual-handle range selector widget.
  *
  * Provides an interactive control for selecting a minimum and maximum
- * value within a bounded numeric range.
+ * value within a bounded numeric range. An optional histogram of the
+ * underlying distribution is drawn behind the handles.
  */
 class RangeSlider : public QWidget {
     Q_OBJECT
@@ -20,6 +24,12 @@ public:
     void setRange(int min, int max);
     void setValues(int min, int max);
 
+    /**
+     * @brief Distribution drawn behind the handles: equal-width buckets
+     *        spanning the slider range. An empty vector hides it.
+     */
+    void setHistogram(const std::vector<std::uint32_t>& counts);
+
     // --- Value Access ---
     int lowerValue() const { return m_lowerValue; }
     int upperValue() const { return m_upperValue; }
@@ -46,6 +56,10 @@ private:
     int m_lowerValue   = 0;
     int m_upperValue   = 100;
 
+    // --- Histogram State ---
+    std::vector<std::uint32_t> m_histogram;
+    std::uint32_t m_histogramPeak = 0;
+
     // --- Interaction State ---
     bool m_isDraggingLower = false;
     bool m_isDraggingUpper = false;
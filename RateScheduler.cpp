@@ -0,0 +1,54 @@
+#include "RateScheduler.h"
+
+#include <algorithm>
+
+// --- RateScheduler Implementation ---
+
+RateScheduler::RateScheduler() {
+    m_divisors.fill(1);
+}
+
+// --- Configuration ---
+void RateScheduler::setDivisors(const Divisors& divisors) {
+    for (std::size_t c = 0; c < RATE_CLASS_COUNT; ++c) {
+        m_divisors[c] = std::max<std::uint32_t>(1, divisors[c]);
+    }
+}
+
+bool RateScheduler::isUniform() const {
+    return std::all_of(m_divisors.begin(), m_divisors.end(), [](std::uint32_t d) { return d == 1; });
+}
+
+void RateScheduler::configure(const std::array<std::size_t, RATE_CLASS_COUNT + 1>& classBegin) {
+    m_classBegin = classBegin;
+}
+
+// --- Query ---
+/**
+ * @brief Phase p of a class run of length n covers [n*p/d, n*(p+1)/d),
+ *        so phases differ in size by at most one slot.
+ */
+void RateScheduler::dueRanges(std::uint64_t tick, std::vector<SlotRange>& ranges) const {
+    for (std::size_t c = 0; c < RATE_CLASS_COUNT; ++c) {
+        const std::size_t begin = m_classBegin[c];
+        const std::size_t length = m_classBegin[c + 1] - begin;
+        const std::uint64_t divisor = m_divisors[c];
+        const std::uint64_t phase = tick % divisor;
+
+        SlotRange range;
+        range.begin = begin + static_cast<std::size_t>(length * phase / divisor);
+        range.end = begin + static_cast<std::size_t>(length * (phase + 1) / divisor);
+        if (range.begin < range.end) {
+            ranges.push_back(range);
+        }
+    }
+}
+
+RateClass RateScheduler::classOf(std::size_t slot) const {
+    for (std::size_t c = 1; c < RATE_CLASS_COUNT; ++c) {
+        if (slot < m_classBegin[c]) {
+            return static_cast<RateClass>(c - 1);
+        }
+    }
+    return RateLow;
+}
@@ -0,0 +1,73 @@
+#ifndef RATESCHEDULER_H
+#define RATESCHEDULER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum RateClass
+ * @brief Update-rate class of a simulation slot, derived from the track priority.
+ */
+enum RateClass : std::uint8_t {
+    RateFlash = 0,
+    RateHigh = 1,
+    RateRoutine = 2,
+    RateLow = 3
+};
+
+constexpr std::size_t RATE_CLASS_COUNT = 4;
+
+/**
+ * @struct SlotRange
+ * @brief Half-open range [begin, end) of simulation slots.
+ */
+struct SlotRange {
+    std::size_t begin = 0;
+    std::size_t end = 0;
+};
+
+/**
+ * @class RateScheduler
+ * @brief Decides which slots are integrated on a given base tick.
+ *
+ * Slots are bucketed by RateClass into contiguous runs (the controller
+ * assigns slots class by class). A class with divisor d is updated every
+ * d-th tick; to keep the per-tick cost flat, its run is split into d
+ * phases and one phase is due per tick, so each slot still updates exactly
+ * once per period.
+ *
+ * With all divisors at 1 every slot is due on every tick, which is the
+ * uniform-rate behavior.
+ */
+class RateScheduler {
+public:
+    using Divisors = std::array<std::uint32_t, RATE_CLASS_COUNT>;
+
+    RateScheduler();
+
+    // --- Configuration ---
+    /// Ticks between updates per class; values below 1 are treated as 1.
+    void setDivisors(const Divisors& divisors);
+    const Divisors& divisors() const { return m_divisors; }
+    bool isUniform() const;
+
+    /**
+     * @brief Installs the class runs: class c occupies
+     *        [classBegin[c], classBegin[c + 1]).
+     */
+    void configure(const std::array<std::size_t, RATE_CLASS_COUNT + 1>& classBegin);
+
+    // --- Query ---
+    /// Appends the ranges due on the given tick, in ascending slot order.
+    void dueRanges(std::uint64_t tick, std::vector<SlotRange>& ranges) const;
+
+    RateClass classOf(std::size_t slot) const;
+
+private:
+    Divisors m_divisors;
+    std::array<std::size_t, RATE_CLASS_COUNT + 1> m_classBegin{};
+};
+
+#endif // RATESCHEDULER_H
@@ -0,0 +1,338 @@
+#include "ShardCoordinator.h"
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QProcess>
+#include <QDebug>
+
+#include <algorithm>
+
+// --- ShardCoordinator Implementation ---
+
+namespace {
+constexpr int CONNECT_TIMEOUT_MS = 10000;
+constexpr int SHUTDOWN_TIMEOUT_MS = 5000;
+
+// A vehicle must be this far past a strip boundary before it migrates, so
+// tracks loitering on the boundary do not bounce between shards every step
+constexpr double MIGRATION_MARGIN = 250.0; // meters
+
+std::uint32_t trackHash(const QString& trackId) {
+    std::uint32_t hash = 2166136261u; // FNV-1a
+    for (const QChar c : trackId) {
+        hash = (hash ^ c.unicode()) * 16777619u;
+    }
+    return hash;
+}
+}
+
+ShardCoordinator::ShardCoordinator(TacticalVehicleData& data) : data(data) {
+}
+
+ShardCoordinator::~ShardCoordinator() {
+    stop();
+}
+
+void ShardCoordinator::setWorkerCommand(const QString& program, const QStringList& arguments) {
+    workerProgram = program;
+    workerArguments = arguments;
+}
+
+// --- Lifecycle ---
+bool ShardCoordinator::start(int shardCount, ShardPartition partitionMode, const ShardSettings& settings) {
+    stop();
+    if (shardCount < 1) {
+        qWarning() << "Shard Error: At least one shard is required.";
+        return false;
+    }
+    partition = partitionMode;
+    migrationCount = 0;
+    stepsSinceMigration = 0;
+
+    const QString serverName = QString("TacticalVehicleShards-%1").arg(QCoreApplication::applicationPid());
+    QLocalServer::removeServer(serverName);
+    server = new QLocalServer;
+    if (!server->listen(serverName)) {
+        qWarning() << "Shard Error: Unable to listen on" << serverName << ":" << server->errorString();
+        stop();
+        return false;
+    }
+
+    const QString program = workerProgram.isEmpty() ? QCoreApplication::applicationFilePath() : workerProgram;
+    shards.resize(shardCount);
+    for (int s = 0; s < shardCount; ++s) {
+        shards[s].process = new QProcess;
+        shards[s].process->setProcessChannelMode(QProcess::ForwardedChannels);
+        shards[s].process->start(program, workerArguments + QStringList{"--shard-worker", serverName,
+                                                                         "--shard-index", QString::number(s)});
+    }
+    if (!connectWorkers()) {
+        stop();
+        return false;
+    }
+
+    // --- Initial Distribution ---
+    if (partition == ShardPartition::Spatial) {
+        computeStripBounds();
+    }
+    std::vector<std::vector<std::size_t>> added(shardCount);
+    const auto& vehicles = data.vehicles();
+    for (std::size_t i = 0; i < vehicles.size(); ++i) {
+        added[shardFor(vehicles[i])].push_back(i);
+    }
+
+    QByteArray configuration;
+    QDataStream out(&configuration, QIODevice::WriteOnly);
+    prepareShardStream(out);
+    ShardChannel::writeSettings(out, settings);
+
+    for (int s = 0; s < shardCount; ++s) {
+        if (!shards[s].channel->send(ShardConfigure, configuration) || !assign(s, {}, added[s])) {
+            stop();
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Accepts one connection per worker; each identifies itself with a
+ *        ShardHello carrying its index.
+ */
+bool ShardCoordinator::connectWorkers() {
+    for (std::size_t connected = 0; connected < shards.size(); ++connected) {
+        if (!server->waitForNewConnection(CONNECT_TIMEOUT_MS)) {
+            qWarning() << "Shard Error: Only" << connected << "of" << shards.size() << "workers connected.";
+            return false;
+        }
+        QLocalSocket* socket = server->nextPendingConnection();
+        auto channel = std::make_unique<ShardChannel>(socket);
+
+        ShardMessage type = ShardShutdown;
+        QByteArray payload;
+        quint32 index = 0;
+        if (channel->receive(type, payload, CONNECT_TIMEOUT_MS) && type == ShardHello) {
+            QDataStream in(payload);
+            prepareShardStream(in);
+            in >> index;
+        }
+        if (type != ShardHello || index >= shards.size() || shards[index].channel) {
+            qWarning() << "Shard Error: Worker handshake failed.";
+            delete socket;
+            return false;
+        }
+        shards[index].socket = socket;
+        shards[index].channel = std::move(channel);
+    }
+    return true;
+}
+
+void ShardCoordinator::stop() {
+    for (Shard& shard : shards) {
+        if (shard.channel) {
+            shard.channel->send(ShardShutdown);
+        }
+    }
+    for (Shard& shard : shards) {
+        if (shard.process) {
+            if (!shard.process->waitForFinished(SHUTDOWN_TIMEOUT_MS)) {
+                shard.process->kill();
+                shard.process->waitForFinished(SHUTDOWN_TIMEOUT_MS);
+            }
+            delete shard.process;
+        }
+        shard.channel.reset();
+        delete shard.socket;
+    }
+    shards.clear();
+
+    delete server;
+    server = nullptr;
+}
+
+// --- Stepping ---
+void ShardCoordinator::setMigrationInterval(std::uint64_t steps) {
+    migrationInterval = std::max<std::uint64_t>(1, steps);
+}
+
+bool ShardCoordinator::runSteps(std::uint64_t steps, double targetX, double targetY) {
+    if (partition != ShardPartition::Spatial) {
+        return stepShards(steps, targetX, targetY);
+    }
+
+    std::uint64_t done = 0;
+    do {
+        const std::uint64_t round = std::min(steps - done, migrationInterval - stepsSinceMigration);
+        if (!stepShards(round, targetX, targetY)) {
+            return false;
+        }
+        done += round;
+        stepsSinceMigration += round;
+        if (stepsSinceMigration == migrationInterval) {
+            stepsSinceMigration = 0;
+            if (!migrate()) {
+                stop();
+                return false;
+            }
+        }
+    } while (done < steps);
+    return true;
+}
+
+/**
+ * @brief Advances every shard by the same number of steps and merges the
+ *        snapshots into the master records.
+ */
+bool ShardCoordinator::stepShards(std::uint64_t steps, double targetX, double targetY) {
+    QByteArray command;
+    QDataStream out(&command, QIODevice::WriteOnly);
+    prepareShardStream(out);
+    out << quint64(steps) << targetX << targetY;
+
+    // Broadcast first so the workers step concurrently, then collect
+    for (Shard& shard : shards) {
+        if (!shard.channel->send(ShardStep, command)) {
+            stop();
+            return false;
+        }
+    }
+    for (int s = 0; s < shardCount(); ++s) {
+        ShardMessage type;
+        QByteArray payload;
+        if (!shards[s].channel->receive(type, payload, -1) || type != ShardSnapshot || !mergeSnapshot(s, payload)) {
+            qWarning() << "Shard Error: No valid snapshot from shard" << s;
+            stop();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ShardCoordinator::mergeSnapshot(int shard, const QByteArray& payload) {
+    QDataStream in(payload);
+    prepareShardStream(in);
+
+    const std::vector<std::size_t>& members = shards[shard].members;
+    quint32 count = 0;
+    in >> count;
+    if (count != members.size()) {
+        return false;
+    }
+
+    auto& vehicles = data.vehiclesMutable();
+    for (const std::size_t index : members) {
+        ShardChannel::readTelemetry(in, vehicles[index]);
+    }
+    return in.status() == QDataStream::Ok;
+}
+
+// --- Partitioning ---
+int ShardCoordinator::shardFor(const TacticalVehicle& v) const {
+    if (partition == ShardPartition::Spatial) {
+        return static_cast<int>(std::upper_bound(stripBounds.begin(), stripBounds.end(), v.posX) - stripBounds.begin());
+    }
+    return static_cast<int>(trackHash(v.trackId) % shards.size());
+}
+
+/**
+ * @brief Places the strip boundaries at the X quantiles of the fleet, so
+ *        every shard starts with the same number of vehicles.
+ */
+void ShardCoordinator::computeStripBounds() {
+    std::vector<double> positions;
+    positions.reserve(data.vehicles().size());
+    for (const auto& v : data.vehicles()) {
+        positions.push_back(v.posX);
+    }
+
+    stripBounds.assign(shards.size() - 1, 0.0);
+    if (positions.empty()) {
+        return;
+    }
+    for (std::size_t s = 1; s < shards.size(); ++s) {
+        auto quantile = positions.begin() + positions.size() * s / shards.size();
+        std::nth_element(positions.begin(), quantile, positions.end());
+        stripBounds[s - 1] = *quantile;
+    }
+    std::sort(stripBounds.begin(), stripBounds.end());
+}
+
+/**
+ * @brief Sends the shard its membership change and mirrors it locally:
+ *        removed local indices drop out (order preserved), added master
+ *        indices are appended.
+ */
+bool ShardCoordinator::assign(int shard, const std::vector<quint32>& removed, const std::vector<std::size_t>& added) {
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    prepareShardStream(out);
+
+    out << quint32(removed.size());
+    for (const quint32 index : removed) {
+        out << index;
+    }
+    const auto& vehicles = data.vehicles();
+    out << quint32(added.size());
+    for (const std::size_t index : added) {
+        ShardChannel::writeVehicle(out, vehicles[index], data.routeWaypoints());
+    }
+    if (!shards[shard].channel->send(ShardAssign, payload)) {
+        return false;
+    }
+
+    std::vector<std::size_t>& members = shards[shard].members;
+    std::size_t kept = 0;
+    std::size_t nextRemoved = 0;
+    for (std::size_t k = 0; k < members.size(); ++k) {
+        if (nextRemoved < removed.size() && removed[nextRemoved] == k) {
+            ++nextRemoved;
+            continue;
+        }
+        members[kept++] = members[k];
+    }
+    members.resize(kept);
+    members.insert(members.end(), added.begin(), added.end());
+    return true;
+}
+
+/**
+ * @brief Hands vehicles that crossed a strip boundary (by more than the
+ *        hysteresis margin) to the shard owning their new position.
+ */
+bool ShardCoordinator::migrate() {
+    const auto& vehicles = data.vehicles();
+    std::vector<std::vector<quint32>> removed(shards.size());
+    std::vector<std::vector<std::size_t>> added(shards.size());
+    std::size_t moved = 0;
+
+    for (std::size_t s = 0; s < shards.size(); ++s) {
+        const std::vector<std::size_t>& members = shards[s].members;
+        for (std::size_t k = 0; k < members.size(); ++k) {
+            const TacticalVehicle& v = vehicles[members[k]];
+            const std::size_t target = static_cast<std::size_t>(shardFor(v));
+            if (target == s) {
+                continue;
+            }
+            const bool pastMargin = target > s ? v.posX > stripBounds[s] + MIGRATION_MARGIN
+                                               : v.posX < stripBounds[s - 1] - MIGRATION_MARGIN;
+            if (pastMargin) {
+                removed[s].push_back(static_cast<quint32>(k));
+                added[target].push_back(members[k]);
+                ++moved;
+            }
+        }
+    }
+
+    if (moved == 0) {
+        return true;
+    }
+    for (int s = 0; s < shardCount(); ++s) {
+        if ((!removed[s].empty() || !added[s].empty()) && !assign(s, removed[s], added[s])) {
+            return false;
+        }
+    }
+    migrationCount += moved;
+    return true;
+}
@@ -0,0 +1,119 @@
+#ifndef SHARDCOORDINATOR_H
+#define SHARDCOORDINATOR_H
+
+#include "ShardProtocol.h"
+#include "TacticalVehicleData.h"
+
+#include <QString>
+#include <QStringList>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class QLocalServer;
+class QLocalSocket;
+class QProcess;
+
+/**
+ * @enum ShardPartition
+ * @brief How vehicles are assigned to shards.
+ */
+enum class ShardPartition {
+    TrackHash, ///< Hash of the track ID; assignment never changes
+    Spatial    ///< Equal-population X strips; vehicles migrate as they cross
+};
+
+/**
+ * @class ShardCoordinator
+ * @brief Splits the fleet across worker processes and merges their results
+ *        back into TacticalVehicleData.
+ *
+ * Every shard is a separate process (by default this executable started
+ * with --shard-worker) connected over a QLocalSocket, so one Linux box with
+ * several workers stands in for several nodes. The coordinator owns the
+ * authoritative dataset: after each runSteps() it copies every shard's
+ * published telemetry into its master record. In a spatial partition it
+ * also does so at every migration interval, then moves vehicles that left
+ * their spatial strip to the neighbouring shard. Workers add and remove the
+ * moved vehicles incrementally, so the others keep their simulation state.
+ *
+ * Jitter streams are keyed by the vehicle rather than its slot, so a
+ * migration does not change a vehicle's draws. Pair queries (proximity,
+ * intercepts) only see vehicles of the same shard, so their results differ
+ * from single-process runs.
+ */
+class ShardCoordinator {
+public:
+    explicit ShardCoordinator(TacticalVehicleData& data);
+    ~ShardCoordinator();
+
+    ShardCoordinator(const ShardCoordinator&) = delete;
+    ShardCoordinator& operator=(const ShardCoordinator&) = delete;
+
+    /// Program and arguments that start a worker; the server name and shard
+    /// index are appended. Defaults to this executable.
+    void setWorkerCommand(const QString& program, const QStringList& arguments);
+
+    /**
+     * @brief Launches the workers and hands each one its vehicles.
+     * @return false if a worker could not be started or did not connect.
+     */
+    bool start(int shardCount, ShardPartition partition, const ShardSettings& settings);
+
+    /**
+     * @brief Steps between migrations of a spatial partition (default 1).
+     *
+     * Longer intervals exchange fewer snapshots, but vehicles stay on the
+     * wrong shard for up to that many steps. Counted across runSteps() calls.
+     */
+    void setMigrationInterval(std::uint64_t steps);
+
+    /**
+     * @brief Advances every shard, merges the snapshots and migrates vehicles.
+     *
+     * A spatial partition advances in rounds that end at each migration
+     * interval, so vehicles change shards at the same steps however the
+     * caller splits the run.
+     * @return false if a worker failed; the coordinator is stopped then.
+     */
+    bool runSteps(std::uint64_t steps, double targetX, double targetY);
+
+    /// Asks the workers to exit and waits for them.
+    void stop();
+
+    int shardCount() const { return static_cast<int>(shards.size()); }
+    std::size_t shardSize(int shard) const { return shards[shard].members.size(); }
+
+    /// Vehicles moved between shards since start().
+    std::uint64_t migrations() const { return migrationCount; }
+
+private:
+    struct Shard {
+        QProcess* process = nullptr;
+        QLocalSocket* socket = nullptr;
+        std::unique_ptr<ShardChannel> channel;
+        std::vector<std::size_t> members; ///< Master indices, in the worker's local order
+    };
+
+    int shardFor(const TacticalVehicle& v) const;
+    void computeStripBounds();
+    bool connectWorkers();
+    bool assign(int shard, const std::vector<quint32>& removed, const std::vector<std::size_t>& added);
+    bool stepShards(std::uint64_t steps, double targetX, double targetY);
+    bool mergeSnapshot(int shard, const QByteArray& payload);
+    bool migrate();
+
+    TacticalVehicleData& data;
+    std::vector<Shard> shards;
+    QLocalServer* server = nullptr;
+    QString workerProgram;
+    QStringList workerArguments;
+    ShardPartition partition = ShardPartition::TrackHash;
+    std::vector<double> stripBounds;  ///< Upper X bound of each strip but the last
+    std::uint64_t migrationCount = 0;
+    std::uint64_t migrationInterval = 1;
+    std::uint64_t stepsSinceMigration = 0;
+};
+
+#endif // SHARDCOORDINATOR_H
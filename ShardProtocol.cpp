@@ -0,0 +1,182 @@
+#include "ShardProtocol.h"
+
+#include <QDataStream>
+#include <QLocalSocket>
+#include <QDebug>
+
+// --- ShardChannel Implementation ---
+// Frame layout: quint32 length of (type + payload), quint8 type, payload.
+
+namespace {
+constexpr qint64 FRAME_HEADER_BYTES = 5;
+constexpr quint32 MAX_FRAME_BYTES = 1u << 30; // Guards against a corrupt length prefix
+}
+
+void prepareShardStream(QDataStream& stream) {
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+}
+
+// --- Framing ---
+bool ShardChannel::send(ShardMessage type, const QByteArray& payload) {
+    QByteArray frame;
+    QDataStream header(&frame, QIODevice::WriteOnly);
+    prepareShardStream(header);
+    header << quint32(payload.size() + 1) << quint8(type);
+    frame.append(payload);
+
+    if (socket->write(frame) != frame.size()) {
+        qWarning() << "Shard Error: Unable to write message:" << socket->errorString();
+        return false;
+    }
+    // No event loop runs the socket, so drain the write buffer here
+    while (socket->bytesToWrite() > 0) {
+        if (!socket->waitForBytesWritten(-1)) {
+            qWarning() << "Shard Error: Unable to write message:" << socket->errorString();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ShardChannel::readExactly(char* buffer, qint64 size, int timeoutMs) {
+    qint64 done = 0;
+    while (done < size) {
+        if (socket->bytesAvailable() == 0 && !socket->waitForReadyRead(timeoutMs)) {
+            return false;
+        }
+        const qint64 read = socket->read(buffer + done, size - done);
+        if (read < 0) {
+            return false;
+        }
+        done += read;
+    }
+    return true;
+}
+
+bool ShardChannel::receive(ShardMessage& type, QByteArray& payload, int timeoutMs) {
+    QByteArray header(FRAME_HEADER_BYTES, Qt::Uninitialized);
+    if (!readExactly(header.data(), FRAME_HEADER_BYTES, timeoutMs)) {
+        return false;
+    }
+
+    QDataStream in(header);
+    prepareShardStream(in);
+    quint32 length = 0;
+    quint8 code = 0;
+    in >> length >> code;
+    if (length == 0 || length > MAX_FRAME_BYTES || code < ShardHello || code > ShardShutdown) {
+        qWarning() << "Shard Error: Malformed frame header (length" << length << ", type" << code << ")";
+        return false;
+    }
+
+    type = static_cast<ShardMessage>(code);
+    payload.resize(static_cast<qsizetype>(length - 1));
+    return readExactly(payload.data(), payload.size(), timeoutMs);
+}
+
+// --- Payload Codecs ---
+void ShardChannel::writeSettings(QDataStream& out, const ShardSettings& settings) {
+    out << quint64(settings.seed) << settings.seeded << settings.timestep << qint32(settings.threads);
+    for (const std::uint32_t divisor : settings.rateDivisors) {
+        out << quint32(divisor);
+    }
+    out << quint32(settings.missionTargets.size());
+    for (const MissionTarget& target : settings.missionTargets) {
+        out << target.x << target.y;
+    }
+    out << settings.proximityRadius
+        << settings.geodetic << settings.originLatitude << settings.originLongitude << settings.largeArea;
+}
+
+void ShardChannel::readSettings(QDataStream& in, ShardSettings& settings) {
+    quint64 seed = 0;
+    qint32 threads = 1;
+    in >> seed >> settings.seeded >> settings.timestep >> threads;
+    settings.seed = seed;
+    settings.threads = threads;
+    for (std::uint32_t& divisor : settings.rateDivisors) {
+        quint32 value = 1;
+        in >> value;
+        divisor = value;
+    }
+    quint32 targetCount = 0;
+    in >> targetCount;
+    settings.missionTargets.clear();
+    for (quint32 i = 0; i < targetCount && in.status() == QDataStream::Ok; ++i) {
+        MissionTarget target;
+        in >> target.x >> target.y;
+        settings.missionTargets.push_back(target);
+    }
+    in >> settings.proximityRadius
+       >> settings.geodetic >> settings.originLatitude >> settings.originLongitude >> settings.largeArea;
+}
+
+void ShardChannel::writeVehicle(QDataStream& out, const TacticalVehicle& v, const std::vector<RouteWaypoint>& arena) {
+    out << v.callsign << v.trackId << v.type << v.classification << v.affiliation
+        << v.priority << v.domain << v.propulsion << v.natoIcon
+        << qint32(v.protectionLevel) << v.maxSpeed << v.targetSpeed
+        << v.hasSatCom << v.isAmphibious << v.isUnmanned << v.hasActiveDefense
+        << v.hasGeodetic;
+    writeTelemetry(out, v);
+
+    // The route travels with the vehicle; offsets are arena-local
+    const bool routeValid = std::size_t(v.routeOffset) + v.routeLength <= arena.size();
+    const quint32 length = routeValid ? v.routeLength : 0;
+    out << length << v.routeLoop;
+    for (quint32 i = 0; i < length; ++i) {
+        const RouteWaypoint& w = arena[v.routeOffset + i];
+        out << w.x << w.y << w.latitude << w.longitude << w.hasGeodetic;
+    }
+}
+
+void ShardChannel::readVehicle(QDataStream& in, TacticalVehicle& v, std::vector<RouteWaypoint>& arena) {
+    qint32 protectionLevel = 0;
+    in >> v.callsign >> v.trackId >> v.type >> v.classification >> v.affiliation
+       >> v.priority >> v.domain >> v.propulsion >> v.natoIcon
+       >> protectionLevel >> v.maxSpeed >> v.targetSpeed
+       >> v.hasSatCom >> v.isAmphibious >> v.isUnmanned >> v.hasActiveDefense
+       >> v.hasGeodetic;
+    v.protectionLevel = protectionLevel;
+    readTelemetry(in, v);
+
+    quint32 length = 0;
+    in >> length >> v.routeLoop;
+    v.routeOffset = static_cast<std::uint32_t>(arena.size());
+    v.routeLength = 0;
+    for (quint32 i = 0; i < length && in.status() == QDataStream::Ok; ++i) {
+        RouteWaypoint w;
+        in >> w.x >> w.y >> w.latitude >> w.longitude >> w.hasGeodetic;
+        arena.push_back(w);
+        ++v.routeLength;
+    }
+}
+
+void ShardChannel::writeTelemetry(QDataStream& out, const TacticalVehicle& v) {
+    out << v.posX << v.posY << v.heading << v.speed
+        << v.fuelLevel << v.ammunitionLevel << v.distanceToTarget
+        << v.nearestTargetDistance << qint32(v.nearestTargetIndex)
+        << quint32(v.proximityMask) << qint32(v.proximityContacts)
+        << v.timeToCpa << v.cpaDistance << v.etaToTarget
+        << quint32(v.routeCursor) << v.latitude << v.longitude;
+}
+
+void ShardChannel::readTelemetry(QDataStream& in, TacticalVehicle& v) {
+    qint32 nearestTargetIndex = -1;
+    quint32 proximityMask = 0;
+    qint32 proximityContacts = 0;
+    quint32 routeCursor = 0;
+    in >> v.posX >> v.posY >> v.heading >> v.speed
+       >> v.fuelLevel >> v.ammunitionLevel >> v.distanceToTarget
+       >> v.nearestTargetDistance >> nearestTargetIndex
+       >> proximityMask >> proximityContacts
+       >> v.timeToCpa >> v.cpaDistance >> v.etaToTarget
+       >> routeCursor >> v.latitude >> v.longitude;
+    v.nearestTargetIndex = nearestTargetIndex;
+    v.proximityMask = proximityMask;
+    v.proximityContacts = proximityContacts;
+    v.routeCursor = routeCursor;
+
+    // The partner is a slot of the shard that computed it, meaningless here
+    v.cpaPartner = -1;
+}
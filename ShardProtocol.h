@@ -0,0 +1,97 @@
+#ifndef SHARDPROTOCOL_H
+#define SHARDPROTOCOL_H
+
+#include "RateScheduler.h"
+#include "SimulationKernel.h"
+#include "TacticalVehicle.h"
+
+#include <QByteArray>
+
+#include <cstdint>
+#include <vector>
+
+class QDataStream;
+class QLocalSocket;
+
+/**
+ * @enum ShardMessage
+ * @brief Frame types exchanged between the shard coordinator and its workers.
+ *
+ * Worker -> coordinator: ShardHello once after connecting, then one
+ * ShardSnapshot per ShardStep. Everything else flows the other way.
+ */
+enum ShardMessage : quint8 {
+    ShardHello = 1,     ///< quint32 shard index
+    ShardConfigure,     ///< ShardSettings
+    ShardAssign,        ///< Removed local indices, then added vehicles with their routes
+    ShardStep,          ///< quint64 steps, double targetX, double targetY
+    ShardSnapshot,      ///< Published telemetry of every local vehicle, in local order
+    ShardShutdown
+};
+
+/**
+ * @struct ShardSettings
+ * @brief Simulation parameters every shard worker runs with.
+ */
+struct ShardSettings {
+    std::uint64_t seed = 0;
+    bool seeded = false;
+    double timestep = 1.0;
+    int threads = 1;                 ///< Per worker process
+    RateScheduler::Divisors rateDivisors{{1, 1, 1, 1}};
+    std::vector<MissionTarget> missionTargets;
+    double proximityRadius = 1000.0; ///< Meters (0 = disabled); pairs are found within a shard only
+    bool geodetic = false;
+    double originLatitude = 0.0;
+    double originLongitude = 0.0;
+    bool largeArea = false;
+};
+
+/**
+ * @class ShardChannel
+ * @brief Length-prefixed message framing over a connected QLocalSocket.
+ *
+ * Blocking by design: the coordinator broadcasts a step to all workers
+ * first and only then collects the replies, so the worker processes still
+ * run concurrently. Payloads are QDataStream-encoded with full double
+ * precision.
+ */
+class ShardChannel {
+public:
+    explicit ShardChannel(QLocalSocket* socket) : socket(socket) {}
+
+    bool send(ShardMessage type, const QByteArray& payload = QByteArray());
+
+    /**
+     * @brief Waits for the next complete frame.
+     * @param timeoutMs Maximum wait per read (-1 = wait forever).
+     * @return false on disconnect, timeout or a malformed frame.
+     */
+    bool receive(ShardMessage& type, QByteArray& payload, int timeoutMs);
+
+    // --- Payload Codecs ---
+    static void writeSettings(QDataStream& out, const ShardSettings& settings);
+    static void readSettings(QDataStream& in, ShardSettings& settings);
+
+    /// Writes the full vehicle record plus its route slice of arena.
+    static void writeVehicle(QDataStream& out, const TacticalVehicle& v, const std::vector<RouteWaypoint>& arena);
+
+    /// Reads a record written by writeVehicle(), appending its route to arena.
+    static void readVehicle(QDataStream& in, TacticalVehicle& v, std::vector<RouteWaypoint>& arena);
+
+    /// Dynamic telemetry only: what the coordinator merges after every step.
+    static void writeTelemetry(QDataStream& out, const TacticalVehicle& v);
+    static void readTelemetry(QDataStream& in, TacticalVehicle& v);
+
+private:
+    bool readExactly(char* buffer, qint64 size, int timeoutMs);
+
+    QLocalSocket* socket;
+};
+
+/**
+ * @brief Configures a QDataStream for the shard protocol.
+ */
+void prepareShardStream(QDataStream& stream);
+
+#endif // SHARDPROTOCOL_H
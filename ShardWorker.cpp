@@ -0,0 +1,155 @@
+#include "ShardWorker.h"
+#include "ShardProtocol.h"
+
+#include <QDataStream>
+#include <QLocalSocket>
+#include <QDebug>
+
+#include <algorithm>
+#include <vector>
+
+// --- ShardWorker Implementation ---
+
+namespace {
+constexpr int CONNECT_TIMEOUT_MS = 10000;
+}
+
+ShardWorker::ShardWorker(const QString& serverName, int shardIndex)
+    : serverName(serverName), shardIndex(shardIndex), controller(data) {
+}
+
+int ShardWorker::run() {
+    QLocalSocket socket;
+    socket.connectToServer(serverName);
+    if (!socket.waitForConnected(CONNECT_TIMEOUT_MS)) {
+        qWarning() << "Shard Error: Worker" << shardIndex << "cannot reach" << serverName
+                   << ":" << socket.errorString();
+        return 1;
+    }
+
+    ShardChannel channel(&socket);
+    QByteArray hello;
+    QDataStream helloOut(&hello, QIODevice::WriteOnly);
+    prepareShardStream(helloOut);
+    helloOut << quint32(shardIndex);
+    channel.send(ShardHello, hello);
+
+    ShardMessage type;
+    QByteArray payload;
+    while (channel.receive(type, payload, -1)) {
+        switch (type) {
+        case ShardConfigure: {
+            QDataStream in(payload);
+            prepareShardStream(in);
+            ShardSettings settings;
+            ShardChannel::readSettings(in, settings);
+
+            // Jitter streams are keyed by vehicle, so every shard shares the
+            // seed and a migrating vehicle keeps its draws
+            if (settings.seeded) {
+                controller.setRandomSeed(settings.seed);
+            }
+            controller.setThreadCount(settings.threads);
+            controller.setTimestep(settings.timestep);
+            controller.setRateDivisors(settings.rateDivisors);
+            controller.setMissionTargets(settings.missionTargets);
+            controller.setProximityRadius(settings.proximityRadius);
+            if (settings.geodetic) {
+                controller.setGeodeticOrigin(settings.originLatitude, settings.originLongitude);
+                controller.setLargeAreaDistances(settings.largeArea);
+            }
+            break;
+        }
+        case ShardAssign:
+            if (!applyAssignment(payload)) {
+                return 1;
+            }
+            break;
+        case ShardStep: {
+            QDataStream in(payload);
+            prepareShardStream(in);
+            quint64 steps = 0;
+            double targetX = 0.0;
+            double targetY = 0.0;
+            in >> steps >> targetX >> targetY;
+
+            // Empty shards step too, so every shard's clock (and with it the
+            // jitter of vehicles migrating in) stays in line
+            controller.runSteps(steps, targetX, targetY);
+            controller.takeSupplyEvents();
+            if (!channel.send(ShardSnapshot, snapshot())) {
+                return 1;
+            }
+            break;
+        }
+        case ShardShutdown:
+            return 0;
+        default:
+            qWarning() << "Shard Error: Worker" << shardIndex << "received unexpected message" << int(type);
+            return 1;
+        }
+    }
+
+    qWarning() << "Shard Error: Worker" << shardIndex << "lost the coordinator";
+    return 1;
+}
+
+/**
+ * @brief Appends the added vehicles and drops the removed local ones.
+ *
+ * Survivors keep their relative order, followed by the additions; the
+ * coordinator mirrors the same rule, so local indices agree on both sides.
+ * Survivors also keep their simulation state, and the controller lays the
+ * slots out once for both changes.
+ */
+bool ShardWorker::applyAssignment(const QByteArray& payload) {
+    QDataStream in(payload);
+    prepareShardStream(in);
+
+    quint32 removedCount = 0;
+    in >> removedCount;
+    std::vector<std::size_t> removed(removedCount);
+    for (std::size_t& index : removed) {
+        quint32 local = 0;
+        in >> local;
+        index = local;
+    }
+
+    quint32 addedCount = 0;
+    in >> addedCount;
+    TacticalVehicleData::VehicleBatch batch;
+    batch.vehicles.resize(addedCount);
+    for (quint32 i = 0; i < addedCount && in.status() == QDataStream::Ok; ++i) {
+        ShardChannel::readVehicle(in, batch.vehicles[i], batch.routes);
+    }
+
+    const std::size_t current = data.vehicles().size();
+    const bool inRange = std::all_of(removed.begin(), removed.end(),
+                                     [current](std::size_t index) { return index < current; });
+    if (in.status() != QDataStream::Ok || !inRange) {
+        qWarning() << "Shard Error: Worker" << shardIndex << "received an inconsistent assignment";
+        return false;
+    }
+
+    // Appended first, so the removal's layout pass also places the additions
+    if (addedCount > 0) {
+        controller.appendVehicles(std::move(batch));
+    }
+    if (!removed.empty()) {
+        controller.removeVehicles(std::move(removed));
+    }
+    return true;
+}
+
+QByteArray ShardWorker::snapshot() const {
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    prepareShardStream(out);
+
+    const auto& vehicles = data.vehicles();
+    out << quint32(vehicles.size());
+    for (const auto& v : vehicles) {
+        ShardChannel::writeTelemetry(out, v);
+    }
+    return payload;
+}
@@ -0,0 +1,41 @@
+#ifndef SHARDWORKER_H
+#define SHARDWORKER_H
+
+#include "TacticalVehicleController.h"
+#include "TacticalVehicleData.h"
+
+#include <QByteArray>
+#include <QString>
+
+class ShardChannel;
+
+/**
+ * @class ShardWorker
+ * @brief Simulates one shard of the fleet in a worker process.
+ *
+ * Connects to the coordinator's local server, announces its shard index,
+ * then serves requests until ShardShutdown or disconnect: ShardConfigure
+ * sets up the controller, ShardAssign adds and removes vehicles, and every
+ * ShardStep advances the local fleet and answers with a ShardSnapshot.
+ */
+class ShardWorker {
+public:
+    ShardWorker(const QString& serverName, int shardIndex);
+
+    /**
+     * @brief Runs the request loop.
+     * @return Process exit code (0 after an orderly shutdown).
+     */
+    int run();
+
+private:
+    bool applyAssignment(const QByteArray& payload);
+    QByteArray snapshot() const;
+
+    QString serverName;
+    int shardIndex = 0;
+    TacticalVehicleData data;
+    TacticalVehicleController controller;
+};
+
+#endif // SHARDWORKER_H
@@ -0,0 +1,12 @@
+#ifndef SIMDSUPPORT_H
+#define SIMDSUPPORT_H
+
+// --- SIMD Capability Detection ---
+// SSE2 is baseline on x86-64 (and MSVC x64); kernels fall back to their
+// scalar paths on every other target.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TVG_KERNEL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#endif // SIMDSUPPORT_H
@@ -0,0 +1,130 @@
+#include "SimulationClock.h"
+
+#include <algorithm>
+#include <cmath>
+
+// --- SimulationClock Implementation ---
+
+namespace {
+constexpr double WARP_WINDOW_SECONDS = 1.0; ///< Averaging window of achievedWarp()
+constexpr double COST_SMOOTHING = 0.25;     ///< Weight of the newest step cost sample
+constexpr std::uint32_t RELEASE_TICKS = 10; ///< Ticks before a coarse multiple is lowered
+}
+
+// --- Configuration ---
+void SimulationClock::setBaseTimestep(double seconds) {
+    if (seconds <= 0.0) {
+        return;
+    }
+    m_baseTimestep = seconds;
+    m_maxTimestep = std::max(m_maxTimestep, seconds);
+}
+
+void SimulationClock::setMaxTimestep(double seconds) {
+    m_maxTimestep = std::max(seconds, m_baseTimestep);
+}
+
+void SimulationClock::setCoarseningEnabled(bool enabled) {
+    m_coarsening = enabled;
+    if (!enabled) {
+        m_multiple = 1;
+        m_releaseTicks = 0;
+    }
+}
+
+void SimulationClock::setWarp(double factor) {
+    if (factor <= 0.0) {
+        return;
+    }
+    m_warp = factor;
+    m_debt = 0.0;
+}
+
+void SimulationClock::setPaused(bool paused) {
+    m_paused = paused;
+    m_debt = 0.0;
+    m_multiple = 1;
+    m_releaseTicks = 0;
+}
+
+// --- Heartbeat ---
+/**
+ * @brief Sub-steps the accrued time at the base timestep while the step cost
+ *        allows it, then degrades in two stages: coarser steps, then shed time.
+ */
+ClockTick SimulationClock::advance(double wallSeconds) {
+    ClockTick tick;
+    tick.timestep = m_baseTimestep;
+    m_saturated = false;
+
+    if (m_paused) {
+        if (m_singleStep) {
+            tick.steps = 1;
+            m_singleStep = false;
+        }
+    } else {
+        const double accrued = std::max(0.0, wallSeconds) * m_warp;
+        m_debt += accrued;
+        const std::uint64_t baseSteps = static_cast<std::uint64_t>(std::floor(m_debt / m_baseTimestep));
+
+        // Steps that fit the budget at the measured cost (always at least one)
+        const std::uint64_t affordable = m_stepCost > 0.0
+            ? std::max<std::uint64_t>(1, static_cast<std::uint64_t>(m_stepBudget / m_stepCost))
+            : baseSteps;
+
+        // Smallest whole multiple that keeps up with the time accrued this
+        // tick in the affordable steps (a backlog is shed, not chased);
+        // coarser multiples apply at once, finer ones after RELEASE_TICKS.
+        // Until a cost is measured every owed step counts as affordable.
+        std::uint64_t needed = 1;
+        const auto accruedSteps = static_cast<std::uint64_t>(std::ceil(accrued / m_baseTimestep - 1e-9));
+        if (m_coarsening && m_stepCost > 0.0 && accruedSteps > affordable) {
+            const auto maxMultiple = static_cast<std::uint64_t>(std::floor(m_maxTimestep / m_baseTimestep + 1e-9));
+            needed = std::clamp<std::uint64_t>((accruedSteps + affordable - 1) / affordable, 1,
+                                               std::max<std::uint64_t>(1, maxMultiple));
+        }
+        if (needed >= m_multiple) {
+            m_multiple = static_cast<std::uint32_t>(needed);
+            m_releaseTicks = 0;
+        } else if (++m_releaseTicks >= RELEASE_TICKS) {
+            m_multiple = static_cast<std::uint32_t>(needed);
+            m_releaseTicks = 0;
+        }
+
+        tick.multiple = m_multiple;
+        tick.timestep = m_baseTimestep * static_cast<double>(m_multiple);
+        tick.steps = static_cast<std::uint64_t>(std::floor(m_debt / tick.timestep));
+        m_saturated = m_multiple > 1;
+        if (tick.steps > affordable) {
+            m_saturated = true;
+            tick.steps = affordable;
+        }
+
+        m_debt -= static_cast<double>(tick.steps) * tick.timestep;
+
+        // Whatever still does not fit is dropped, not carried into the next tick
+        if (m_saturated) {
+            m_debt = std::min(m_debt, tick.timestep);
+        }
+    }
+
+    m_lastAdvance = static_cast<double>(tick.steps) * tick.timestep;
+
+    m_windowWall += std::max(0.0, wallSeconds);
+    m_windowSimulated += m_lastAdvance;
+    if (m_windowWall >= WARP_WINDOW_SECONDS) {
+        m_achievedWarp = m_windowSimulated / m_windowWall;
+        m_windowWall = 0.0;
+        m_windowSimulated = 0.0;
+    }
+
+    return tick;
+}
+
+void SimulationClock::reportStepCost(double wallSeconds, std::uint64_t steps) {
+    if (steps == 0) {
+        return;
+    }
+    const double sample = wallSeconds / static_cast<double>(steps);
+    m_stepCost = m_stepCost > 0.0 ? m_stepCost + COST_SMOOTHING * (sample - m_stepCost) : sample;
+}
@@ -0,0 +1,109 @@
+#ifndef SIMULATIONCLOCK_H
+#define SIMULATIONCLOCK_H
+
+#include <cstdint>
+
+/**
+ * @struct ClockTick
+ * @brief Work planned for one heartbeat: steps of a given timestep.
+ */
+struct ClockTick {
+    std::uint64_t steps = 0;
+    double timestep = 0.0;      ///< Simulated seconds per step
+    std::uint32_t multiple = 1; ///< timestep in base timesteps
+};
+
+/**
+ * @class SimulationClock
+ * @brief Maps elapsed wall time onto simulation steps under a warp factor.
+ *
+ * Each heartbeat the clock accrues wall time * warp of simulated time and
+ * pays it off in whole steps of the base timestep (sub-stepping). The
+ * caller reports how long the steps took; when the steps owed no longer
+ * fit the per-heartbeat budget, the clock first coarsens the timestep up
+ * to maxTimestep and then sheds the remaining time instead of queueing it,
+ * so an overloaded simulation slows down rather than locking up the
+ * caller. achievedWarp() reports the rate actually delivered.
+ *
+ * Coarse timesteps are whole multiples of the base timestep, and a
+ * multiple is held until the load has stayed lower for a while, so the
+ * timestep (and the caller's cost of changing it) only moves when the
+ * load does.
+ *
+ * Pure arithmetic, no timers: the caller measures wall time.
+ */
+class SimulationClock {
+public:
+    // --- Configuration ---
+    void setBaseTimestep(double seconds);
+    double baseTimestep() const { return m_baseTimestep; }
+
+    /// Coarsest timestep used under load (never below the base timestep).
+    void setMaxTimestep(double seconds);
+    double maxTimestep() const { return m_maxTimestep; }
+
+    /**
+     * @brief Allows coarser timesteps under load (default on). While off,
+     *        an overloaded clock only sheds time, e.g. while a recording
+     *        fixes the timestep.
+     */
+    void setCoarseningEnabled(bool enabled);
+    bool isCoarseningEnabled() const { return m_coarsening; }
+
+    /// Wall seconds per heartbeat that may be spent stepping.
+    void setStepBudget(double seconds) { m_stepBudget = seconds; }
+    double stepBudget() const { return m_stepBudget; }
+
+    // --- Rate Control ---
+    /// Simulated seconds per wall second (1 = real time).
+    void setWarp(double factor);
+    double warp() const { return m_warp; }
+
+    void setPaused(bool paused);
+    bool isPaused() const { return m_paused; }
+
+    /// While paused, the next heartbeat advances exactly one base step.
+    void requestSingleStep() { m_singleStep = true; }
+
+    // --- Heartbeat ---
+    /**
+     * @brief Plans the steps for wallSeconds of elapsed wall time.
+     */
+    ClockTick advance(double wallSeconds);
+
+    /// Feeds back the wall time the planned steps actually took.
+    void reportStepCost(double wallSeconds, std::uint64_t steps);
+
+    // --- Reporting ---
+    /// Simulated / wall seconds over the last measurement window (about 1 s).
+    double achievedWarp() const { return m_achievedWarp; }
+
+    /// Simulated seconds advanced by the last planned tick.
+    double lastAdvance() const { return m_lastAdvance; }
+
+    /// true if the last tick had to coarsen the timestep or shed time.
+    bool isSaturated() const { return m_saturated; }
+
+private:
+    double m_baseTimestep = 0.1;
+    double m_maxTimestep = 1.0;
+    double m_stepBudget = 0.05;
+    double m_warp = 1.0;
+    bool m_paused = false;
+    bool m_singleStep = false;
+    bool m_coarsening = true;
+
+    double m_debt = 0.0;          ///< Simulated seconds owed but not yet stepped
+    double m_stepCost = 0.0;      ///< Smoothed wall seconds per step (0 = unknown)
+    double m_lastAdvance = 0.0;
+    bool m_saturated = false;
+    std::uint32_t m_multiple = 1;      ///< Current timestep in base timesteps
+    std::uint32_t m_releaseTicks = 0;  ///< Consecutive ticks a finer multiple would have done
+
+    // --- Achieved Warp Window ---
+    double m_windowWall = 0.0;
+    double m_windowSimulated = 0.0;
+    double m_achievedWarp = 0.0;
+};
+
+#endif // SIMULATIONCLOCK_H
@@ -0,0 +1,470 @@
+#include "SimulationKernel.h"
+#include "SimulationRandom.h"
+#include "SimdSupport.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// --- SimulationKernel Implementation ---
+// Hot-loop kinematics over contiguous telemetry arrays. No Qt types are used
+// here so the kernels can run on any thread and be verified in isolation.
+
+namespace {
+constexpr double PI_CONST = 3.14159265358979323846;
+constexpr double KMH_PER_MPS = 3.6;
+constexpr double SECONDS_PER_HOUR = 3600.0;
+
+// Heading draws use their own streams, one 64-second block per stream
+constexpr std::uint64_t HEADING_STREAM = 0x5BD1E9955BD1E995ULL;
+
+int countBits(std::uint64_t bits) {
+    return static_cast<int>(std::bitset<64>(bits).count());
+}
+
+// Appends one event per watched threshold the level dropped below
+void reportCrossings(std::vector<SupplyEvent>& events, const std::vector<double>& thresholds,
+                     std::size_t slot, SupplyKind kind, double before, double after) {
+    for (const double threshold : thresholds) {
+        if (before >= threshold && after < threshold) {
+            SupplyEvent event;
+            event.slot = slot;
+            event.kind = kind;
+            event.threshold = threshold;
+            event.level = after;
+            events.push_back(event);
+        }
+    }
+}
+}
+
+// --- Buffer Management ---
+void KinematicsBuffers::resize(std::size_t count) {
+    posX.resize(count, 0.0);
+    posY.resize(count, 0.0);
+    speed.resize(count, 0.0);
+    heading.resize(count, 0.0);
+    distanceToTarget.resize(count, 0.0);
+    fuelLevel.resize(count, 0.0);
+    ammunitionLevel.resize(count, 0.0);
+    targetSpeed.resize(count, 0.0);
+    streamKey.resize(count, 0);
+    fuelIdle.resize(count, 0.0);
+    fuelLinear.resize(count, 0.0);
+    fuelQuadratic.resize(count, 0.0);
+    ammunitionRate.resize(count, 0.0);
+    unitX.resize(count, 0.0);
+    unitY.resize(count, 0.0);
+    updatedStep.resize(count, 0);
+
+    // NaN never compares equal, so new slots are always refreshed on first use
+    cachedHeading.resize(count, std::numeric_limits<double>::quiet_NaN());
+}
+
+void RouteArena::resize(std::size_t slotCount) {
+    offset.resize(slotCount, 0);
+    length.resize(slotCount, 0);
+    cursor.resize(slotCount, 0);
+    loop.resize(slotCount, 0);
+    turnRate.resize(slotCount, 0.0);
+}
+
+// --- Heading Cache ---
+/**
+ * @brief Batched sin/cos evaluation for changed headings only.
+ *
+ * Headings are stored in navigational degrees (0 = north, clockwise);
+ * the -90° offset maps them onto the Cartesian frame used by posX/posY.
+ */
+std::size_t SimulationKernel::refreshHeadingCache(KinematicsBuffers& k, std::size_t begin, std::size_t end) {
+    std::size_t refreshed = 0;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        if (k.heading[i] == k.cachedHeading[i]) {
+            continue;
+        }
+        const double rad = (k.heading[i] - 90.0) * (PI_CONST / 180.0);
+        k.unitX[i] = std::cos(rad);
+        k.unitY[i] = std::sin(rad);
+        k.cachedHeading[i] = k.heading[i];
+        ++refreshed;
+    }
+    return refreshed;
+}
+
+// --- Route Following ---
+void SimulationKernel::steerAlongRoutes(KinematicsBuffers& k, RouteArena& routes,
+                                        std::size_t begin, std::size_t end, double dt) {
+    constexpr double MIN_ARRIVAL_RADIUS = 25.0;
+    constexpr double RAD_TO_DEG = 180.0 / PI_CONST;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::uint32_t length = routes.length[i];
+        std::uint32_t cursor = routes.cursor[i];
+        if (cursor >= length) {
+            continue;
+        }
+
+        // Arrival: one step of travel, so fast tracks cannot orbit a waypoint
+        const double arrival = std::max(MIN_ARRIVAL_RADIUS, k.speed[i] / KMH_PER_MPS * dt);
+        std::size_t w = routes.offset[i] + cursor;
+        double dx = routes.waypointX[w] - k.posX[i];
+        double dy = routes.waypointY[w] - k.posY[i];
+        if (dx * dx + dy * dy <= arrival * arrival) {
+            ++cursor;
+            if (cursor >= length && routes.loop[i]) {
+                cursor = 0;
+            }
+            routes.cursor[i] = cursor;
+            if (cursor >= length) {
+                continue;
+            }
+            w = routes.offset[i] + cursor;
+            dx = routes.waypointX[w] - k.posX[i];
+            dy = routes.waypointY[w] - k.posY[i];
+        }
+
+        // Bearing in navigational degrees (inverse of the -90° offset in refreshHeadingCache)
+        double desired = std::atan2(dy, dx) * RAD_TO_DEG + 90.0;
+        if (desired < 0.0) {
+            desired += 360.0;
+        }
+
+        double turn = desired - k.heading[i];
+        if (turn > 180.0) {
+            turn -= 360.0;
+        } else if (turn < -180.0) {
+            turn += 360.0;
+        }
+        const double maxTurn = routes.turnRate[i] * dt;
+        turn = std::clamp(turn, -maxTurn, maxTurn);
+
+        double heading = k.heading[i] + turn;
+        if (heading < 0.0) {
+            heading += 360.0;
+        } else if (heading >= 360.0) {
+            heading -= 360.0;
+        }
+        k.heading[i] = heading;
+    }
+}
+
+// --- Stochastic Variation ---
+/**
+ * @brief Varies speed around targetSpeed and drifts heading by up to one
+ *        degree per simulated second.
+ *
+ * Tolerance bands narrow with the target speed (3% / 2% / 1%); speeds stay
+ * whole km/h like the original QRandomGenerator-based implementation. Each
+ * second's speed draw replaces the previous one, so only the last second of
+ * the interval is drawn. Each second moves the heading by -1, 0 or +1
+ * degree (one up bit and one down bit), so the drift over the interval is a
+ * difference of two bit counts over 64-second blocks. Vehicles at rest keep
+ * their heading and speed.
+ */
+void SimulationKernel::applyJitter(KinematicsBuffers& k, std::size_t begin, std::size_t end,
+                                   const SimulationRandom& random, std::uint64_t firstEpoch, std::uint64_t lastEpoch) {
+    if (lastEpoch <= firstEpoch) {
+        return;
+    }
+    const std::uint64_t first = firstEpoch + 1;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        if (!(k.speed[i] > 0)) {
+            continue;
+        }
+
+        // Variating speed realistically
+        RandomStream rng = random.stream(k.streamKey[i], lastEpoch);
+        const double target = k.targetSpeed[i];
+        double tolerance = 0.01;
+        if (target < 100) {
+            tolerance = 0.03;
+        } else if (target > 100 && target < 300) {
+            tolerance = 0.02;
+        }
+        const auto lowerLimit = static_cast<std::uint32_t>(static_cast<std::int32_t>(target - target * tolerance));
+        const auto upperLimit = std::max(lowerLimit + 1, static_cast<std::uint32_t>(target + target * tolerance));
+        k.speed[i] = static_cast<double>(rng.bounded(lowerLimit, upperLimit));
+
+        // Variating heading realistically
+        int drift = 0;
+        for (std::uint64_t block = first >> 6; block <= lastEpoch >> 6; ++block) {
+            const unsigned low = block == first >> 6 ? unsigned(first & 63) : 0u;
+            const unsigned high = block == lastEpoch >> 6 ? unsigned(lastEpoch & 63) : 63u;
+            const std::uint64_t mask = (~0ULL >> (63 - high)) & (~0ULL << low);
+            RandomStream bits = random.stream(k.streamKey[i] ^ HEADING_STREAM, block);
+            const std::uint64_t up = bits.next64();
+            const std::uint64_t down = bits.next64();
+            drift += countBits(up & mask) - countBits(down & mask);
+        }
+        if (drift != 0) {
+            const double heading = std::fmod(k.heading[i] + drift, 360.0);
+            k.heading[i] = heading < 0.0 ? heading + 360.0 : heading;
+        }
+    }
+}
+
+// --- Integration ---
+// Both paths evaluate: step = speed / 3.6 * dt, pos += step * unit,
+// distance = sqrt(dx*dx + dy*dy), fuel -= (idle + v * (linear + v * quadratic))
+// * dt / 3600 while moving, clamped at zero. The operation order is identical
+// so the vectorized path can be checked bit-for-bit against the scalar one
+// (assuming the compiler does not contract the scalar path into FMA).
+void SimulationKernel::integrate(KinematicsBuffers& k, std::size_t begin, std::size_t end,
+                                 double dt, double targetX, double targetY,
+                                 const SupplyThresholds& thresholds, std::vector<SupplyEvent>& events) {
+    std::size_t i = begin;
+
+#ifdef TVG_KERNEL_SSE2
+    const __m128d vKmh   = _mm_set1_pd(KMH_PER_MPS);
+    const __m128d vDt    = _mm_set1_pd(dt);
+    const __m128d vHours = _mm_set1_pd(dt / SECONDS_PER_HOUR);
+    const __m128d vTx    = _mm_set1_pd(targetX);
+    const __m128d vTy    = _mm_set1_pd(targetY);
+    const __m128d vZero  = _mm_setzero_pd();
+
+    double* const posX  = k.posX.data();
+    double* const posY  = k.posY.data();
+    double* const dist  = k.distanceToTarget.data();
+    double* const speed = k.speed.data();
+    double* const fuel  = k.fuelLevel.data();
+    double* const ammo  = k.ammunitionLevel.data();
+    const double* const unitX = k.unitX.data();
+    const double* const unitY = k.unitY.data();
+    const double* const idle  = k.fuelIdle.data();
+    const double* const lin   = k.fuelLinear.data();
+    const double* const quad  = k.fuelQuadratic.data();
+    const double* const rate  = k.ammunitionRate.data();
+
+    // Lane-wise crossing test; events are rare, so lanes are only unpacked on a hit
+    auto detect = [&events](const std::vector<double>& watched, std::size_t slot, SupplyKind kind,
+                            __m128d before, __m128d after) {
+        for (const double threshold : watched) {
+            const __m128d t = _mm_set1_pd(threshold);
+            const int hits = _mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(before, t), _mm_cmplt_pd(after, t)));
+            if (hits == 0) {
+                continue;
+            }
+            alignas(16) double levels[2];
+            _mm_store_pd(levels, after);
+            for (int lane = 0; lane < 2; ++lane) {
+                if (hits & (1 << lane)) {
+                    SupplyEvent event;
+                    event.slot = slot + lane;
+                    event.kind = kind;
+                    event.threshold = threshold;
+                    event.level = levels[lane];
+                    events.push_back(event);
+                }
+            }
+        }
+    };
+
+    for (; i + 2 <= end; i += 2) {
+        const __m128d v = _mm_loadu_pd(speed + i);
+        const __m128d step = _mm_mul_pd(_mm_div_pd(v, vKmh), vDt);
+
+        const __m128d px = _mm_add_pd(_mm_loadu_pd(posX + i), _mm_mul_pd(step, _mm_loadu_pd(unitX + i)));
+        const __m128d py = _mm_add_pd(_mm_loadu_pd(posY + i), _mm_mul_pd(step, _mm_loadu_pd(unitY + i)));
+        _mm_storeu_pd(posX + i, px);
+        _mm_storeu_pd(posY + i, py);
+
+        const __m128d dx = _mm_sub_pd(vTx, px);
+        const __m128d dy = _mm_sub_pd(vTy, py);
+        _mm_storeu_pd(dist + i, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+
+        // Consumption (moving slots only)
+        const __m128d moving = _mm_cmpgt_pd(v, vZero);
+        const __m128d fuelRate = _mm_add_pd(_mm_loadu_pd(idle + i),
+                                            _mm_mul_pd(v, _mm_add_pd(_mm_loadu_pd(lin + i),
+                                                                     _mm_mul_pd(v, _mm_loadu_pd(quad + i)))));
+        const __m128d fuelBefore = _mm_loadu_pd(fuel + i);
+        const __m128d fuelAfter = _mm_max_pd(
+            _mm_sub_pd(fuelBefore, _mm_and_pd(moving, _mm_mul_pd(fuelRate, vHours))), vZero);
+        _mm_storeu_pd(fuel + i, fuelAfter);
+
+        const __m128d ammoBefore = _mm_loadu_pd(ammo + i);
+        const __m128d ammoAfter = _mm_max_pd(
+            _mm_sub_pd(ammoBefore, _mm_and_pd(moving, _mm_mul_pd(_mm_loadu_pd(rate + i), vHours))), vZero);
+        _mm_storeu_pd(ammo + i, ammoAfter);
+
+        // Out of fuel: the vehicle comes to a halt
+        _mm_storeu_pd(speed + i, _mm_and_pd(_mm_cmpgt_pd(fuelAfter, vZero), v));
+
+        detect(thresholds.fuel, i, SupplyKind::Fuel, fuelBefore, fuelAfter);
+        detect(thresholds.ammunition, i, SupplyKind::Ammunition, ammoBefore, ammoAfter);
+    }
+#endif
+
+    // Remainder (odd tail) or full range on non-SSE2 targets
+    integrateScalar(k, i, end, dt, targetX, targetY, thresholds, events);
+}
+
+void SimulationKernel::integrateScalar(KinematicsBuffers& k, std::size_t begin, std::size_t end,
+                                       double dt, double targetX, double targetY,
+                                       const SupplyThresholds& thresholds, std::vector<SupplyEvent>& events) {
+    const double hours = dt / SECONDS_PER_HOUR;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const double speed = k.speed[i];
+
+        // Speed conversion: km/h -> m/s, scaled by the timestep
+        const double step = speed / KMH_PER_MPS * dt;
+
+        // Integrate position
+        k.posX[i] += step * k.unitX[i];
+        k.posY[i] += step * k.unitY[i];
+
+        // Update target-relative distance
+        const double dx = targetX - k.posX[i];
+        const double dy = targetY - k.posY[i];
+        k.distanceToTarget[i] = std::sqrt(dx * dx + dy * dy);
+
+        // Consumption (moving slots only); "x > 0 ? x : 0" mirrors _mm_max_pd
+        const bool moving = speed > 0.0;
+        const double fuelRate = k.fuelIdle[i] + speed * (k.fuelLinear[i] + speed * k.fuelQuadratic[i]);
+        const double fuelBefore = k.fuelLevel[i];
+        const double fuelRemaining = fuelBefore - (moving ? fuelRate * hours : 0.0);
+        const double fuelAfter = fuelRemaining > 0.0 ? fuelRemaining : 0.0;
+        k.fuelLevel[i] = fuelAfter;
+
+        const double ammoBefore = k.ammunitionLevel[i];
+        const double ammoRemaining = ammoBefore - (moving ? k.ammunitionRate[i] * hours : 0.0);
+        const double ammoAfter = ammoRemaining > 0.0 ? ammoRemaining : 0.0;
+        k.ammunitionLevel[i] = ammoAfter;
+
+        // Out of fuel: the vehicle comes to a halt
+        k.speed[i] = fuelAfter > 0.0 ? speed : 0.0;
+
+        reportCrossings(events, thresholds.fuel, i, SupplyKind::Fuel, fuelBefore, fuelAfter);
+        reportCrossings(events, thresholds.ammunition, i, SupplyKind::Ammunition, ammoBefore, ammoAfter);
+    }
+}
+
+// --- Dead Reckoning ---
+void SimulationKernel::deadReckon(const KinematicsBuffers& k, std::size_t begin, std::size_t end,
+                                  std::uint64_t step, double dt, double ahead, double targetX, double targetY,
+                                  double* x, double* y, double* distance) {
+    for (std::size_t i = begin; i < end; ++i) {
+        deadReckonSlot(k, i, step, dt, ahead, targetX, targetY, x[i], y[i], distance[i]);
+    }
+}
+
+void SimulationKernel::deadReckonSlot(const KinematicsBuffers& k, std::size_t i,
+                                      std::uint64_t step, double dt, double ahead, double targetX, double targetY,
+                                      double& x, double& y, double& distance) {
+    const double lag = (k.updatedStep[i] < step ? static_cast<double>(step - k.updatedStep[i]) * dt : 0.0) + ahead;
+    if (lag <= 0.0) {
+        x = k.posX[i];
+        y = k.posY[i];
+        distance = k.distanceToTarget[i];
+        return;
+    }
+
+    double unitX = k.unitX[i];
+    double unitY = k.unitY[i];
+    if (k.heading[i] != k.cachedHeading[i]) {
+        const double rad = (k.heading[i] - 90.0) * (PI_CONST / 180.0);
+        unitX = std::cos(rad);
+        unitY = std::sin(rad);
+    }
+
+    const double travel = k.speed[i] / KMH_PER_MPS * lag;
+    x = k.posX[i] + travel * unitX;
+    y = k.posY[i] + travel * unitY;
+
+    const double dx = targetX - x;
+    const double dy = targetY - y;
+    distance = std::sqrt(dx * dx + dy * dy);
+}
+
+// --- Multi-Target Distances ---
+void TargetDistanceMatrix::configure(const std::vector<MissionTarget>& targetSet, std::size_t count) {
+    targets = targetSet;
+    vehicleCount = count;
+    distances.assign(targets.size() * count, 0.0);
+    nearestDistance.assign(count, 0.0);
+    nearestTarget.assign(count, -1);
+}
+
+void SimulationKernel::computeTargetDistances(const KinematicsBuffers& k, TargetDistanceMatrix& m,
+                                              std::size_t begin, std::size_t end) {
+    // 512 slots keep positions, one matrix row segment and the nearest
+    // arrays (~18 KB) inside L1 while all targets are evaluated.
+    constexpr std::size_t BLOCK = 512;
+
+    const std::size_t targetCount = m.targetCount();
+    if (targetCount == 0) {
+        return;
+    }
+
+    const double* const posX = k.posX.data();
+    const double* const posY = k.posY.data();
+
+    for (std::size_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK) {
+        const std::size_t blockEnd = std::min(end, blockBegin + BLOCK);
+
+        for (std::size_t t = 0; t < targetCount; ++t) {
+            const double tx = m.targets[t].x;
+            const double ty = m.targets[t].y;
+            double* const row = m.distances.data() + t * m.vehicleCount;
+            std::size_t i = blockBegin;
+
+#ifdef TVG_KERNEL_SSE2
+            const __m128d vTx = _mm_set1_pd(tx);
+            const __m128d vTy = _mm_set1_pd(ty);
+            for (; i + 2 <= blockEnd; i += 2) {
+                const __m128d dx = _mm_sub_pd(vTx, _mm_loadu_pd(posX + i));
+                const __m128d dy = _mm_sub_pd(vTy, _mm_loadu_pd(posY + i));
+                _mm_storeu_pd(row + i, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+            }
+#endif
+            for (; i < blockEnd; ++i) {
+                const double dx = tx - posX[i];
+                const double dy = ty - posY[i];
+                row[i] = std::sqrt(dx * dx + dy * dy);
+            }
+
+            // Nearest-target reduction while the row segment is hot
+            if (t == 0) {
+                std::copy(row + blockBegin, row + blockEnd, m.nearestDistance.begin() + blockBegin);
+                std::fill(m.nearestTarget.begin() + blockBegin, m.nearestTarget.begin() + blockEnd, 0);
+            } else {
+                for (std::size_t j = blockBegin; j < blockEnd; ++j) {
+                    if (row[j] < m.nearestDistance[j]) {
+                        m.nearestDistance[j] = row[j];
+                        m.nearestTarget[j] = static_cast<std::int32_t>(t);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// --- Verification ---
+std::uint64_t SimulationKernel::digest(const KinematicsBuffers& k) {
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+
+    auto mix = [&hash](const std::vector<double>& values) {
+        for (const double value : values) {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            for (int byte = 0; byte < 8; ++byte) {
+                hash ^= (bits >> (byte * 8)) & 0xFFu;
+                hash *= 0x100000001B3ULL;
+            }
+        }
+    };
+
+    mix(k.posX);
+    mix(k.posY);
+    mix(k.speed);
+    mix(k.heading);
+    mix(k.distanceToTarget);
+    mix(k.fuelLevel);
+    mix(k.ammunitionLevel);
+    return hash;
+}
@@ -0,0 +1,247 @@
+#ifndef SIMULATIONKERNEL_H
+#define SIMULATIONKERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class SimulationRandom;
+
+/**
+ * @struct KinematicsBuffers
+ * @brief Contiguous (structure-of-arrays) telemetry working set for the simulation.
+ *
+ * Each vehicle owns one stable slot (TacticalVehicle::simIndex) across all arrays.
+ * Keeping the hot kinematic fields in flat arrays lets the integration kernel
+ * process several vehicles per instruction instead of striding through
+ * QString-heavy TacticalVehicle records.
+ */
+struct KinematicsBuffers {
+    // --- Integrated State ---
+    std::vector<double> posX;             ///< Cartesian X coordinate (meters)
+    std::vector<double> posY;             ///< Cartesian Y coordinate (meters)
+    std::vector<double> speed;            ///< Current speed (km/h)
+    std::vector<double> heading;          ///< Navigational heading (degrees)
+    std::vector<double> distanceToTarget; ///< Euclidean distance to mission target (meters)
+    std::vector<double> fuelLevel;        ///< Remaining fuel (%)
+    std::vector<double> ammunitionLevel;  ///< Remaining ammunition (%)
+
+    // --- Static Parameters ---
+    std::vector<double> targetSpeed;      ///< Target speed the jitter varies around (km/h)
+    std::vector<std::uint64_t> streamKey; ///< Jitter stream of the vehicle, stable across rebinds
+
+    // --- Consumption Coefficients ---
+    // Resolved once per slot from the type lookup table (see ConsumptionModel),
+    // so the step kernel only streams numbers. Rates are in percent per hour.
+    std::vector<double> fuelIdle;
+    std::vector<double> fuelLinear;       ///< Per km/h
+    std::vector<double> fuelQuadratic;    ///< Per (km/h)^2
+    std::vector<double> ammunitionRate;
+
+    // --- Heading Cache ---
+    // Unit heading vector, recomputed only for slots whose heading changed.
+    std::vector<double> unitX;
+    std::vector<double> unitY;
+    std::vector<double> cachedHeading;    ///< Heading the unit vector was computed from
+
+    // --- Update Schedule ---
+    // Slots in slower rate groups are integrated less often; their state is
+    // valid as of the step count recorded here (see RateScheduler).
+    std::vector<std::uint64_t> updatedStep;
+
+    void resize(std::size_t count);
+    std::size_t size() const { return posX.size(); }
+};
+
+/**
+ * @struct RouteArena
+ * @brief Flat waypoint storage plus per-slot route state.
+ *
+ * All routes live back to back in two coordinate arrays; a slot references
+ * its route by (offset, length) and tracks progress with a cursor, so route
+ * following touches no per-vehicle containers.
+ */
+struct RouteArena {
+    // --- Shared Waypoints ---
+    std::vector<double> waypointX;
+    std::vector<double> waypointY;
+
+    // --- Per-Slot State ---
+    std::vector<std::uint32_t> offset;  ///< First waypoint in the arena
+    std::vector<std::uint32_t> length;  ///< Number of waypoints (0 = no route)
+    std::vector<std::uint32_t> cursor;  ///< Route-relative waypoint being steered to (== length when done)
+    std::vector<std::uint8_t> loop;     ///< Wrap to the first waypoint after the last
+    std::vector<double> turnRate;       ///< Maximum heading change (degrees per second)
+
+    void resize(std::size_t slotCount);
+    bool empty() const { return waypointX.empty(); }
+};
+
+/**
+ * @enum SupplyKind
+ * @brief Consumable a SupplyEvent refers to.
+ */
+enum class SupplyKind : std::uint8_t {
+    Fuel,
+    Ammunition
+};
+
+/**
+ * @struct SupplyEvent
+ * @brief A slot's consumable level fell below a watched threshold during a step.
+ */
+struct SupplyEvent {
+    std::size_t slot = 0;
+    SupplyKind kind = SupplyKind::Fuel;
+    double threshold = 0.0;  ///< Threshold that was crossed (%)
+    double level = 0.0;      ///< Level after the step (%)
+    std::uint64_t step = 0;  ///< Simulation step the crossing occurred in (set by the caller)
+};
+
+/**
+ * @struct SupplyThresholds
+ * @brief Levels (%) watched by the integrator; a crossing is reported once,
+ *        on the step where the level drops from >= threshold to < threshold.
+ */
+struct SupplyThresholds {
+    std::vector<double> fuel;
+    std::vector<double> ammunition;
+};
+
+/**
+ * @struct MissionTarget
+ * @brief Cartesian objective location (meters).
+ */
+struct MissionTarget {
+    double x = 0.0;
+    double y = 0.0;
+};
+
+/**
+ * @struct TargetDistanceMatrix
+ * @brief Vehicle x target distance matrix plus per-slot nearest-target reduction.
+ *
+ * Distances are stored target-major ([target][slot]) so each row is a
+ * contiguous array the kernel can stream through with SIMD stores.
+ */
+struct TargetDistanceMatrix {
+    std::vector<MissionTarget> targets;
+    std::size_t vehicleCount = 0;
+
+    std::vector<double> distances;          ///< distances[target * vehicleCount + slot]
+    std::vector<double> nearestDistance;    ///< Minimum over all targets, per slot
+    std::vector<std::int32_t> nearestTarget;///< Index of the nearest target, per slot
+
+    void configure(const std::vector<MissionTarget>& targetSet, std::size_t count);
+    std::size_t targetCount() const { return targets.size(); }
+    double at(std::size_t target, std::size_t slot) const { return distances[target * vehicleCount + slot]; }
+};
+
+/**
+ * @class SimulationKernel
+ * @brief Stateless kinematics kernels operating on KinematicsBuffers.
+ *
+ * All kernels work on the half-open slot range [begin, end) so callers can
+ * split the fleet into independent chunks. The vectorized integrator and
+ * the scalar reference path perform the same IEEE operations in the same
+ * order and therefore produce bit-identical results.
+ */
+class SimulationKernel {
+public:
+    // --- Heading Cache ---
+    /**
+     * @brief Recomputes unit heading vectors for slots whose heading changed.
+     * @return Number of slots that required a sin/cos evaluation.
+     */
+    static std::size_t refreshHeadingCache(KinematicsBuffers& k, std::size_t begin, std::size_t end);
+
+    // --- Route Following ---
+    /**
+     * @brief Steers each routed slot toward its current waypoint.
+     *
+     * The heading turns toward the bearing of the waypoint by at most
+     * turnRate * dt degrees. A waypoint counts as reached within one step's
+     * travel (at least 25 m), after which the cursor advances.
+     */
+    static void steerAlongRoutes(KinematicsBuffers& k, RouteArena& routes,
+                                 std::size_t begin, std::size_t end, double dt);
+
+    // --- Stochastic Variation ---
+    /**
+     * @brief Applies realistic speed and heading jitter for the simulated
+     *        seconds (firstEpoch, lastEpoch].
+     *
+     * Jitter happens once per simulated second, whatever the timestep or
+     * rate group. Each second's draws come from the slot's stream key and
+     * the second's index, so the result depends neither on how the interval
+     * is split into updates nor on how the range is split across threads.
+     */
+    static void applyJitter(KinematicsBuffers& k, std::size_t begin, std::size_t end,
+                            const SimulationRandom& random, std::uint64_t firstEpoch, std::uint64_t lastEpoch);
+
+    // --- Integration ---
+    /**
+     * @brief Advances positions by dt seconds, recomputes target distance and
+     *        burns fuel and ammunition in the same pass.
+     *
+     * Moving slots consume fuel at idle + linear * v + quadratic * v^2 and
+     * ammunition at a flat rate; a slot that runs dry is brought to a halt.
+     * Threshold crossings are appended to events (unordered across calls).
+     *
+     * Uses SSE2 (two vehicles per instruction) when available and falls back
+     * to integrateScalar() for the remainder and on other targets.
+     */
+    static void integrate(KinematicsBuffers& k, std::size_t begin, std::size_t end,
+                          double dt, double targetX, double targetY,
+                          const SupplyThresholds& thresholds, std::vector<SupplyEvent>& events);
+
+    /**
+     * @brief Scalar reference implementation of integrate().
+     *
+     * Kept for verification of the vectorized path and for non-SSE2 builds.
+     */
+    static void integrateScalar(KinematicsBuffers& k, std::size_t begin, std::size_t end,
+                                double dt, double targetX, double targetY,
+                                const SupplyThresholds& thresholds, std::vector<SupplyEvent>& events);
+
+    // --- Dead Reckoning ---
+    /**
+     * @brief Projects each slot from its last update to the given step plus
+     *        ahead seconds.
+     *
+     * A slot integrated up to updatedStep moves (step - updatedStep) * dt +
+     * ahead seconds further along its current heading and speed; slots with
+     * no lag are copied unchanged. Slots whose heading changed since the
+     * heading cache was refreshed are projected along the new heading.
+     */
+    static void deadReckon(const KinematicsBuffers& k, std::size_t begin, std::size_t end,
+                           std::uint64_t step, double dt, double ahead, double targetX, double targetY,
+                           double* x, double* y, double* distance);
+
+    /// Single-slot form of deadReckon().
+    static void deadReckonSlot(const KinematicsBuffers& k, std::size_t slot,
+                               std::uint64_t step, double dt, double ahead, double targetX, double targetY,
+                               double& x, double& y, double& distance);
+
+    // --- Multi-Target Distances ---
+    /**
+     * @brief Fills the distance matrix and nearest-target reduction for [begin, end).
+     *
+     * Processes slots in cache-sized blocks: all targets are evaluated for a
+     * block while its positions are still resident, instead of streaming the
+     * whole fleet once per target.
+     */
+    static void computeTargetDistances(const KinematicsBuffers& k, TargetDistanceMatrix& m,
+                                       std::size_t begin, std::size_t end);
+
+    // --- Verification ---
+    /**
+     * @brief 64-bit FNV-1a digest over the bit patterns of the integrated state.
+     *
+     * Two runs are bit-exact replicas if and only if (barring collisions)
+     * their digests match.
+     */
+    static std::uint64_t digest(const KinematicsBuffers& k);
+};
+
+#endif // SIMULATIONKERNEL_H
@@ -0,0 +1,75 @@
+#ifndef SIMULATIONRANDOM_H
+#define SIMULATIONRANDOM_H
+
+#include <cstdint>
+
+/**
+ * @struct RandomStream
+ * @brief Short-lived sequential generator for one (stream, counter) pair.
+ *
+ * Produced by SimulationRandom::stream(). Cheap to create, holds no shared
+ * state and is therefore safe to use from any thread without locking.
+ */
+struct RandomStream {
+    std::uint64_t state = 0;
+
+    // --- Generation ---
+    /// SplitMix64 step: one add, three xor-shift-multiply rounds.
+    std::uint64_t next64() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    std::uint32_t next32() { return static_cast<std::uint32_t>(next64() >> 32); }
+
+    /**
+     * @brief Uniform integer in [lowest, highest).
+     *
+     * Mirrors QRandomGenerator::bounded(lowest, highest) semantics; an empty
+     * or inverted range yields lowest.
+     */
+    std::uint32_t bounded(std::uint32_t lowest, std::uint32_t highest) {
+        if (highest <= lowest) {
+            return lowest;
+        }
+        const std::uint64_t range = highest - lowest;
+        return lowest + static_cast<std::uint32_t>((next32() * range) >> 32);
+    }
+};
+
+/**
+ * @class SimulationRandom
+ * @brief Seeded, counter-based random source for the simulation.
+ *
+ * Every draw is a pure function of (seed, stream, counter): the simulation
+ * uses a per-vehicle key as stream and the simulated second as counter.
+ * Results are therefore independent of iteration order, thread assignment
+ * and slot layout, which makes the jitter pass trivially parallel and
+ * reproducible from a single seed.
+ */
+class SimulationRandom {
+public:
+    explicit SimulationRandom(std::uint64_t seed = 0) : m_seed(seed) {}
+
+    // --- Configuration ---
+    void setSeed(std::uint64_t seed) { m_seed = seed; }
+    std::uint64_t seed() const { return m_seed; }
+
+    // --- Stream Derivation ---
+    /**
+     * @brief Returns the generator for a given stream (e.g. vehicle key) and counter (e.g. second).
+     */
+    RandomStream stream(std::uint64_t streamId, std::uint64_t counter) const {
+        RandomStream keyed{m_seed ^ (streamId * 0xD1342543DE82EF95ULL)};
+        RandomStream s{keyed.next64() ^ (counter * 0xA0761D6478BD642FULL)};
+        s.next64(); // Decorrelate neighbouring counters before the first real draw
+        return s;
+    }
+
+private:
+    std::uint64_t m_seed = 0;
+};
+
+#endif // SIMULATIONRANDOM_H
@@ -0,0 +1,144 @@
+#include "SimulationRecording.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QDebug>
+
+// --- SimulationRecording Implementation ---
+// Binary persistence for deterministic replays. Doubles are written with
+// full precision so the restored state is bit-identical to the captured one.
+
+namespace {
+constexpr quint32 RECORDING_MAGIC   = 0x54564752; // "TVGR"
+constexpr quint16 RECORDING_VERSION = 5;
+}
+
+// --- Persistence ---
+bool SimulationRecording::save(const QString &path) const {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Recording Error: Unable to write recording at" << path;
+        return false;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_6_0);
+    out.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+    out << RECORDING_MAGIC << RECORDING_VERSION;
+    out << quint64(seed) << quint64(startStep) << quint64(startClock) << quint64(stepCount) << timestep;
+    out << quint64(finalDigest);
+    for (const std::uint32_t divisor : rateDivisors) {
+        out << quint32(divisor);
+    }
+
+    out << quint32(vehicles.size());
+    for (const auto& v : vehicles) {
+        out << v.trackId << v.callsign
+            << v.posX << v.posY << v.speed << v.heading
+            << v.targetSpeed << v.distanceToTarget
+            << v.fuelLevel << v.ammunitionLevel
+            << v.consumption.fuelIdle << v.consumption.fuelLinear
+            << v.consumption.fuelQuadratic << v.consumption.ammunition
+            << quint32(v.routeOffset) << quint32(v.routeLength) << quint32(v.routeCursor)
+            << v.routeLoop << v.turnRate
+            << v.priority << quint32(v.pendingSteps);
+    }
+
+    out << quint32(routeX.size());
+    for (std::size_t i = 0; i < routeX.size(); ++i) {
+        out << routeX[i] << routeY[i];
+    }
+
+    out << quint32(targets.size());
+    for (const auto& t : targets) {
+        out << quint64(t.step) << t.targetX << t.targetY;
+    }
+
+    return out.status() == QDataStream::Ok;
+}
+
+bool SimulationRecording::load(const QString &path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Recording Error: Unable to open recording at" << path;
+        return false;
+    }
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_6_0);
+    in.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    in >> magic >> version;
+    if (magic != RECORDING_MAGIC || version != RECORDING_VERSION) {
+        qWarning() << "Recording Error: Unsupported recording format in" << path;
+        return false;
+    }
+
+    quint64 seedValue = 0, startValue = 0, clockValue = 0, countValue = 0, digestValue = 0;
+    in >> seedValue >> startValue >> clockValue >> countValue >> timestep >> digestValue;
+    seed = seedValue;
+    startStep = startValue;
+    startClock = clockValue;
+    stepCount = countValue;
+    finalDigest = digestValue;
+    for (auto& divisor : rateDivisors) {
+        quint32 value = 1;
+        in >> value;
+        divisor = value;
+    }
+
+    quint32 vehicleCount = 0;
+    in >> vehicleCount;
+    vehicles.clear();
+    vehicles.reserve(vehicleCount);
+    for (quint32 i = 0; i < vehicleCount && in.status() == QDataStream::Ok; ++i) {
+        RecordedVehicle v;
+        in >> v.trackId >> v.callsign
+           >> v.posX >> v.posY >> v.speed >> v.heading
+           >> v.targetSpeed >> v.distanceToTarget
+           >> v.fuelLevel >> v.ammunitionLevel
+           >> v.consumption.fuelIdle >> v.consumption.fuelLinear
+           >> v.consumption.fuelQuadratic >> v.consumption.ammunition;
+        quint32 routeOffset = 0, routeLength = 0, routeCursor = 0;
+        quint32 pendingSteps = 0;
+        in >> routeOffset >> routeLength >> routeCursor >> v.routeLoop >> v.turnRate
+           >> v.priority >> pendingSteps;
+        v.pendingSteps = pendingSteps;
+        v.routeOffset = routeOffset;
+        v.routeLength = routeLength;
+        v.routeCursor = routeCursor;
+        vehicles.push_back(v);
+    }
+
+    quint32 waypointCount = 0;
+    in >> waypointCount;
+    routeX.clear();
+    routeY.clear();
+    for (quint32 i = 0; i < waypointCount && in.status() == QDataStream::Ok; ++i) {
+        double x = 0.0, y = 0.0;
+        in >> x >> y;
+        routeX.push_back(x);
+        routeY.push_back(y);
+    }
+
+    quint32 targetCount = 0;
+    in >> targetCount;
+    targets.clear();
+    for (quint32 i = 0; i < targetCount && in.status() == QDataStream::Ok; ++i) {
+        quint64 step = 0;
+        TargetChange t;
+        in >> step >> t.targetX >> t.targetY;
+        t.step = step;
+        targets.push_back(t);
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qWarning() << "Recording Error: Truncated recording in" << path;
+        return false;
+    }
+    return true;
+}
+
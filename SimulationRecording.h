@@ -0,0 +1,91 @@
+#ifndef SIMULATIONRECORDING_H
+#define SIMULATIONRECORDING_H
+
+#include "ConsumptionModel.h"
+#include "RateScheduler.h"
+
+#include <QString>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct RecordedVehicle
+ * @brief Initial kinematic state of one simulation slot.
+ *
+ * Identity fields are kept only so a replayed run can be reported against
+ * the original tracks; they do not influence the simulation.
+ */
+struct RecordedVehicle {
+    QString trackId;
+    QString callsign;
+    double posX = 0.0;
+    double posY = 0.0;
+    double speed = 0.0;
+    double heading = 0.0;
+    double targetSpeed = 0.0;
+    double distanceToTarget = 0.0;
+    double fuelLevel = 0.0;
+    double ammunitionLevel = 0.0;
+    ConsumptionProfile consumption; ///< Resolved coefficients, so replays survive table changes
+    std::uint32_t routeOffset = 0;  ///< Route slice in SimulationRecording::routeX/routeY
+    std::uint32_t routeLength = 0;
+    std::uint32_t routeCursor = 0;
+    bool routeLoop = false;
+    double turnRate = 0.0;          ///< Steering authority (degrees per second)
+    QString priority;               ///< Selects the rate group on replay
+    std::uint32_t pendingSteps = 0; ///< Steps since the slot was last integrated
+};
+
+/**
+ * @struct TargetChange
+ * @brief Mission target in effect from a given simulation step onward.
+ */
+struct TargetChange {
+    std::uint64_t step = 0;
+    double targetX = 0.0;
+    double targetY = 0.0;
+};
+
+/**
+ * @struct SimulationRecording
+ * @brief Compact description of a deterministic simulation run.
+ *
+ * Captures everything that determines the outcome: seed, fixed timestep,
+ * starting step, initial slot states (in slot order) and the mission target
+ * history. Replaying it reproduces the run bit-exactly; finalDigest is used
+ * to verify that.
+ */
+struct SimulationRecording {
+    // --- Run Parameters ---
+    std::uint64_t seed = 0;
+    std::uint64_t startStep = 0;
+    std::uint64_t startClock = 0;  ///< Simulated microseconds at startStep (jitter seconds count from it)
+    std::uint64_t stepCount = 0;   ///< Steps advanced while recording
+    double timestep = 1.0;         ///< Fixed timestep (seconds)
+    RateScheduler::Divisors rateDivisors{{1, 1, 1, 1}}; ///< Update divisors per rate class
+
+    // --- Initial State & Inputs ---
+    std::vector<RecordedVehicle> vehicles;
+    std::vector<double> routeX;    ///< Route waypoint arena (simulation frame, meters)
+    std::vector<double> routeY;
+    std::vector<TargetChange> targets;
+
+    // --- Verification ---
+    std::uint64_t finalDigest = 0; ///< SimulationKernel::digest() after stepCount steps
+
+    // --- Persistence ---
+    /**
+     * @brief Writes the recording as a versioned binary stream.
+     * @return false if the file could not be written.
+     */
+    bool save(const QString &path) const;
+
+    /**
+     * @brief Reads a recording written by save().
+     * @return false on I/O error, unknown format or truncated data.
+     */
+    bool load(const QString &path);
+};
+
+#endif // SIMULATIONRECORDING_H
@@ -0,0 +1,630 @@
+#include "TacticalMapView.h"
+#include "ClusterIndex.h"
+#include "PerformanceMonitor.h"
+#include "TacticalVehicle.h"
+#include "TacticalVehicleController.h"
+
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPaintEvent>
+#include <QPolygonF>
+#include <QRegion>
+#include <QStringList>
+#include <QTimer>
+#include <QToolTip>
+#include <QWheelEvent>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// --- Rendering & Interaction ---
+// Frame pipeline, level-of-detail selection and dirty-region tracking
+
+namespace {
+constexpr int FRAME_MS = 16;              ///< ~60 Hz while visible
+constexpr int SYMBOL_SIZE = 22;           ///< Symbol edge (logical pixels)
+constexpr int CELL_SIZE = 6;              ///< Density cell edge (logical pixels)
+constexpr std::size_t MAX_SYMBOLS = 4000; ///< On-screen tracks above which density cells are drawn
+constexpr int MAX_DIRTY_RECTS = 256;      ///< Beyond this a full repaint is cheaper than a region
+constexpr std::int32_t NOT_DRAWN = std::numeric_limits<std::int32_t>::min();
+
+constexpr double CLUSTER_PIXELS = 48.0;   ///< Minimum on-screen cluster cell edge
+
+const char* const AFFILIATION_NAMES[CLUSTER_AFFILIATION_COUNT] = {"Friendly", "Hostile", "Neutral", "Unknown"};
+const char* const DOMAIN_NAMES[CLUSTER_DOMAIN_COUNT] = {"Land", "Sea", "Air", "Subsurface", "Space", "Other"};
+
+std::uint8_t affiliationClassFor(const QString& affiliation) {
+    if (affiliation.contains("Friendly", Qt::CaseInsensitive)) return ClusterFriendly;
+    if (affiliation.contains("Hostile", Qt::CaseInsensitive)) return ClusterHostile;
+    if (affiliation.contains("Neutral", Qt::CaseInsensitive)) return ClusterNeutral;
+    return ClusterUnknown;
+}
+
+// Colours match the results table
+QColor colorFor(std::uint8_t affiliation) {
+    switch (affiliation) {
+    case ClusterFriendly: return QColor(0, 162, 232);
+    case ClusterHostile:  return QColor(Qt::red);
+    default:                  return QColor(Qt::white);
+    }
+}
+
+const QColor BACKGROUND(18, 22, 28);
+
+// Badge radius grows with the log of the count, within one cluster cell
+double clusterRadius(std::uint32_t count) {
+    return std::min(CLUSTER_PIXELS * 0.45, 7.0 + 3.0 * std::log2(double(count)));
+}
+
+QString clusterLabel(std::uint32_t count) {
+    return count >= 10000 ? QString::number(count / 1000) + "k"
+         : count >= 1000  ? QString::number(count / 1000.0, 'f', 1) + "k"
+                          : QString::number(count);
+}
+}
+
+// --- Lifecycle ---
+TacticalMapView::TacticalMapView(const TacticalVehicleController& controller, Clock displayTime, QWidget *parent)
+    : QWidget(parent), m_controller(controller), m_displayTime(std::move(displayTime)) {
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    setMinimumSize(200, 200);
+    setMouseTracking(true);
+
+    m_frameTimer = new QTimer(this);
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    m_frameTimer->setInterval(FRAME_MS);
+    connect(m_frameTimer, &QTimer::timeout, this, &TacticalMapView::advanceFrame);
+}
+
+void TacticalMapView::invalidateTracks() {
+    m_tracksValid = false;
+    m_fitted = false;
+}
+
+void TacticalMapView::fitToTracks() {
+    double minX = std::numeric_limits<double>::infinity();
+    double minY = minX;
+    double maxX = -minX;
+    double maxY = -minX;
+    for (std::size_t slot = 0; slot < m_posX.size(); ++slot) {
+        if (std::isfinite(m_posX[slot]) && std::isfinite(m_posY[slot])) {
+            minX = std::min(minX, m_posX[slot]);
+            maxX = std::max(maxX, m_posX[slot]);
+            minY = std::min(minY, m_posY[slot]);
+            maxY = std::max(maxY, m_posY[slot]);
+        }
+    }
+    if (minX > maxX) {
+        return;
+    }
+
+    m_centerX = (minX + maxX) * 0.5;
+    m_centerY = (minY + maxY) * 0.5;
+    const double spanX = std::max(maxX - minX, 100.0);
+    const double spanY = std::max(maxY - minY, 100.0);
+    m_scale = 0.9 * std::min(width() / spanX, height() / spanY);
+    m_fitted = true;
+    m_viewChanged = true;
+}
+
+// --- Frame Pipeline ---
+/**
+ * @brief Extrapolates all tracks, picks the level of detail and schedules a
+ *        repaint of what changed.
+ */
+void TacticalMapView::advanceFrame() {
+    if (!m_tracksValid && !rebuildTracks()) {
+        return;
+    }
+    if (m_controller.kinematicState().size() != m_slotCount && !rebuildTracks()) {
+        return;
+    }
+
+    m_controller.extrapolateAll(m_displayTime(), m_posX.data(), m_posY.data(), m_distance.data());
+    if (!m_fitted) {
+        fitToTracks();
+    }
+
+    // Level of detail: clusters while tracks would overlap on screen,
+    // otherwise by the number of tracks on screen
+    const ClusterIndex& index = m_controller.clusters();
+    const int level = m_controller.isClusteringEnabled() && index.size() == m_slotCount
+                    ? index.levelFor(m_scale, CLUSTER_PIXELS) : -1;
+
+    const double left = m_centerX - width() * 0.5 / m_scale;
+    const double right = m_centerX + width() * 0.5 / m_scale;
+    const double bottom = m_centerY - height() * 0.5 / m_scale;
+    const double top = m_centerY + height() * 0.5 / m_scale;
+    std::size_t onScreen = 0;
+    for (std::size_t slot = 0; level < 0 && slot < m_slotCount && onScreen <= MAX_SYMBOLS; ++slot) {
+        if (m_posX[slot] >= left && m_posX[slot] <= right && m_posY[slot] >= bottom && m_posY[slot] <= top) {
+            ++onScreen;
+        }
+    }
+    const Detail detail = level >= 0 ? Detail::Clusters
+                        : onScreen > MAX_SYMBOLS ? Detail::Density : Detail::Symbols;
+
+    bool fullRepaint = m_viewChanged || detail != m_detail;
+    m_detail = detail;
+    m_viewChanged = false;
+
+    QRegion dirty;
+    switch (m_detail) {
+    case Detail::Symbols:
+        layoutSymbols(dirty, fullRepaint);
+        break;
+    case Detail::Clusters:
+        layoutClusters(level, left, bottom, right, top, dirty, fullRepaint);
+        break;
+    case Detail::Density:
+        layoutDensity(dirty, fullRepaint);
+        break;
+    }
+
+    if (fullRepaint) {
+        update();
+    } else if (!dirty.isEmpty()) {
+        update(dirty);
+    }
+}
+
+/**
+ * @brief Resolves affiliation and symbol per slot; false while the
+ *        simulation has not published its slots yet.
+ */
+bool TacticalMapView::rebuildTracks() {
+    const std::size_t count = m_controller.kinematicState().size();
+    if (count == 0 || !m_controller.vehicleForSlot(count - 1)) {
+        return false;
+    }
+
+    m_slotCount = count;
+    m_affiliation.resize(count);
+    m_symbol.resize(count);
+    for (std::size_t slot = 0; slot < count; ++slot) {
+        const TacticalVehicle *vehicle = m_controller.vehicleForSlot(slot);
+        m_affiliation[slot] = affiliationClassFor(vehicle->affiliation);
+        m_symbol[slot] = symbolFor(*vehicle);
+    }
+
+    m_posX.resize(count);
+    m_posY.resize(count);
+    m_distance.resize(count);
+    m_symbolX.assign(count, NOT_DRAWN);
+    m_symbolY.assign(count, NOT_DRAWN);
+    m_drawnSlots.clear();
+    m_tracksValid = true;
+    m_viewChanged = true;
+    return true;
+}
+
+/**
+ * @brief Places the symbols of all on-screen tracks.
+ */
+void TacticalMapView::layoutSymbols(QRegion& dirty, bool& fullRepaint) {
+    int dirtyRects = 0;
+    m_drawnSlots.clear();
+    for (std::size_t slot = 0; slot < m_slotCount; ++slot) {
+        placeSymbol(slot, dirty, dirtyRects, fullRepaint);
+    }
+}
+
+/**
+ * @brief Re-queries the clusters when the index or view changed, then
+ *        places the symbols of single-track clusters.
+ *
+ * Clusters only change when the simulation publishes, so between ticks a
+ * frame only moves the dead-reckoned single tracks.
+ */
+void TacticalMapView::layoutClusters(int level, double left, double bottom, double right, double top,
+                                     QRegion& dirty, bool& fullRepaint) {
+    const ClusterIndex& index = m_controller.clusters();
+    if (fullRepaint || level != m_clusterLevel || index.revision() != m_clusterRevision) {
+        // Margin of one cell, so badges whose centroid is just outside still show
+        const double margin = index.cellSize(level);
+        m_clusters.clear();
+        index.query(level, left - margin, bottom - margin, right + margin, top + margin, m_clusters);
+        m_clusterLevel = level;
+        m_clusterRevision = index.revision();
+
+        std::fill(m_symbolX.begin(), m_symbolX.end(), NOT_DRAWN);
+        std::fill(m_symbolY.begin(), m_symbolY.end(), NOT_DRAWN);
+        fullRepaint = true;
+    }
+
+    int dirtyRects = 0;
+    m_drawnSlots.clear();
+    for (const ClusterSummary& cluster : m_clusters) {
+        if (cluster.count == 1 && cluster.slot < m_slotCount) {
+            placeSymbol(cluster.slot, dirty, dirtyRects, fullRepaint);
+        }
+    }
+}
+
+/**
+ * @brief Positions one symbol; a symbol that moved by at least one pixel
+ *        dirties its old and new rectangle.
+ */
+void TacticalMapView::placeSymbol(std::size_t slot, QRegion& dirty, int& dirtyRects, bool& fullRepaint) {
+    const int half = SYMBOL_SIZE / 2;
+    const double sx = screenX(m_posX[slot]);
+    const double sy = screenY(m_posY[slot]);
+    const bool visible = sx > -half && sx < width() + half && sy > -half && sy < height() + half;
+
+    const std::int32_t x = visible ? static_cast<std::int32_t>(std::lround(sx)) : NOT_DRAWN;
+    const std::int32_t y = visible ? static_cast<std::int32_t>(std::lround(sy)) : NOT_DRAWN;
+    if (visible) {
+        m_drawnSlots.push_back(static_cast<std::uint32_t>(slot));
+    }
+    if (x == m_symbolX[slot] && y == m_symbolY[slot]) {
+        return;
+    }
+
+    if (!fullRepaint) {
+        if (m_symbolX[slot] != NOT_DRAWN) {
+            dirty += QRect(m_symbolX[slot] - half, m_symbolY[slot] - half, SYMBOL_SIZE, SYMBOL_SIZE);
+            ++dirtyRects;
+        }
+        if (visible) {
+            dirty += QRect(x - half, y - half, SYMBOL_SIZE, SYMBOL_SIZE);
+            ++dirtyRects;
+        }
+        if (dirtyRects > MAX_DIRTY_RECTS) {
+            fullRepaint = true;
+            dirty = QRegion();
+        }
+    }
+    m_symbolX[slot] = x;
+    m_symbolY[slot] = y;
+}
+
+/**
+ * @brief Bins on-screen tracks into cells and renders one pixel per cell;
+ *        runs of changed pixels on a row become the dirty rectangles.
+ */
+void TacticalMapView::layoutDensity(QRegion& dirty, bool& fullRepaint) {
+    const int columns = (width() + CELL_SIZE - 1) / CELL_SIZE;
+    const int rows = (height() + CELL_SIZE - 1) / CELL_SIZE;
+    if (columns <= 0 || rows <= 0) {
+        return;
+    }
+
+    // Symbols are redrawn from scratch when the detail switches back
+    std::fill(m_symbolX.begin(), m_symbolX.end(), NOT_DRAWN);
+    std::fill(m_symbolY.begin(), m_symbolY.end(), NOT_DRAWN);
+    m_drawnSlots.clear();
+
+    m_cellCounts.assign(static_cast<std::size_t>(columns) * rows * CLUSTER_AFFILIATION_COUNT, 0);
+    const double inverseCell = 1.0 / CELL_SIZE;
+    for (std::size_t slot = 0; slot < m_slotCount; ++slot) {
+        const double cx = screenX(m_posX[slot]) * inverseCell;
+        const double cy = screenY(m_posY[slot]) * inverseCell;
+        if (cx < 0.0 || cy < 0.0 || cx >= columns || cy >= rows) {
+            continue;
+        }
+        const std::size_t cell = static_cast<std::size_t>(cy) * columns + static_cast<std::size_t>(cx);
+        ++m_cellCounts[cell * CLUSTER_AFFILIATION_COUNT + m_affiliation[slot]];
+    }
+
+    std::swap(m_density, m_previousDensity);
+    if (m_density.width() != columns || m_density.height() != rows) {
+        m_density = QImage(columns, rows, QImage::Format_ARGB32_Premultiplied);
+        fullRepaint = true;
+    }
+
+    for (int row = 0; row < rows; ++row) {
+        QRgb *pixels = reinterpret_cast<QRgb*>(m_density.scanLine(row));
+        for (int column = 0; column < columns; ++column) {
+            const std::uint32_t *counts = &m_cellCounts[(static_cast<std::size_t>(row) * columns + column) * CLUSTER_AFFILIATION_COUNT];
+            std::uint32_t total = 0;
+            std::uint8_t majority = 0;
+            for (std::uint8_t a = 0; a < CLUSTER_AFFILIATION_COUNT; ++a) {
+                total += counts[a];
+                if (counts[a] > counts[majority]) {
+                    majority = a;
+                }
+            }
+            if (total == 0) {
+                pixels[column] = 0;
+                continue;
+            }
+            // Opacity grows with the log of the count, so dense clusters
+            // stay distinguishable from single tracks
+            const int alpha = std::min(255, 90 + static_cast<int>(40.0 * std::log2(double(total))));
+            const QColor color = colorFor(majority);
+            pixels[column] = qPremultiply(qRgba(color.red(), color.green(), color.blue(), alpha));
+        }
+    }
+
+    if (fullRepaint || m_previousDensity.size() != m_density.size()) {
+        fullRepaint = true;
+        return;
+    }
+
+    int dirtyRects = 0;
+    for (int row = 0; row < rows; ++row) {
+        const QRgb *current = reinterpret_cast<const QRgb*>(m_density.constScanLine(row));
+        const QRgb *previous = reinterpret_cast<const QRgb*>(m_previousDensity.constScanLine(row));
+        int column = 0;
+        while (column < columns) {
+            if (current[column] == previous[column]) {
+                ++column;
+                continue;
+            }
+            const int first = column;
+            while (column < columns && current[column] != previous[column]) {
+                ++column;
+            }
+            dirty += QRect(first * CELL_SIZE, row * CELL_SIZE, (column - first) * CELL_SIZE, CELL_SIZE);
+            if (++dirtyRects > MAX_DIRTY_RECTS) {
+                fullRepaint = true;
+                dirty = QRegion();
+                return;
+            }
+        }
+    }
+}
+
+// --- Symbol Cache ---
+std::uint16_t TacticalMapView::symbolFor(const TacticalVehicle& vehicle) {
+    const std::uint8_t affiliation = affiliationClassFor(vehicle.affiliation);
+    const QString key = QString("%1|%2").arg(affiliation).arg(vehicle.natoIcon);
+
+    auto it = m_symbolIndex.find(key);
+    if (it != m_symbolIndex.end()) {
+        return it.value();
+    }
+    const std::uint16_t index = static_cast<std::uint16_t>(m_symbols.size());
+    m_symbols.push_back(renderSymbol(affiliation, vehicle.natoIcon));
+    m_symbolIndex.insert(key, index);
+    return index;
+}
+
+/**
+ * @brief Renders one symbol: APP-6 frame by affiliation (rectangle,
+ *        diamond, square, circle) and the function code of the SIDC.
+ */
+QPixmap TacticalMapView::renderSymbol(std::uint8_t affiliation, const QString& natoIcon) const {
+    const qreal ratio = devicePixelRatioF();
+    QPixmap pixmap(QSize(SYMBOL_SIZE, SYMBOL_SIZE) * ratio);
+    pixmap.setDevicePixelRatio(ratio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+    const QColor color = colorFor(affiliation);
+    painter.setPen(QPen(color, 1.5));
+    painter.setBrush(QColor(color.red(), color.green(), color.blue(), 60));
+
+    const QRectF frame(2.0, 2.0, SYMBOL_SIZE - 4.0, SYMBOL_SIZE - 4.0);
+    switch (affiliation) {
+    case ClusterFriendly:
+        painter.drawRect(frame.adjusted(0.0, 3.0, 0.0, -3.0));
+        break;
+    case ClusterHostile: {
+        const QPointF c = frame.center();
+        const qreal r = frame.width() / 2.0;
+        painter.drawPolygon(QPolygonF({QPointF(c.x(), c.y() - r), QPointF(c.x() + r, c.y()),
+                                       QPointF(c.x(), c.y() + r), QPointF(c.x() - r, c.y())}));
+        break;
+    }
+    case ClusterNeutral:
+        painter.drawRect(frame.adjusted(1.0, 1.0, -1.0, -1.0));
+        break;
+    default:
+        painter.drawEllipse(frame);
+        break;
+    }
+
+    // SIDC positions 5-10 hold the function ID; the first two characters
+    // are enough to tell symbols apart at this size
+    const QString function = natoIcon.mid(4, 6).remove('-').left(2);
+    if (!function.isEmpty()) {
+        QFont font = painter.font();
+        font.setPixelSize(8);
+        font.setBold(true);
+        painter.setFont(font);
+        painter.drawText(frame, Qt::AlignCenter, function);
+    }
+    return pixmap;
+}
+
+// --- Rendering ---
+void TacticalMapView::paintEvent(QPaintEvent *event) {
+    ScopedLatency latency(LatencyRender);
+    QPainter painter(this);
+    painter.fillRect(event->rect(), BACKGROUND);
+
+    if (!m_tracksValid) {
+        painter.setPen(Qt::gray);
+        painter.drawText(rect(), Qt::AlignCenter, "Waiting for simulation...");
+        return;
+    }
+
+    if (m_detail == Detail::Density) {
+        // One pixel per cell, scaled without filtering
+        painter.drawImage(QRect(0, 0, m_density.width() * CELL_SIZE, m_density.height() * CELL_SIZE), m_density);
+    } else {
+        const QRect area = event->rect();
+        if (m_detail == Detail::Clusters) {
+            paintClusters(painter, area);
+        }
+        const int half = SYMBOL_SIZE / 2;
+        for (const std::uint32_t slot : m_drawnSlots) {
+            const QRect bounds(m_symbolX[slot] - half, m_symbolY[slot] - half, SYMBOL_SIZE, SYMBOL_SIZE);
+            if (area.intersects(bounds)) {
+                painter.drawPixmap(bounds.topLeft(), m_symbols[m_symbol[slot]]);
+            }
+        }
+    }
+
+    // Scale bar: 1/5 of the width, rounded to 1-2-5 meters
+    const double targetMeters = width() / 5.0 / m_scale;
+    const double magnitude = std::pow(10.0, std::floor(std::log10(targetMeters)));
+    const double step = targetMeters / magnitude >= 5.0 ? 5.0 : targetMeters / magnitude >= 2.0 ? 2.0 : 1.0;
+    const double meters = step * magnitude;
+    const int barLength = static_cast<int>(meters * m_scale);
+    const QRect scaleArea(8, height() - 28, barLength + 80, 22);
+    if (event->rect().intersects(scaleArea)) {
+        const int y = height() - 12;
+        painter.setPen(QPen(Qt::lightGray, 2));
+        painter.drawLine(12, y, 12 + barLength, y);
+        painter.drawLine(12, y - 4, 12, y + 4);
+        painter.drawLine(12 + barLength, y - 4, 12 + barLength, y + 4);
+        const QString label = meters >= 1000.0 ? QString::number(meters / 1000.0) + " km"
+                                               : QString::number(meters) + " m";
+        painter.drawText(QPoint(18 + barLength, y + 4), label);
+    }
+}
+
+/**
+ * @brief Draws multi-track clusters as badges: a ring split by affiliation
+ *        around the track count.
+ */
+void TacticalMapView::paintClusters(QPainter& painter, const QRect& area) const {
+    painter.save();
+    painter.setRenderHint(QPainter::Antialiasing);
+    QFont font = painter.font();
+    font.setPixelSize(10);
+    font.setBold(true);
+    painter.setFont(font);
+
+    for (const ClusterSummary& cluster : m_clusters) {
+        if (cluster.count < 2) {
+            continue;
+        }
+        const double radius = clusterRadius(cluster.count);
+        const QRectF badge(screenX(cluster.x) - radius, screenY(cluster.y) - radius, 2.0 * radius, 2.0 * radius);
+        if (!area.intersects(badge.toAlignedRect())) {
+            continue;
+        }
+
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(QColor(40, 46, 56, 220));
+        painter.drawEllipse(badge);
+
+        // Ring segments in proportion to the affiliation counts (1/16 degree units)
+        int start = 90 * 16;
+        for (std::uint8_t a = 0; a < CLUSTER_AFFILIATION_COUNT; ++a) {
+            if (cluster.affiliations[a] == 0) {
+                continue;
+            }
+            const int span = static_cast<int>(5760.0 * cluster.affiliations[a] / cluster.count);
+            painter.setPen(QPen(colorFor(a), 3.0, Qt::SolidLine, Qt::FlatCap));
+            painter.drawArc(badge.adjusted(1.5, 1.5, -1.5, -1.5), start, -span);
+            start -= span;
+        }
+
+        painter.setPen(Qt::white);
+        painter.drawText(badge, Qt::AlignCenter, clusterLabel(cluster.count));
+    }
+    painter.restore();
+}
+
+void TacticalMapView::resizeEvent(QResizeEvent *event) {
+    QWidget::resizeEvent(event);
+    m_viewChanged = true;
+}
+
+void TacticalMapView::showEvent(QShowEvent *event) {
+    QWidget::showEvent(event);
+    m_viewChanged = true;
+    m_frameTimer->start();
+}
+
+void TacticalMapView::hideEvent(QHideEvent *event) {
+    QWidget::hideEvent(event);
+    m_frameTimer->stop();
+}
+
+// --- Interaction ---
+/**
+ * @brief Zooms around the cursor: the world point under it stays put.
+ */
+void TacticalMapView::wheelEvent(QWheelEvent *event) {
+    const QPointF cursor = event->position();
+    const double worldX = m_centerX + (cursor.x() - width() * 0.5) / m_scale;
+    const double worldY = m_centerY - (cursor.y() - height() * 0.5) / m_scale;
+
+    const double factor = std::pow(1.0015, event->angleDelta().y());
+    m_scale = std::clamp(m_scale * factor, 1e-5, 50.0);
+
+    m_centerX = worldX - (cursor.x() - width() * 0.5) / m_scale;
+    m_centerY = worldY + (cursor.y() - height() * 0.5) / m_scale;
+    m_viewChanged = true;
+    event->accept();
+}
+
+void TacticalMapView::mousePressEvent(QMouseEvent *event) {
+    if (event->button() == Qt::LeftButton) {
+        m_dragging = true;
+        m_dragOrigin = event->pos();
+        setCursor(Qt::ClosedHandCursor);
+    }
+}
+
+void TacticalMapView::mouseMoveEvent(QMouseEvent *event) {
+    if (!m_dragging) {
+        showClusterTip(event);
+        return;
+    }
+    const QPoint delta = event->pos() - m_dragOrigin;
+    m_dragOrigin = event->pos();
+    m_centerX -= delta.x() / m_scale;
+    m_centerY += delta.y() / m_scale;
+    m_viewChanged = true;
+}
+
+/**
+ * @brief Shows the affiliation and domain breakdown of the cluster under
+ *        the cursor.
+ */
+void TacticalMapView::showClusterTip(QMouseEvent *event) {
+    if (m_detail != Detail::Clusters) {
+        return;
+    }
+    const QPointF cursor = event->position();
+    for (const ClusterSummary& cluster : m_clusters) {
+        if (cluster.count < 2) {
+            continue;
+        }
+        const double dx = cursor.x() - screenX(cluster.x);
+        const double dy = cursor.y() - screenY(cluster.y);
+        const double radius = clusterRadius(cluster.count);
+        if (dx * dx + dy * dy > radius * radius) {
+            continue;
+        }
+
+        QStringList affiliations;
+        for (std::uint8_t a = 0; a < CLUSTER_AFFILIATION_COUNT; ++a) {
+            if (cluster.affiliations[a] != 0) {
+                affiliations << QString("%1 %2").arg(AFFILIATION_NAMES[a]).arg(cluster.affiliations[a]);
+            }
+        }
+        QStringList domains;
+        for (std::uint8_t d = 0; d < CLUSTER_DOMAIN_COUNT; ++d) {
+            if (cluster.domains[d] != 0) {
+                domains << QString("%1 %2").arg(DOMAIN_NAMES[d]).arg(cluster.domains[d]);
+            }
+        }
+        QToolTip::showText(event->globalPosition().toPoint(),
+                           QString("%1 tracks\n%2\n%3").arg(cluster.count)
+                               .arg(affiliations.join(", "), domains.join(", ")),
+                           this);
+        return;
+    }
+    QToolTip::hideText();
+}
+
+void TacticalMapView::mouseReleaseEvent(QMouseEvent *event) {
+    if (event->button() == Qt::LeftButton) {
+        m_dragging = false;
+        unsetCursor();
+    }
+}
+
+void TacticalMapView::mouseDoubleClickEvent(QMouseEvent *event) {
+    Q_UNUSED(event);
+    fitToTracks();
+}
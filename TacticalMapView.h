@@ -0,0 +1,137 @@
+#ifndef TACTICALMAPVIEW_H
+#define TACTICALMAPVIEW_H
+
+#include "ClusterIndex.h"
+
+#include <QHash>
+#include <QImage>
+#include <QPixmap>
+#include <QPoint>
+#include <QWidget>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class QPainter;
+class QTimer;
+class TacticalVehicleController;
+struct TacticalVehicle;
+
+/**
+ * @class TacticalMapView
+ * @brief 2-D plan view of all tracks with pan, zoom and level of detail.
+ *
+ * Positions are dead-reckoned to display time every frame, so tracks move
+ * smoothly between simulation ticks. Colours follow the results table
+ * (friendly blue, hostile red, others white).
+ *
+ * Level of detail:
+ *  - While tracks would overlap on screen, the controller's ClusterIndex
+ *    is queried at the level matching the zoom. Clusters are drawn as
+ *    badges (track count inside a ring split by affiliation, with the
+ *    affiliation and domain breakdown as tooltip); single tracks are drawn
+ *    as symbols.
+ *  - Zoomed in further, above MAX_SYMBOLS tracks on screen, tracks are binned into screen cells drawn as one
+ *    small density image (colour of the majority affiliation, opacity by
+ *    count), so the cost is one pass over the positions plus one blit.
+ *  - Otherwise each track is drawn as its symbol (frame by affiliation,
+ *    function code from natoIcon), blitted from a pixmap cache rendered
+ *    once per (affiliation, natoIcon).
+ *
+ * Repaints are limited to the cells or symbols that changed since the
+ * previous frame; panning, zooming and detail switches repaint everything.
+ */
+class TacticalMapView : public QWidget {
+    Q_OBJECT
+
+public:
+    using Clock = std::function<double()>;
+
+    /**
+     * @param displayTime Simulated time to extrapolate tracks to (see
+     *        TacticalVehicleController::extrapolateAll()).
+     */
+    TacticalMapView(const TacticalVehicleController& controller, Clock displayTime, QWidget *parent = nullptr);
+
+    /// Re-reads affiliations and symbols; call after the dataset was reloaded.
+    void invalidateTracks();
+
+    /// Centres and scales the view on all tracks.
+    void fitToTracks();
+
+protected:
+    // --- Rendering & Interaction ---
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+    void wheelEvent(QWheelEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void mouseDoubleClickEvent(QMouseEvent *event) override;
+
+private:
+    enum class Detail { Density, Clusters, Symbols };
+
+    // --- Frame Pipeline ---
+    void advanceFrame();
+    bool rebuildTracks();
+    void layoutSymbols(QRegion& dirty, bool& fullRepaint);
+    void layoutDensity(QRegion& dirty, bool& fullRepaint);
+    void layoutClusters(int level, double left, double bottom, double right, double top,
+                        QRegion& dirty, bool& fullRepaint);
+    void placeSymbol(std::size_t slot, QRegion& dirty, int& dirtyRects, bool& fullRepaint);
+    void paintClusters(QPainter& painter, const QRect& area) const;
+    void showClusterTip(QMouseEvent *event);
+
+    // --- Symbol Cache ---
+    std::uint16_t symbolFor(const TacticalVehicle& vehicle);
+    QPixmap renderSymbol(std::uint8_t affiliation, const QString& natoIcon) const;
+
+    // --- Coordinate Mapping ---
+    double screenX(double worldX) const { return width() * 0.5 + (worldX - m_centerX) * m_scale; }
+    double screenY(double worldY) const { return height() * 0.5 - (worldY - m_centerY) * m_scale; }
+
+    const TacticalVehicleController& m_controller;
+    Clock m_displayTime;
+    QTimer *m_frameTimer;
+
+    // --- Tracks (indexed by simIndex) ---
+    std::size_t m_slotCount = 0;
+    bool m_tracksValid = false;
+    std::vector<std::uint8_t> m_affiliation;  ///< Affiliation class per slot
+    std::vector<std::uint16_t> m_symbol;      ///< Index into m_symbols per slot
+    std::vector<double> m_posX;               ///< Extrapolated positions of the current frame
+    std::vector<double> m_posY;
+    std::vector<double> m_distance;
+
+    // --- Symbol Cache ---
+    QHash<QString, std::uint16_t> m_symbolIndex; ///< "affiliation|natoIcon" -> m_symbols index
+    std::vector<QPixmap> m_symbols;
+
+    // --- View State ---
+    double m_centerX = 0.0;   ///< World point at the widget centre (meters)
+    double m_centerY = 0.0;
+    double m_scale = 0.05;    ///< Pixels per meter
+    bool m_fitted = false;
+    bool m_viewChanged = true;
+    bool m_dragging = false;
+    QPoint m_dragOrigin;
+    Detail m_detail = Detail::Density;
+
+    // --- Frame State ---
+    std::vector<std::int32_t> m_symbolX;      ///< Drawn symbol centre per slot (INT32_MIN when not drawn)
+    std::vector<std::int32_t> m_symbolY;
+    std::vector<std::uint32_t> m_drawnSlots;  ///< Slots drawn as symbols this frame
+    std::vector<std::uint32_t> m_cellCounts;  ///< Per cell and affiliation class
+    QImage m_density;                         ///< One pixel per density cell
+    QImage m_previousDensity;
+    std::vector<ClusterSummary> m_clusters;   ///< Clusters around the viewport
+    std::uint64_t m_clusterRevision = 0;      ///< ClusterIndex::revision() of m_clusters
+    int m_clusterLevel = -1;
+};
+
+#endif // TACTICALMAPVIEW_H
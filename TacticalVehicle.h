@@ -3,6 +3,25 @@
 
 #include <QString>
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @struct RouteWaypoint
+ * @brief One waypoint of the shared route arena (TacticalVehicleData::routeWaypoints()).
+ *
+ * Cartesian (meters) or, when hasGeodetic is set, WGS-84; geodetic waypoints
+ * are projected into the simulation frame in geodetic mode.
+ */
+struct RouteWaypoint {
+    double x = 0.0;
+    double y = 0.0;
+    double latitude = 0.0;
+    double longitude = 0.0;
+    bool hasGeodetic = false;
+};
+
 /**
  * @struct TacticalVehicle
  * @brief Represents a single tactical asset within the system.
@@ -40,7 +59,36 @@ struct TacticalVehicle {
     double speed = 0.0;            ///< Current speed (km/h)
     double fuelLevel = 100.0;      ///< Remaining fuel percentage (0–100)
     double ammunitionLevel = 100.0;///< Remaining ammunition percentage (0–100)
-    double distanceToTarget = 0.0; ///< Euclidean distance to mission target (meters)
+    double distanceToTarget = 0.0; ///< Distance to mission target (meters)
+    double nearestTargetDistance = 0.0; ///< Distance to the nearest target of the mission target set (meters)
+    int nearestTargetIndex = -1;        ///< Index of that target (-1 when no target set is configured)
+
+    // --- Proximity ---
+    unsigned proximityMask = 0;    ///< Bit (1 << ProximityClass) set for each class of track within the proximity radius
+    int proximityContacts = 0;     ///< Number of interacting tracks within the proximity radius
+
+    // --- Intercept Geometry ---
+    // Most urgent opposing track (friendly <-> hostile); infinity when the vehicle is in neither set.
+    double timeToCpa = std::numeric_limits<double>::infinity();   ///< Seconds to closest point of approach
+    double cpaDistance = std::numeric_limits<double>::infinity(); ///< Separation at that CPA (meters)
+    int cpaPartner = -1;                                          ///< simIndex of the opposing track
+    double etaToTarget = std::numeric_limits<double>::infinity(); ///< Seconds to mission target at current closing speed
+
+    // --- Geodetic Position ---
+    double latitude = 0.0;         ///< WGS-84 latitude (degrees)
+    double longitude = 0.0;        ///< WGS-84 longitude (degrees)
+    bool hasGeodetic = false;      ///< Feed supplied lat/lon (projected into posX/posY in geodetic mode)
+
+    // --- Route ---
+    // Waypoints live in a flat arena owned by TacticalVehicleData; a vehicle
+    // only references its slice of it.
+    std::uint32_t routeOffset = 0; ///< First waypoint of this vehicle's route in the arena
+    std::uint32_t routeLength = 0; ///< Number of waypoints (0 = free running)
+    std::uint32_t routeCursor = 0; ///< Route-relative index of the waypoint being steered to
+    bool routeLoop = false;        ///< Restart at the first waypoint after reaching the last
+
+    // --- Simulation Binding ---
+    std::size_t simIndex = 0;      ///< Stable slot in the controller's KinematicsBuffers
 };
 
 #endif // TACTICALVEHICLE_H
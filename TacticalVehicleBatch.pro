@@ -0,0 +1,53 @@
+TEMPLATE = app
+TARGET = TacticalVehicleBatch
+
+QT = core network
+CONFIG += console
+CONFIG -= app_bundle
+
+SOURCES += \
+    BatchRunner.cpp \
+    ClusterIndex.cpp \
+    ConsumptionModel.cpp \
+    GeoProjection.cpp \
+    InterceptEngine.cpp \
+    PerformanceMonitor.cpp \
+    ProximityGrid.cpp \
+    RateScheduler.cpp \
+    ShardCoordinator.cpp \
+    ShardProtocol.cpp \
+    ShardWorker.cpp \
+    SimulationKernel.cpp \
+    SimulationRecording.cpp \
+    TacticalVehicleController.cpp \
+    TacticalVehicleData.cpp \
+    TaskScheduler.cpp \
+    ValueHistogram.cpp \
+    VehicleChangeSet.cpp \
+    batch_main.cpp
+
+HEADERS += \
+    BatchRunner.h \
+    ClusterIndex.h \
+    ConsumptionModel.h \
+    GeoProjection.h \
+    InterceptEngine.h \
+    PerformanceMonitor.h \
+    ProximityGrid.h \
+    RateScheduler.h \
+    ShardCoordinator.h \
+    ShardProtocol.h \
+    ShardWorker.h \
+    SimdSupport.h \
+    SimulationKernel.h \
+    SimulationRandom.h \
+    SimulationRecording.h \
+    TacticalVehicle.h \
+    TacticalVehicleController.h \
+    TacticalVehicleData.h \
+    TaskScheduler.h \
+    ValueHistogram.h \
+    VehicleChangeSet.h
+
+RESOURCES += \
+    resources.qrc
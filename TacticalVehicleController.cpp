@@ -1,15 +1,110 @@
 #include "TacticalVehicleController.h"
 #include "TacticalVehicleData.h"
+#include "ConsumptionModel.h"
+#include "PerformanceMonitor.h"
+#include "TaskScheduler.h"
 
-#include <cmath>
+#include <QDebug>
 #include <QRandomGenerator>
+#include <QtGlobal>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <utility>
+
+namespace {
+// Affiliations are matched like the table colouring and the map view do,
+// so a vehicle lands in the same class everywhere
+std::uint8_t proximityClassFor(const QString& affiliation) {
+    if (affiliation.contains("Friendly", Qt::CaseInsensitive)) return ProximityFriendly;
+    if (affiliation.contains("Hostile", Qt::CaseInsensitive)) return ProximityHostile;
+    return ProximityOther;
+}
+
+std::uint8_t clusterAffiliationFor(const QString& affiliation) {
+    if (affiliation.contains("Friendly", Qt::CaseInsensitive)) return ClusterFriendly;
+    if (affiliation.contains("Hostile", Qt::CaseInsensitive)) return ClusterHostile;
+    if (affiliation.contains("Neutral", Qt::CaseInsensitive)) return ClusterNeutral;
+    return ClusterUnknown;
+}
+
+std::uint8_t clusterDomainFor(const QString& domain) {
+    if (domain == "Land") return ClusterLand;
+    if (domain == "Sea") return ClusterSea;
+    if (domain == "Air") return ClusterAir;
+    if (domain == "Subsurface") return ClusterSubsurface;
+    if (domain == "Space") return ClusterSpace;
+    return ClusterOther;
+}
+
+constexpr double CLUSTER_BASE_CELL = 250.0; ///< Level-0 cluster cell edge (meters)
+
+// Tracks are swept in straight moves of at most this fraction of the
+// proximity radius, which bounds the error on curved paths
+constexpr double SWEEP_MOVE_FRACTION = 0.5;
+constexpr double KMH_PER_MPS = 3.6;
+
+// Jitter stream of a vehicle: FNV-1a over its track ID and callsign, so the
+// draws follow the vehicle rather than its slot
+std::uint64_t streamKeyFor(const TacticalVehicle& v) {
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    auto mix = [&hash](const QString& text) {
+        for (const QChar c : text) {
+            hash = (hash ^ c.unicode()) * 0x100000001B3ULL;
+        }
+        hash = (hash ^ 0xFFu) * 0x100000001B3ULL; // Separator
+    };
+    mix(v.trackId);
+    mix(v.callsign);
+    return hash;
+}
+
+// Route steering authority (degrees per second) by propulsion
+double turnRateFor(const QString& propulsion) {
+    if (propulsion == "Aerial") return 3.0;   // Standard-rate turn
+    if (propulsion == "Maritime") return 2.0;
+    return 15.0;
+}
+
+RateClass rateClassFor(const QString& priority) {
+    if (priority == "Flash") return RateFlash;
+    if (priority == "High") return RateHigh;
+    if (priority == "Low") return RateLow;
+    return RateRoutine;
+}
+
+// Interacting group pairs (group = ProximityClass * 2 + aerial):
+// friendly <-> hostile in any domain, and friendly air <-> friendly air.
+constexpr std::uint8_t FRIENDLY_GROUND = ProximityFriendly * 2;
+constexpr std::uint8_t FRIENDLY_AIR    = ProximityFriendly * 2 + 1;
+constexpr std::uint8_t HOSTILE_GROUND  = ProximityHostile * 2;
+constexpr std::uint8_t HOSTILE_AIR     = ProximityHostile * 2 + 1;
+constexpr std::uint8_t HOSTILE_ANY     = (1u << HOSTILE_GROUND) | (1u << HOSTILE_AIR);
+constexpr std::uint8_t FRIENDLY_ANY    = (1u << FRIENDLY_GROUND) | (1u << FRIENDLY_AIR);
+
+constexpr std::uint8_t PROXIMITY_INTERACTIONS[8] = {
+    0,                                   // Other, ground
+    0,                                   // Other, air
+    HOSTILE_ANY,                         // Friendly, ground
+    HOSTILE_ANY | (1u << FRIENDLY_AIR),  // Friendly, air
+    FRIENDLY_ANY,                        // Hostile, ground
+    FRIENDLY_ANY,                        // Hostile, air
+    0, 0
+};
+}
 
 /**
  * @brief Binds the controller to the shared TacticalVehicleData store.
  *
  * The controller operates purely on model data and owns no UI state.
+ * The simulation random source is seeded non-deterministically by default;
+ * use setRandomSeed() for reproducible runs.
  */
-TacticalVehicleController::TacticalVehicleController(TacticalVehicleData& data) : data(data) {
+TacticalVehicleController::TacticalVehicleController(TacticalVehicleData& data)
+    : data(data), random(QRandomGenerator::global()->generate64()) {
+    rebuildSupplyThresholds();
 }
 
 // --- Filtering Logic ---
@@ -20,109 +115,206 @@ TacticalVehicleController::TacticalVehicleController(TacticalVehicleData& data)
 // (visibility, selections, ranges) is resolved by MainWindow
 // before being passed here as primitive values.
 void TacticalVehicleController::applyFilter(const FilterCriteria& criteria) {
-    filteredVehicles.clear();
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    installFilter(criteria, evaluate(criteria, nullptr));
+}
 
-    for (const auto& vehicle : data.vehicles()) {
+std::vector<const TacticalVehicle*> TacticalVehicleController::evaluateFilter(const FilterCriteria& criteria,
+                                                                              const std::atomic<bool>* cancelled) const {
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    return evaluate(criteria, cancelled);
+}
 
-        // Default to permissive matching; constraints narrow results
-        bool capabilityMatch     = true;
-        bool callsignMatch       = true;
-        bool trackIdMatch        = true;
-        bool domainMatch         = true;
-        bool propulsionMatch     = true;
-        bool priorityMatch       = true;
-        bool protectionMatchMin  = true;
-        bool protectionMatchMax  = true;
-        bool fuelMatchMin        = true;
-        bool fuelMatchMax        = true;
-        bool distanceMatchMin    = true;
-        bool distanceMatchMax    = true;
-        bool affiliationMatch    = true;
+void TacticalVehicleController::installFilter(const FilterCriteria& criteria,
+                                              std::vector<const TacticalVehicle*> result) {
+    filteredVehicles = std::move(result);
+    ++filterGeneration;
 
-        // --- Capability Flags ---
-        if (criteria.hasSatCom && !vehicle.hasSatCom) {
-            capabilityMatch = false;
-        }
-        if (criteria.isAmphibious && !vehicle.isAmphibious) {
-            capabilityMatch = false;
-        }
-        if (criteria.isUnmanned && !vehicle.isUnmanned) {
-            capabilityMatch = false;
-        }
-        if (criteria.hasActiveDefense && !vehicle.hasActiveDefense) {
-            capabilityMatch = false;
-        }
+    // Fuel only decreases, so the view can change only when a level drops
+    // below the band; watching those two levels replaces a per-step rescan.
+    const bool bandChanged = !filterApplied ||
+                             activeCriteria.fuelMin != criteria.fuelMin ||
+                             activeCriteria.fuelMax != criteria.fuelMax;
+    activeCriteria = criteria;
+    filterApplied = true;
+    if (bandChanged) {
+        rebuildSupplyThresholds();
+    }
+}
 
-        // --- Identity Filters ---
-        if (criteria.callsignActive && vehicle.callsign != criteria.callsign) {
-            callsignMatch = false;
-        }
+/**
+ * @brief Matches criteria against the published records; the caller holds
+ *        recordsMutex.
+ *
+ * Does not modify the controller, so it may run on a worker thread. When
+ * cancelled reads true, chunks stop early and the (partial) result is
+ * meant to be discarded.
+ */
+std::vector<const TacticalVehicle*> TacticalVehicleController::evaluate(const FilterCriteria& criteria,
+                                                                        const std::atomic<bool>* cancelled) const {
+    ScopedLatency latency(LatencyFilter);
 
-        if (criteria.trackIdActive && vehicle.trackId != criteria.trackId) {
-            trackIdMatch = false;
-        }
+    // A specific mission target is only usable once the matrix covers the dataset
+    const bool targetIndexValid =
+        criteria.distanceTargetIndex >= 0 &&
+        static_cast<std::size_t>(criteria.distanceTargetIndex) < targetMatrix.targetCount() &&
+        kinematicsBound && boundRevision == data.revision() &&
+        targetMatrix.vehicleCount == data.vehicles().size();
 
-        // --- Strategic Classification ---
-        if (criteria.domainActive && vehicle.domain != criteria.domain) {
-            domainMatch = false;
-        }
+    // Chunks are evaluated in parallel and concatenated in dataset order
+    constexpr std::size_t MIN_VEHICLES_PER_TASK = 8192;
+    constexpr std::size_t CANCEL_CHECK_INTERVAL = 1024;
+    const std::deque<TacticalVehicle>& vehicles = data.vehicles();
+    TaskScheduler& scheduler = TaskScheduler::shared();
+    std::mutex partsMutex;
+    std::vector<std::pair<std::size_t, std::vector<const TacticalVehicle*>>> parts;
 
-        if (criteria.propulsionActive && vehicle.propulsion != criteria.propulsion) {
-            propulsionMatch = false;
-        }
+    scheduler.parallelFor("filter.evaluate", 0, vehicles.size(), MIN_VEHICLES_PER_TASK, scheduler.concurrency() * 4,
+                          [&](std::size_t begin, std::size_t end) {
+        std::vector<const TacticalVehicle*> matched;
+        for (std::size_t i = begin; i < end; ++i) {
+            if (cancelled && (i - begin) % CANCEL_CHECK_INTERVAL == 0 && cancelled->load(std::memory_order_relaxed)) {
+                return;
+            }
+            const TacticalVehicle& vehicle = vehicles[i];
 
-        if (criteria.priorityActive && vehicle.priority != criteria.priority) {
-            priorityMatch = false;
-        }
+            // Default to permissive matching; constraints narrow results
+            bool capabilityMatch     = true;
+            bool callsignMatch       = true;
+            bool trackIdMatch        = true;
+            bool domainMatch         = true;
+            bool propulsionMatch     = true;
+            bool priorityMatch       = true;
+            bool protectionMatchMin  = true;
+            bool protectionMatchMax  = true;
+            bool fuelMatchMin        = true;
+            bool fuelMatchMax        = true;
+            bool distanceMatchMin    = true;
+            bool distanceMatchMax    = true;
+            bool affiliationMatch    = true;
+            bool proximityMatch      = true;
+            bool interceptMatch      = true;
 
-        // --- Protection Constraints ---
-        if (criteria.protectionMinActive && vehicle.protectionLevel < criteria.protectionMin) {
-            protectionMatchMin = false;
-        }
+            // --- Capability Flags ---
+            if (criteria.hasSatCom && !vehicle.hasSatCom) {
+                capabilityMatch = false;
+            }
+            if (criteria.isAmphibious && !vehicle.isAmphibious) {
+                capabilityMatch = false;
+            }
+            if (criteria.isUnmanned && !vehicle.isUnmanned) {
+                capabilityMatch = false;
+            }
+            if (criteria.hasActiveDefense && !vehicle.hasActiveDefense) {
+                capabilityMatch = false;
+            }
 
-        if (criteria.protectionMaxActive && vehicle.protectionLevel > criteria.protectionMax) {
-            protectionMatchMax = false;
-        }
+            // --- Identity Filters ---
+            if (criteria.callsignActive && vehicle.callsign != criteria.callsign) {
+                callsignMatch = false;
+            }
 
-        // --- Telemetry Ranges ---
-        if (vehicle.fuelLevel < criteria.fuelMin) {
-            fuelMatchMin = false;
-        }
-        if (vehicle.fuelLevel > criteria.fuelMax) {
-            fuelMatchMax = false;
-        }
+            if (criteria.trackIdActive && vehicle.trackId != criteria.trackId) {
+                trackIdMatch = false;
+            }
 
-        if (vehicle.distanceToTarget < criteria.distanceMin) {
-            distanceMatchMin = false;
-        }
-        if (criteria.distanceMax < 10000 && vehicle.distanceToTarget > criteria.distanceMax) {
-            distanceMatchMax = false;
-        }
+            // --- Strategic Classification ---
+            if (criteria.domainActive && vehicle.domain != criteria.domain) {
+                domainMatch = false;
+            }
 
-        // --- Affiliation ---
-        if (criteria.affiliation != "All Types" &&
-            vehicle.affiliation != criteria.affiliation) {
-            affiliationMatch = false;
-        }
+            if (criteria.propulsionActive && vehicle.propulsion != criteria.propulsion) {
+                propulsionMatch = false;
+            }
 
-        // --- FINAL EVALUATION ---
-        if (capabilityMatch &&
-            callsignMatch &&
-            trackIdMatch &&
-            domainMatch &&
-            propulsionMatch &&
-            priorityMatch &&
-            protectionMatchMin &&
-            protectionMatchMax &&
-            fuelMatchMin &&
-            fuelMatchMax &&
-            distanceMatchMin &&
-            distanceMatchMax &&
-            affiliationMatch) {
+            if (criteria.priorityActive && vehicle.priority != criteria.priority) {
+                priorityMatch = false;
+            }
 
-            filteredVehicles.push_back(&vehicle);
+            // --- Protection Constraints ---
+            if (criteria.protectionMinActive && vehicle.protectionLevel < criteria.protectionMin) {
+                protectionMatchMin = false;
+            }
+
+            if (criteria.protectionMaxActive && vehicle.protectionLevel > criteria.protectionMax) {
+                protectionMatchMax = false;
+            }
+
+            // --- Telemetry Ranges ---
+            if (vehicle.fuelLevel < criteria.fuelMin) {
+                fuelMatchMin = false;
+            }
+            if (vehicle.fuelLevel > criteria.fuelMax) {
+                fuelMatchMax = false;
+            }
+
+            double distance = vehicle.distanceToTarget;
+            if (criteria.distanceReference == DistanceReference::NearestTarget) {
+                distance = vehicle.nearestTargetDistance;
+            } else if (criteria.distanceReference == DistanceReference::MissionTarget && targetIndexValid) {
+                distance = targetMatrix.at(criteria.distanceTargetIndex, vehicle.simIndex);
+            }
+
+            if (distance < criteria.distanceMin) {
+                distanceMatchMin = false;
+            }
+            if (criteria.distanceMax < 10000 && distance > criteria.distanceMax) {
+                distanceMatchMax = false;
+            }
+
+            // --- Affiliation ---
+            if (criteria.affiliation != "All Types" &&
+                vehicle.affiliation != criteria.affiliation) {
+                affiliationMatch = false;
+            }
+
+            // --- Intercept ---
+            if (criteria.interceptActive &&
+                !(vehicle.cpaDistance <= interceptRange && vehicle.timeToCpa <= criteria.interceptWithinSeconds)) {
+                interceptMatch = false;
+            }
+
+            // --- Proximity ---
+            if (criteria.proximityActive &&
+                !(vehicle.proximityMask & (1u << proximityClassFor(criteria.proximityAffiliation)))) {
+                proximityMatch = false;
+            }
+
+            // --- FINAL EVALUATION ---
+            if (capabilityMatch &&
+                callsignMatch &&
+                trackIdMatch &&
+                domainMatch &&
+                propulsionMatch &&
+                priorityMatch &&
+                protectionMatchMin &&
+                protectionMatchMax &&
+                fuelMatchMin &&
+                fuelMatchMax &&
+                distanceMatchMin &&
+                distanceMatchMax &&
+                affiliationMatch &&
+                proximityMatch &&
+                interceptMatch) {
+
+                matched.push_back(&vehicle);
+            }
         }
+
+        std::lock_guard<std::mutex> lock(partsMutex);
+        parts.emplace_back(begin, std::move(matched));
+    });
+
+    std::sort(parts.begin(), parts.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    std::vector<const TacticalVehicle*> result;
+    for (const auto& part : parts) {
+        result.insert(result.end(), part.second.begin(), part.second.end());
+    }
+    // A cancelled evaluation stopped early; its time is not a filter latency
+    if (cancelled && cancelled->load(std::memory_order_relaxed)) {
+        latency.discard();
     }
+    return result;
 }
 
 /**
@@ -150,58 +342,1212 @@ bool TacticalVehicleController::isFilterActive() const {
 // This function operates exclusively on model data and is
 // triggered externally by a timed heartbeat (QTimer).
 void TacticalVehicleController::updateSimulation(double targetX, double targetY) {
-    constexpr double PI_CONST = 3.14159265358979323846;
+    runSteps(1, targetX, targetY);
+}
+
+void TacticalVehicleController::runSteps(std::uint64_t steps, double targetX, double targetY) {
+    advanceSteps(steps, targetX, targetY);
+    publish();
+}
+
+void TacticalVehicleController::advanceSteps(std::uint64_t steps, double targetX, double targetY) {
+    ScopedLatency latency(LatencyTick);
+    ensureKinematicsBound();
+
+    if (recording) {
+        const TargetChange& last = activeRecording.targets.back();
+        if (last.targetX != targetX || last.targetY != targetY) {
+            activeRecording.targets.push_back({simulationStep, targetX, targetY});
+        }
+    }
+
+    const bool sweeping = proximityRange > 0.0;
+    if (sweeping && sweepFromX.size() != kinematics.size()) {
+        sampleProximitySweep(kinematics.posX.data(), kinematics.posY.data());
+    }
+    for (std::uint64_t i = 0; i < steps; ++i) {
+        advanceKinematics(targetX, targetY);
+
+        // Long runs between publishes are swept in pieces, so contacts made
+        // and broken in between are still reported
+        sweepElapsed += timestepSeconds;
+        if (sweeping && sweepSpeedLimit * sweepElapsed > proximityRange * SWEEP_MOVE_FRACTION) {
+            sweepProximity(kinematics.posX.data(), kinematics.posY.data());
+        }
+    }
+    lastTargetX = targetX;
+    lastTargetY = targetY;
+    publishPending = publishPending || steps > 0;
+}
+
+void TacticalVehicleController::publish() {
+    ScopedLatency latency(LatencyPublish);
+    ensureKinematicsBound();
+
+    // Records are not written while a background filter evaluation reads
+    // them; the publish is deferred to a later call instead of blocking
+    std::unique_lock<std::mutex> lock(recordsMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        publishPending = true;
+        return;
+    }
+    if (kinematicsStale()) {
+        bindKinematics();
+    }
+    refreshPublishedState();
+}
+
+void TacticalVehicleController::publishDeferred() {
+    if (!publishPending) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(recordsMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
+    // Vehicles appended while the publish waited have no slots yet
+    if (kinematicsStale()) {
+        bindKinematics();
+    }
+    refreshPublishedState();
+}
+
+void TacticalVehicleController::appendVehicles(TacticalVehicleData::VehicleBatch batch) {
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    data.appendVehicles(std::move(batch));
+}
+
+void TacticalVehicleController::removeVehicles(std::vector<std::size_t> positions) {
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    data.removeVehicles(std::move(positions));
+    // Bound at once, while the survivors' simIndex still name their old
+    // slots; later appends then get provisional slots past the new layout
+    bindKinematics();
+}
+
+/**
+ * @brief Refreshes derived data and publishes it; the caller holds recordsMutex.
+ */
+void TacticalVehicleController::refreshPublishedState() {
+    // Only the published state is observable, so derived data is refreshed once
+    deadReckonPositions();
+    updateTargetMatrix();
+    updateProximity();
+    updateIntercepts();
+    updateClusters();
+    publishKinematics();
+    publishPending = false;
+
+    if (fuelBandCrossed && filterApplied) {
+        installFilter(activeCriteria, evaluate(activeCriteria, nullptr));
+    }
+    fuelBandCrossed = false;
+}
+
+void TacticalVehicleController::setThreadCount(int threads) {
+    workerThreads = std::max(1, threads);
+}
+
+/**
+ * @brief Runs one base tick of the kernel pipeline over the slots due on it.
+ *
+ * Each due range is integrated over the time elapsed since its last
+ * update, so slower rate groups take proportionally longer steps.
+ * Adjacent ranges that were last updated together are merged, which keeps
+ * the uniform-rate case a single pass over all slots.
+ */
+void TacticalVehicleController::advanceKinematics(double targetX, double targetY) {
+    const std::size_t firstEvent = supplyEvents.size();
+
+    dueRanges.clear();
+    rateScheduler.dueRanges(simulationStep, dueRanges);
+
+    std::size_t merged = 0;
+    for (const SlotRange& range : dueRanges) {
+        if (merged > 0 && dueRanges[merged - 1].end == range.begin &&
+            kinematics.updatedStep[dueRanges[merged - 1].begin] == kinematics.updatedStep[range.begin]) {
+            dueRanges[merged - 1].end = range.end;
+        } else {
+            dueRanges[merged++] = range;
+        }
+    }
+    dueRanges.resize(merged);
+
+    const std::uint64_t nextStep = simulationStep + 1;
+    for (const SlotRange& range : dueRanges) {
+        // Slots of a range share their last update, hence their step length
+        const std::uint64_t fromStep = kinematics.updatedStep[range.begin];
+        forEachChunk("simulation.advance", range.begin, range.end, [this, fromStep, nextStep, targetX, targetY](std::size_t begin, std::size_t end) {
+            advanceRange(begin, end, fromStep, nextStep, targetX, targetY);
+        });
+        std::fill(kinematics.updatedStep.begin() + range.begin, kinematics.updatedStep.begin() + range.end, nextStep);
+    }
+
+    if (supplyEvents.size() > firstEvent) {
+        collectSupplyEvents(firstEvent);
+    }
+    ++simulationStep;
+    simulationTime += timestepSeconds;
+    simulationMicros += timestepMicros;
+}
+
+/**
+ * @brief Splits the slot range into contiguous chunks on the shared task
+ *        scheduler, at most a few per requested thread.
+ *
+ * Every kernel is independent per slot, so chunks can run concurrently;
+ * the calling thread processes the first chunk itself.
+ */
+void TacticalVehicleController::forEachChunk(const char* label,
+                                             const std::function<void(std::size_t, std::size_t)>& work) {
+    forEachChunk(label, 0, kinematics.size(), work);
+}
+
+void TacticalVehicleController::forEachChunk(const char* label, std::size_t first, std::size_t last,
+                                             const std::function<void(std::size_t, std::size_t)>& work) {
+    // Below this size scheduling costs more than the work itself
+    constexpr std::size_t MIN_SLOTS_PER_TASK = 4096;
+    // Several chunks per thread let idle workers steal from slow ones
+    constexpr std::size_t TASKS_PER_THREAD = 4;
+
+    const std::size_t maxTasks = workerThreads > 1 ? workerThreads * TASKS_PER_THREAD : 1;
+    TaskScheduler::shared().parallelFor(label, first, last, MIN_SLOTS_PER_TASK, maxTasks, work);
+}
+
+/**
+ * @brief Kernel pipeline for the slot range [begin, end), from fromStep to toStep.
+ *
+ * Route steering runs first so the step integrates along the steered
+ * heading. The unit heading is refreshed before jitter, so the step
+ * integrates along the heading held at the start of the tick and the
+ * varied heading takes effect on the next step. Jitter covers every
+ * simulated second that ends within the interval.
+ */
+void TacticalVehicleController::advanceRange(std::size_t begin, std::size_t end,
+                                             std::uint64_t fromStep, std::uint64_t toStep,
+                                             double targetX, double targetY) {
+    constexpr std::uint64_t MICROS_PER_SECOND = 1000000;
+    const double dt = static_cast<double>(toStep - fromStep) * timestepSeconds;
+    std::vector<SupplyEvent> events;
+
+    if (!routes.empty()) {
+        SimulationKernel::steerAlongRoutes(kinematics, routes, begin, end, dt);
+    }
+    SimulationKernel::refreshHeadingCache(kinematics, begin, end);
+    SimulationKernel::applyJitter(kinematics, begin, end, random,
+                                  clockAtStep(fromStep) / MICROS_PER_SECOND, clockAtStep(toStep) / MICROS_PER_SECOND);
+    if (useScalarKernel) {
+        SimulationKernel::integrateScalar(kinematics, begin, end, dt, targetX, targetY,
+                                          supplyThresholds, events);
+    } else {
+        SimulationKernel::integrate(kinematics, begin, end, dt, targetX, targetY,
+                                    supplyThresholds, events);
+    }
+
+    if (!events.empty()) {
+        std::lock_guard<std::mutex> lock(supplyEventMutex);
+        supplyEvents.insert(supplyEvents.end(), events.begin(), events.end());
+    }
+}
+
+// --- Rate Groups ---
+/**
+ * @brief Changes the per-priority update divisors.
+ *
+ * Lagging slots are first brought up to the current step, so the new
+ * phases start from a common update.
+ */
+void TacticalVehicleController::setRateDivisors(const RateScheduler::Divisors& divisors) {
+    if (divisors == rateScheduler.divisors()) {
+        return;
+    }
+    if (recording) {
+        qWarning() << "Simulation Error: Rate divisors cannot change while recording";
+        return;
+    }
+    if (kinematicsBound) {
+        synchronizeSlots();
+    }
+    rateScheduler.setDivisors(divisors);
+}
+
+void TacticalVehicleController::setTimestep(double seconds) {
+    if (seconds == timestepSeconds) {
+        return;
+    }
+    if (seconds <= 0.0) {
+        qWarning() << "Simulation Error: Ignoring non-positive timestep" << seconds;
+        return;
+    }
+    if (recording) {
+        qWarning() << "Simulation Error: Timestep cannot change while recording";
+        return;
+    }
+
+    // Lag is counted in steps, so lagging slots must settle at the old timestep
+    if (kinematicsBound) {
+        synchronizeSlots();
+    }
+    timestepSeconds = seconds;
+    timestepMicros = std::max<std::uint64_t>(1, std::llround(seconds * 1e6));
+}
+
+/**
+ * @brief Simulated microseconds at a step, for steps since the last timestep
+ *        change (lagging slots are synchronized before every change).
+ */
+std::uint64_t TacticalVehicleController::clockAtStep(std::uint64_t step) const {
+    return step >= simulationStep ? simulationMicros + (step - simulationStep) * timestepMicros
+                                  : simulationMicros - (simulationStep - step) * timestepMicros;
+}
+
+/**
+ * @brief Integrates every lagging run of slots up to the current step.
+ */
+void TacticalVehicleController::synchronizeSlots() {
+    const std::size_t firstEvent = supplyEvents.size();
+    const std::size_t count = kinematics.size();
+
+    std::size_t begin = 0;
+    while (begin < count) {
+        const std::uint64_t updated = kinematics.updatedStep[begin];
+        std::size_t end = begin + 1;
+        while (end < count && kinematics.updatedStep[end] == updated) {
+            ++end;
+        }
+        if (updated < simulationStep) {
+            advanceRange(begin, end, updated, simulationStep, lastTargetX, lastTargetY);
+            std::fill(kinematics.updatedStep.begin() + begin, kinematics.updatedStep.begin() + end, simulationStep);
+        }
+        begin = end;
+    }
+
+    if (supplyEvents.size() > firstEvent) {
+        collectSupplyEvents(firstEvent);
+    }
+}
+
+/**
+ * @brief Extrapolates lagging slots to the current step for readers.
+ *
+ * Only needed when some rate group is slower than the base tick; otherwise
+ * readers use the integrated state directly. Target distances and intercept
+ * geometry keep using the integrated state.
+ */
+void TacticalVehicleController::deadReckonPositions() {
+    if (rateScheduler.isUniform()) {
+        readPosX.clear();
+        readPosY.clear();
+        readDistance.clear();
+        return;
+    }
+
+    const std::size_t count = kinematics.size();
+    readPosX.resize(count);
+    readPosY.resize(count);
+    readDistance.resize(count);
+    forEachChunk("simulation.deadReckon", [this](std::size_t begin, std::size_t end) {
+        SimulationKernel::deadReckon(kinematics, begin, end, simulationStep, timestepSeconds, 0.0,
+                                     lastTargetX, lastTargetY,
+                                     readPosX.data(), readPosY.data(), readDistance.data());
+    });
+}
+
+// --- Display Extrapolation ---
+/**
+ * @brief Dead-reckons one vehicle to an arbitrary simulation time.
+ *
+ * Starts from the slot's last integrated state, whether it belongs to the
+ * current step or to a slower rate group, and projects it along the current
+ * heading and speed. Times before the last step are clamped to it. Cost is
+ * a handful of flops, so views can call this at display rate without
+ * running the simulation.
+ */
+ExtrapolatedState TacticalVehicleController::extrapolate(const TacticalVehicle& vehicle, double timestamp) const {
+    ExtrapolatedState state;
+    const std::size_t slot = vehicle.simIndex;
+    if (!kinematicsBound || slot >= kinematics.size()) {
+        return state;
+    }
+
+    const double ahead = std::max(0.0, timestamp - simulationTime);
+    SimulationKernel::deadReckonSlot(kinematics, slot, simulationStep, timestepSeconds, ahead,
+                                     lastTargetX, lastTargetY, state.posX, state.posY, state.distanceToTarget);
+    state.speed = kinematics.speed[slot];
+    state.heading = kinematics.heading[slot];
+
+    if (geodeticMode) {
+        tangentPlane.toGeodetic(&state.posX, &state.posY, &state.latitude, &state.longitude, 1);
+        if (largeAreaDistances) {
+            double targetLatitude = 0.0;
+            double targetLongitude = 0.0;
+            tangentPlane.toGeodetic(&lastTargetX, &lastTargetY, &targetLatitude, &targetLongitude, 1);
+            GeodeticDistance::haversine(&state.latitude, &state.longitude, 1,
+                                        targetLatitude, targetLongitude, &state.distanceToTarget);
+        }
+    }
+
+    state.valid = true;
+    return state;
+}
+
+/**
+ * @brief Batched extrapolation of every slot; outputs are indexed by simIndex
+ *        and must hold kinematicState().size() elements.
+ */
+void TacticalVehicleController::extrapolateAll(double timestamp, double* x, double* y, double* distance) const {
+    const double ahead = std::max(0.0, timestamp - simulationTime);
+    SimulationKernel::deadReckon(kinematics, 0, kinematics.size(), simulationStep, timestepSeconds, ahead,
+                                 lastTargetX, lastTargetY, x, y, distance);
+}
+
+// --- Consumables ---
+/**
+ * @brief Stamps, orders and classifies the crossings of the current step.
+ *
+ * Chunks append in completion order, so events are sorted by slot to keep
+ * the result independent of the thread count. Crossings of the fuel filter
+ * band only mark the filtered view stale; alert-level crossings are queued.
+ */
+void TacticalVehicleController::collectSupplyEvents(std::size_t first) {
+    const auto begin = supplyEvents.begin() + first;
+    std::sort(begin, supplyEvents.end(), [](const SupplyEvent& a, const SupplyEvent& b) {
+        if (a.slot != b.slot) return a.slot < b.slot;
+        if (a.kind != b.kind) return a.kind < b.kind;
+        return a.threshold > b.threshold;
+    });
+
+    for (auto it = begin; it != supplyEvents.end(); ++it) {
+        it->step = simulationStep;
+        if (it->kind == SupplyKind::Fuel &&
+            (it->threshold == activeCriteria.fuelMin || it->threshold == activeCriteria.fuelMax)) {
+            fuelBandCrossed = true;
+        }
+    }
+
+    auto isAlert = [this](const SupplyEvent& event) {
+        const auto& levels = event.kind == SupplyKind::Fuel ? fuelAlertLevels : ammunitionAlertLevels;
+        return std::find(levels.begin(), levels.end(), event.threshold) != levels.end();
+    };
+    supplyEvents.erase(std::remove_if(begin, supplyEvents.end(),
+                                      [&isAlert](const SupplyEvent& event) { return !isAlert(event); }),
+                       supplyEvents.end());
+}
+
+void TacticalVehicleController::rebuildSupplyThresholds() {
+    supplyThresholds.fuel = fuelAlertLevels;
+    supplyThresholds.ammunition = ammunitionAlertLevels;
+
+    if (filterApplied) {
+        if (activeCriteria.fuelMin > 0) {
+            supplyThresholds.fuel.push_back(activeCriteria.fuelMin);
+        }
+        if (activeCriteria.fuelMax < 100) {
+            supplyThresholds.fuel.push_back(activeCriteria.fuelMax);
+        }
+    }
+
+    // One kernel comparison per distinct level
+    auto& fuel = supplyThresholds.fuel;
+    std::sort(fuel.begin(), fuel.end());
+    fuel.erase(std::unique(fuel.begin(), fuel.end()), fuel.end());
+}
+
+void TacticalVehicleController::setSupplyAlertLevels(const std::vector<double>& fuel,
+                                                     const std::vector<double>& ammunition) {
+    fuelAlertLevels = fuel;
+    ammunitionAlertLevels = ammunition;
+    rebuildSupplyThresholds();
+}
+
+std::vector<SupplyEvent> TacticalVehicleController::takeSupplyEvents() {
+    return std::exchange(supplyEvents, {});
+}
+
+const TacticalVehicle* TacticalVehicleController::vehicleForSlot(std::size_t slot) const {
+    // A rebind between publishes clears the index; rebuild it on first use
+    if (vehicleBySlot.size() != kinematics.size()) {
+        vehicleBySlot.resize(kinematics.size());
+        rebuildSlotIndex();
+    }
+    return slot < vehicleBySlot.size() ? vehicleBySlot[slot] : nullptr;
+}
 
+void TacticalVehicleController::rebuildSlotIndex() const {
+    std::fill(vehicleBySlot.begin(), vehicleBySlot.end(), nullptr);
     for (auto& v : data.vehiclesMutable()) {
+        if (v.simIndex < vehicleBySlot.size()) {
+            vehicleBySlot[v.simIndex] = &v;
+        }
+    }
+}
+
+/**
+ * @brief Publishes integrated state back to the authoritative records.
+ */
+void TacticalVehicleController::publishKinematics() {
+    const std::size_t count = kinematics.size();
+
+    // Dead-reckoned positions when some rate group lags behind the clock
+    const bool reckoned = readPosX.size() == count && count > 0;
+    const double* const posX = reckoned ? readPosX.data() : kinematics.posX.data();
+    const double* const posY = reckoned ? readPosY.data() : kinematics.posY.data();
+    double* const distance = reckoned ? readDistance.data() : kinematics.distanceToTarget.data();
+
+    if (geodeticMode) {
+        geoLatitude.resize(count);
+        geoLongitude.resize(count);
+        tangentPlane.toGeodetic(posX, posY, geoLatitude.data(), geoLongitude.data(), count);
+
+        if (largeAreaDistances) {
+            double targetLatitude = 0.0;
+            double targetLongitude = 0.0;
+            tangentPlane.toGeodetic(&lastTargetX, &lastTargetY, &targetLatitude, &targetLongitude, 1);
+            GeodeticDistance::haversine(geoLatitude.data(), geoLongitude.data(), count,
+                                        targetLatitude, targetLongitude, distance);
+        }
+    }
+
+    // Records only move on a rebind, which clears the index
+    vehicleBySlot.resize(count);
+
+    for (auto& v : data.vehiclesMutable()) {
+        const std::size_t slot = v.simIndex;
+        // Callers rebind before publishing records appended since the last binding
+        Q_ASSERT(slot < count);
+        if (slot >= count) {
+            continue;
+        }
+        vehicleBySlot[slot] = &v;
+
+        // Each field is compared before it is overwritten, so views can
+        // refresh only what actually moved (see takeChanges())
+        VehicleChangeSet::Fields changed = 0;
+        auto publish = [&changed](auto& field, auto value, VehicleChangeSet::Fields bit) {
+            if (field != value) {
+                field = value;
+                changed |= bit;
+            }
+        };
+
+        publish(v.posX, posX[slot], VehicleChangeSet::Position);
+        publish(v.posY, posY[slot], VehicleChangeSet::Position);
+        publish(v.speed, kinematics.speed[slot], VehicleChangeSet::Speed);
+        publish(v.heading, kinematics.heading[slot], VehicleChangeSet::Heading);
+        publish(v.distanceToTarget, distance[slot], VehicleChangeSet::Distance);
+        publish(v.fuelLevel, kinematics.fuelLevel[slot], VehicleChangeSet::Fuel);
+        publish(v.ammunitionLevel, kinematics.ammunitionLevel[slot], VehicleChangeSet::Ammunition);
+        publish(v.routeCursor, routes.cursor[slot], VehicleChangeSet::Route);
+
+        if (geodeticMode) {
+            publish(v.latitude, geoLatitude[slot], VehicleChangeSet::Geodetic);
+            publish(v.longitude, geoLongitude[slot], VehicleChangeSet::Geodetic);
+        }
+
+        if (slot < interceptEngine.slotCount()) {
+            publish(v.timeToCpa, interceptEngine.timeToCpa(slot), VehicleChangeSet::Intercept);
+            publish(v.cpaDistance, interceptEngine.cpaDistance(slot), VehicleChangeSet::Intercept);
+            publish(v.cpaPartner, interceptEngine.cpaPartner(slot), VehicleChangeSet::Intercept);
+        }
+        if (slot < etaToTarget.size()) {
+            publish(v.etaToTarget, etaToTarget[slot], VehicleChangeSet::Eta);
+        }
+
+        if (slot < proximityMask.size()) {
+            publish(v.proximityMask, unsigned(proximityMask[slot]), VehicleChangeSet::Proximity);
+            publish(v.proximityContacts, int(proximityContacts[slot]), VehicleChangeSet::Proximity);
+        }
+
+        if (targetMatrix.targetCount() > 0) {
+            publish(v.nearestTargetDistance, targetMatrix.nearestDistance[slot], VehicleChangeSet::NearestTarget);
+            publish(v.nearestTargetIndex, int(targetMatrix.nearestTarget[slot]), VehicleChangeSet::NearestTarget);
+        } else {
+            publish(v.nearestTargetDistance, v.distanceToTarget, VehicleChangeSet::NearestTarget);
+            publish(v.nearestTargetIndex, -1, VehicleChangeSet::NearestTarget);
+        }
+
+        pendingChanges.mark(slot, changed);
+        if (changed & VehicleChangeSet::Fuel) {
+            fuelBuckets.set(slot, v.fuelLevel);
+        }
+        if (changed & VehicleChangeSet::Distance) {
+            distanceBuckets.set(slot, v.distanceToTarget);
+        }
+    }
+}
+
+/**
+ * @brief Returns and clears the changes published since the last call.
+ *
+ * Changes accumulate across steps, so a view refreshing less often than the
+ * simulation steps still sees every vehicle that moved in between.
+ */
+VehicleChangeSet TacticalVehicleController::takeChanges() {
+    return std::exchange(pendingChanges, {});
+}
+
+// --- Mission Target Set ---
+/**
+ * @brief Installs a new target set and refreshes distances immediately,
+ *        so filters and sorts can use it before the next step.
+ */
+void TacticalVehicleController::setMissionTargets(const std::vector<MissionTarget>& targets) {
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    if (kinematicsBound && kinematicsStale()) {
+        bindKinematics();
+    }
+    targetMatrix.configure(targets, kinematics.size());
+    if (kinematicsBound) {
+        updateTargetMatrix();
+        publishKinematics();
+    }
+}
+
+void TacticalVehicleController::updateTargetMatrix() {
+    if (targetMatrix.targetCount() == 0) {
+        return;
+    }
+    forEachChunk("simulation.targets", [this](std::size_t begin, std::size_t end) {
+        SimulationKernel::computeTargetDistances(kinematics, targetMatrix, begin, end);
+    });
+}
+
+// --- Proximity ---
+void TacticalVehicleController::setProximityRadius(double meters) {
+    proximityRange = std::max(0.0, meters);
+    // Pairs swept at the old radius no longer apply
+    sweptPairs.clear();
+    sweepFromX.clear();
+    sweepFromY.clear();
+    if (kinematicsBound) {
+        std::lock_guard<std::mutex> lock(recordsMutex);
+        if (kinematicsStale()) {
+            bindKinematics();
+        }
+        updateProximity();
+        publishKinematics();
+    }
+}
+
+/**
+ * @brief Publishes every pair that came within the radius since the last
+ *        publish, with its closest approach.
+ *
+ * The last stretch is swept up to the positions readers see; pairs from
+ * the intermediate sweeps of advanceSteps() are merged in, keeping the
+ * closest approach of a pair found more than once.
+ */
+void TacticalVehicleController::updateProximity() {
+    const std::size_t count = kinematics.size();
+    proximityResults.clear();
+    proximityMask.assign(count, 0);
+    proximityContacts.assign(count, 0);
+
+    if (proximityRange <= 0.0 || count == 0 || proximityGroup.size() != count) {
+        sweptPairs.clear();
+        sweepFromX.clear();
+        sweepFromY.clear();
+        return;
+    }
+
+    // Pairs are evaluated where readers see the tracks (dead-reckoned if lagging)
+    const bool reckoned = readPosX.size() == count;
+    const double* const posX = reckoned ? readPosX.data() : kinematics.posX.data();
+    const double* const posY = reckoned ? readPosY.data() : kinematics.posY.data();
+
+    // Without a sample (first pass after a bind) this is a static pass
+    if (sweepFromX.size() != count) {
+        sampleProximitySweep(posX, posY);
+    }
+    sweepProximity(posX, posY);
+
+    proximityResults.swap(sweptPairs);
+    sweptPairs.clear();
+    std::sort(proximityResults.begin(), proximityResults.end(), [](const ProximityPair& a, const ProximityPair& b) {
+        if (a.first != b.first) return a.first < b.first;
+        if (a.second != b.second) return a.second < b.second;
+        return a.distance < b.distance;
+    });
+    proximityResults.erase(std::unique(proximityResults.begin(), proximityResults.end(),
+                                       [](const ProximityPair& a, const ProximityPair& b) {
+                                           return a.first == b.first && a.second == b.second;
+                                       }),
+                           proximityResults.end());
+
+    for (const auto& pair : proximityResults) {
+        proximityMask[pair.first] |= 1u << (proximityGroup[pair.second] / 2);
+        proximityMask[pair.second] |= 1u << (proximityGroup[pair.first] / 2);
+        ++proximityContacts[pair.first];
+        ++proximityContacts[pair.second];
+    }
+}
+
+/**
+ * @brief Starts the next sweep at the given positions.
+ */
+void TacticalVehicleController::sampleProximitySweep(const double* posX, const double* posY) {
+    const std::size_t count = kinematics.size();
+    sweepFromX.assign(posX, posX + count);
+    sweepFromY.assign(posY, posY + count);
+    sweepElapsed = 0.0;
+
+    double fastest = 0.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        fastest = std::max({fastest, kinematics.speed[i], kinematics.targetSpeed[i]});
+    }
+    sweepSpeedLimit = fastest / KMH_PER_MPS;
+}
+
+/**
+ * @brief Collects the pairs that came within the radius while moving from
+ *        the sample to the given positions, then samples those.
+ *
+ * The grid is rebuilt per sweep (one counting sort) with cells widened by
+ * twice the longest move, so every pair that can have met is a candidate;
+ * pair search is split across worker chunks.
+ */
+void TacticalVehicleController::sweepProximity(const double* toX, const double* toY) {
+    const std::size_t count = kinematics.size();
+    double longestMove = 0.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const double move = std::hypot(toX[i] - sweepFromX[i], toY[i] - sweepFromY[i]);
+        if (std::isfinite(move)) {
+            longestMove = std::max(longestMove, move);
+        }
+    }
+
+    proximityGrid.build(toX, toY, count, proximityRange + 2.0 * longestMove);
+
+    forEachChunk("simulation.proximity", [this, toX, toY](std::size_t begin, std::size_t end) {
+        std::vector<ProximityPair> pairs;
+        proximityGrid.findSweptPairs(sweepFromX.data(), sweepFromY.data(), toX, toY,
+                                     proximityGroup.data(), PROXIMITY_INTERACTIONS, proximityRange,
+                                     begin, end, pairs);
+        if (!pairs.empty()) {
+            std::lock_guard<std::mutex> lock(proximityMutex);
+            sweptPairs.insert(sweptPairs.end(), pairs.begin(), pairs.end());
+        }
+    });
+
+    sampleProximitySweep(toX, toY);
+}
+
+// --- Clustering ---
+void TacticalVehicleController::setClusteringEnabled(bool enabled) {
+    clusteringEnabled = enabled;
+    if (enabled && kinematicsBound) {
+        std::lock_guard<std::mutex> lock(recordsMutex);
+        updateClusters();
+    }
+}
+
+/**
+ * @brief Moves the published positions into the cluster pyramid.
+ *
+ * Incremental: tracks that stay in their level-0 cell cost one array
+ * update, so the pass is cheap even when every track moved.
+ */
+void TacticalVehicleController::updateClusters() {
+    const std::size_t count = kinematics.size();
+    if (!clusteringEnabled || count == 0 || clusterIndex.size() != count) {
+        return;
+    }
+
+    // Clusters follow what readers see (dead-reckoned if lagging)
+    const bool reckoned = readPosX.size() == count;
+    const double* const posX = reckoned ? readPosX.data() : kinematics.posX.data();
+    const double* const posY = reckoned ? readPosY.data() : kinematics.posY.data();
+    clusterIndex.update(posX, posY, count);
+}
+
+// --- Intercept Geometry ---
+void TacticalVehicleController::updateIntercepts() {
+    interceptSolved = interceptEngine.update(kinematics, simulationTime, interceptRange);
+    etaToTarget.resize(kinematics.size());
+    interceptEngine.computeEta(kinematics, lastTargetX, lastTargetY, etaToTarget.data());
+}
+
+void TacticalVehicleController::setInterceptSets(const std::vector<const TacticalVehicle*>& friendly,
+                                                 const std::vector<const TacticalVehicle*>& hostile) {
+    ensureKinematicsBound();
+
+    auto toSlots = [this](const std::vector<const TacticalVehicle*>& vehicles) {
+        std::vector<std::uint32_t> indices;
+        indices.reserve(vehicles.size());
+        for (const TacticalVehicle* v : vehicles) {
+            if (v && v->simIndex < kinematics.size()) {
+                indices.push_back(static_cast<std::uint32_t>(v->simIndex));
+            }
+        }
+        return indices;
+    };
+    interceptEngine.configure(toSlots(friendly), toSlots(hostile), kinematics.size());
+    customInterceptSets = true;
+}
+
+void TacticalVehicleController::resetInterceptSets() {
+    customInterceptSets = false;
+    if (kinematicsBound) {
+        configureDefaultInterceptSets();
+    }
+}
+
+void TacticalVehicleController::configureDefaultInterceptSets() {
+    std::vector<std::uint32_t> friendly;
+    std::vector<std::uint32_t> hostile;
+    for (std::size_t slot = 0; slot < proximityGroup.size(); ++slot) {
+        const std::uint8_t affiliation = proximityGroup[slot] / 2;
+        if (affiliation == ProximityFriendly) {
+            friendly.push_back(static_cast<std::uint32_t>(slot));
+        } else if (affiliation == ProximityHostile) {
+            hostile.push_back(static_cast<std::uint32_t>(slot));
+        }
+    }
+    interceptEngine.configure(friendly, hostile, kinematics.size());
+}
+
+double TacticalVehicleController::distanceToMissionTarget(const TacticalVehicle& vehicle, std::size_t target) const {
+    if (target >= targetMatrix.targetCount() || vehicle.simIndex >= targetMatrix.vehicleCount) {
+        return vehicle.distanceToTarget;
+    }
+    return targetMatrix.at(target, vehicle.simIndex);
+}
+
+void TacticalVehicleController::sortByMissionTarget(std::vector<const TacticalVehicle*>& view,
+                                                    std::size_t target, bool ascending) const {
+    if (target >= targetMatrix.targetCount()) {
+        return;
+    }
+    ScopedLatency latency(LatencySort);
+    const double* const row = targetMatrix.distances.data() + target * targetMatrix.vehicleCount;
+    const std::size_t rowSize = targetMatrix.vehicleCount;
+    // Vehicles added since the matrix was last filled have no column yet;
+    // they sort by their published distance, as distanceToMissionTarget does
+    auto key = [row, rowSize](const TacticalVehicle* v) {
+        return v->simIndex < rowSize ? row[v->simIndex] : v->distanceToTarget;
+    };
+    TaskScheduler& scheduler = TaskScheduler::shared();
+    if (ascending) {
+        scheduler.parallelSort("sort.missionTarget", view.begin(), view.end(), [&key](const TacticalVehicle* a, const TacticalVehicle* b) {
+            return key(a) < key(b);
+        });
+    } else {
+        scheduler.parallelSort("sort.missionTarget", view.begin(), view.end(), [&key](const TacticalVehicle* a, const TacticalVehicle* b) {
+            return key(a) > key(b);
+        });
+    }
+}
+
+/**
+ * @brief Reseeds the simulation random source.
+ *
+ * Draws are derived from (seed, vehicle key, simulated second), so two
+ * controllers with the same seed and dataset produce the same jitter
+ * sequence, however their slots are laid out.
+ */
+void TacticalVehicleController::setRandomSeed(std::uint64_t seed) {
+    random.setSeed(seed);
+}
+
+/**
+ * @brief Assigns stable simulation slots and seeds the telemetry buffers.
+ *
+ * Called lazily whenever the dataset has been (re)loaded. Each vehicle
+ * carries its own simIndex, so slots do not depend on the container order.
+ */
+void TacticalVehicleController::ensureKinematicsBound() {
+    if (kinematicsStale()) {
+        std::lock_guard<std::mutex> lock(recordsMutex);
+        bindKinematics();
+    }
+}
+
+/**
+ * @brief true when vehicles were loaded, appended or removed since the last
+ *        binding, so some records have no slot (or a stale one).
+ */
+bool TacticalVehicleController::kinematicsStale() const {
+    return !kinematicsBound || boundRevision != data.revision() || kinematics.size() != data.vehicles().size();
+}
+
+/**
+ * @brief Lays the slots out by rate class and seeds them.
+ *
+ * When vehicles were only appended or removed since the last binding, the
+ * remaining ones keep their integrated state, route progress and pending
+ * changes at their new slots; only the appended ones are seeded from their
+ * records.
+ */
+void TacticalVehicleController::bindKinematics() {
+    auto& vehicles = data.vehiclesMutable();
 
-        // Convert heading to radians (UI uses degrees)
-        const double rad = (v.heading - 90.0) * (PI_CONST / 180.0);
-
-        // Variating speed realistically
-        quint32 variedSpeed = 0;
-        double upper = 0.0;
-        double lower = 0.0;
-        if (v.speed > 0) {
-            if(v.speed < 100) {
-                lower = v.targetSpeed-v.targetSpeed*0.03;
-                upper = v.targetSpeed+v.targetSpeed*0.03;
-            } else if (v.speed > 100 && v.speed < 300) {
-                lower = v.targetSpeed-v.targetSpeed*0.02;
-                upper = v.targetSpeed+v.targetSpeed*0.02;
-            } else {
-                lower = v.targetSpeed-v.targetSpeed*0.01;
-                upper = v.targetSpeed+v.targetSpeed*0.01;
-            }
-            quint32 lowerLimit = static_cast<qint32>(lower);
-            quint32 upperLimit = std::max(lowerLimit + 1, static_cast<quint32>(upper));
-            variedSpeed = QRandomGenerator::global()->bounded(lowerLimit, upperLimit);
-            v.speed = static_cast<double>(variedSpeed);
-
-        // Variating heading realistically
-        quint32 variedHeading = 0;
-        if (v.heading > 0) {
-            double headup = v.heading+1.0;
-            double headlow = v.heading-1.0;
-            quint32 headingUpper = static_cast<qint32>(headup);
-            quint32 headingLower = static_cast<qint32>(headlow);
-            variedHeading = QRandomGenerator::global()->bounded(headingLower, headingUpper);
-        }
-        else {
-            variedHeading = QRandomGenerator::global()->bounded(0, 1);
-        }
-        v.heading = static_cast<double>(variedHeading);
-        }
-
-        // Speed conversion: km/h -> m/s
-        const double distPerSecond = v.speed / 3.6;
-
-        // Integrate position
-        v.posX += distPerSecond * std::cos(rad);
-        v.posY += distPerSecond * std::sin(rad);
-
-        // Update target-relative distance
-        const double dx = targetX - v.posX;
-        const double dy = targetY - v.posY;
-        v.distanceToTarget = std::sqrt(dx * dx + dy * dy);
+    const bool carry = kinematicsBound && boundGeneration == data.generation();
+    if (carry) {
+        // Carried state must be current: a rate range shares one updatedStep
+        synchronizeSlots();
+    }
+    const KinematicsBuffers previous = std::exchange(kinematics, KinematicsBuffers());
+    const RouteArena previousRoutes = std::exchange(routes, RouteArena());
+    const std::size_t carriedCount = carry ? previous.size() : 0;
+    std::vector<std::uint32_t> newSlotOf(carriedCount, VehicleChangeSet::RemovedSlot);
+
+    kinematics.resize(vehicles.size());
+    proximityGroup.assign(vehicles.size(), 0);
+    clusterAffiliation.assign(vehicles.size(), ClusterUnknown);
+    clusterDomain.assign(vehicles.size(), ClusterOther);
+
+    routes.resize(vehicles.size());
+    bindRoutes();
+
+    readPosX.clear();
+    readPosY.clear();
+    readDistance.clear();
+
+    // Slots are grouped by rate class (stable within a class), so every
+    // rate group is one contiguous run the scheduler can slice into phases
+    std::array<std::size_t, RATE_CLASS_COUNT + 1> classBegin{};
+    for (const auto& v : vehicles) {
+        ++classBegin[rateClassFor(v.priority) + 1];
+    }
+    for (std::size_t c = 0; c < RATE_CLASS_COUNT; ++c) {
+        classBegin[c + 1] += classBegin[c];
+    }
+    rateScheduler.configure(classBegin);
+    std::fill(kinematics.updatedStep.begin(), kinematics.updatedStep.end(), simulationStep);
+
+    std::array<std::size_t, RATE_CLASS_COUNT> nextSlot;
+    std::copy(classBegin.begin(), classBegin.end() - 1, nextSlot.begin());
+
+    std::vector<std::uint8_t> carried(vehicles.size(), 0);
+    for (auto& v : vehicles) {
+        const std::size_t slot = nextSlot[rateClassFor(v.priority)]++;
+        const std::size_t from = v.simIndex;
+        v.simIndex = slot;
+        kinematics.posX[slot] = v.posX;
+        kinematics.posY[slot] = v.posY;
+        kinematics.speed[slot] = v.speed;
+        kinematics.heading[slot] = v.heading;
+        kinematics.targetSpeed[slot] = v.targetSpeed;
+        kinematics.streamKey[slot] = streamKeyFor(v);
+        kinematics.distanceToTarget[slot] = v.distanceToTarget;
+        kinematics.fuelLevel[slot] = v.fuelLevel;
+        kinematics.ammunitionLevel[slot] = v.ammunitionLevel;
+
+        const ConsumptionProfile profile = ConsumptionModel::profileFor(v.propulsion, v.classification);
+        kinematics.fuelIdle[slot] = profile.fuelIdle;
+        kinematics.fuelLinear[slot] = profile.fuelLinear;
+        kinematics.fuelQuadratic[slot] = profile.fuelQuadratic;
+        kinematics.ammunitionRate[slot] = profile.ammunition;
+
+        proximityGroup[slot] = static_cast<std::uint8_t>(proximityClassFor(v.affiliation) * 2 +
+                                                         (v.domain == "Air" ? 1 : 0));
+        clusterAffiliation[slot] = clusterAffiliationFor(v.affiliation);
+        clusterDomain[slot] = clusterDomainFor(v.domain);
+
+        // Routes outside the arena (inconsistent dataset) are ignored
+        if (std::size_t(v.routeOffset) + v.routeLength <= routes.waypointX.size()) {
+            routes.offset[slot] = v.routeOffset;
+            routes.length[slot] = v.routeLength;
+            routes.cursor[slot] = v.routeCursor;
+            routes.loop[slot] = v.routeLoop ? 1 : 0;
+        }
+        routes.turnRate[slot] = turnRateFor(v.propulsion);
+
+        // Appended vehicles carry provisional slots past the bound ones
+        if (from < carriedCount) {
+            newSlotOf[from] = static_cast<std::uint32_t>(slot);
+            carried[slot] = 1;
+            kinematics.posX[slot] = previous.posX[from];
+            kinematics.posY[slot] = previous.posY[from];
+            kinematics.speed[slot] = previous.speed[from];
+            kinematics.heading[slot] = previous.heading[from];
+            kinematics.distanceToTarget[slot] = previous.distanceToTarget[from];
+            kinematics.fuelLevel[slot] = previous.fuelLevel[from];
+            kinematics.ammunitionLevel[slot] = previous.ammunitionLevel[from];
+            routes.cursor[slot] = previousRoutes.cursor[from];
+        }
+    }
+
+    if (carry) {
+        // Alerts and changes not yet drained follow their vehicles
+        std::size_t keptEvents = 0;
+        for (const SupplyEvent& event : supplyEvents) {
+            if (newSlotOf[event.slot] != VehicleChangeSet::RemovedSlot) {
+                supplyEvents[keptEvents] = event;
+                supplyEvents[keptEvents++].slot = newSlotOf[event.slot];
+            }
+        }
+        supplyEvents.resize(keptEvents);
+        pendingChanges.remapSlots(newSlotOf);
+    } else {
+        // Slots have been reassigned; pending alerts and changes would refer to the old layout
+        supplyEvents.clear();
+        pendingChanges.markReloaded();
+    }
+    vehicleBySlot.clear();
+    sweptPairs.clear();
+    sweepFromX.clear();
+    sweepFromY.clear();
+
+    if (carry && customInterceptSets) {
+        auto remap = [&newSlotOf](const std::vector<std::uint32_t>& members) {
+            std::vector<std::uint32_t> remapped;
+            remapped.reserve(members.size());
+            for (const std::uint32_t slot : members) {
+                if (newSlotOf[slot] != VehicleChangeSet::RemovedSlot) {
+                    remapped.push_back(newSlotOf[slot]);
+                }
+            }
+            return remapped;
+        };
+        interceptEngine.configure(remap(interceptEngine.friendlySlots()), remap(interceptEngine.hostileSlots()),
+                                  kinematics.size());
+    } else {
+        customInterceptSets = false;
+        configureDefaultInterceptSets();
+    }
+    etaToTarget.clear();
+    clusterIndex.configure(clusterAffiliation.data(), clusterDomain.data(), kinematics.size(), CLUSTER_BASE_CELL);
+    // Both histograms count the published record values, the ones the range
+    // filters compare against; publishKinematics() keeps them in step
+    std::vector<double> published(kinematics.size());
+    for (const auto& v : vehicles) {
+        published[v.simIndex] = v.fuelLevel;
+    }
+    fuelBuckets.assign(published.data(), published.size());
+    for (const auto& v : vehicles) {
+        published[v.simIndex] = v.distanceToTarget;
+    }
+    distanceBuckets.assign(published.data(), published.size());
+
+    if (geodeticMode) {
+        projectGeodeticPositions(carried);
+    }
+
+    targetMatrix.configure(targetMatrix.targets, kinematics.size());
+
+    boundRevision = data.revision();
+    boundGeneration = data.generation();
+    kinematicsBound = true;
+}
+
+/**
+ * @brief Copies the dataset's waypoint arena into the simulation frame.
+ *
+ * Geodetic waypoints are projected in one batch in geodetic mode and
+ * left at the origin otherwise.
+ */
+void TacticalVehicleController::bindRoutes() {
+    const auto& waypoints = data.routeWaypoints();
+    const std::size_t count = waypoints.size();
+    routes.waypointX.resize(count);
+    routes.waypointY.resize(count);
+
+    std::vector<double> latitude(count, 0.0);
+    std::vector<double> longitude(count, 0.0);
+    bool anyGeodetic = false;
+    for (std::size_t i = 0; i < count; ++i) {
+        routes.waypointX[i] = waypoints[i].x;
+        routes.waypointY[i] = waypoints[i].y;
+        latitude[i] = waypoints[i].latitude;
+        longitude[i] = waypoints[i].longitude;
+        anyGeodetic = anyGeodetic || waypoints[i].hasGeodetic;
+    }
+
+    if (geodeticMode && anyGeodetic) {
+        std::vector<double> east(count);
+        std::vector<double> north(count);
+        tangentPlane.toEnu(latitude.data(), longitude.data(), east.data(), north.data(), count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (waypoints[i].hasGeodetic) {
+                routes.waypointX[i] = east[i];
+                routes.waypointY[i] = north[i];
+            }
+        }
+    }
+}
+
+// --- Deterministic Recording & Replay ---
+/**
+ * @brief Begins capturing a replayable run from the current state.
+ *
+ * Slot order is the iteration order of every kernel, so recording the
+ * initial state per slot fully fixes the evaluation order on replay.
+ */
+void TacticalVehicleController::startRecording(double targetX, double targetY) {
+    ensureKinematicsBound();
+
+    activeRecording = SimulationRecording();
+    activeRecording.seed = random.seed();
+    activeRecording.startStep = simulationStep;
+    activeRecording.startClock = simulationMicros;
+    activeRecording.timestep = timestepSeconds;
+    activeRecording.rateDivisors = rateScheduler.divisors();
+    activeRecording.targets.push_back({simulationStep, targetX, targetY});
+
+    activeRecording.vehicles.resize(kinematics.size());
+    for (const auto& v : data.vehicles()) {
+        RecordedVehicle& r = activeRecording.vehicles[v.simIndex];
+        r.trackId = v.trackId;
+        r.callsign = v.callsign;
+        r.priority = v.priority;
+    }
+    for (std::size_t slot = 0; slot < kinematics.size(); ++slot) {
+        RecordedVehicle& r = activeRecording.vehicles[slot];
+        r.posX = kinematics.posX[slot];
+        r.posY = kinematics.posY[slot];
+        r.speed = kinematics.speed[slot];
+        r.heading = kinematics.heading[slot];
+        r.targetSpeed = kinematics.targetSpeed[slot];
+        r.distanceToTarget = kinematics.distanceToTarget[slot];
+        r.fuelLevel = kinematics.fuelLevel[slot];
+        r.ammunitionLevel = kinematics.ammunitionLevel[slot];
+        r.consumption.fuelIdle = kinematics.fuelIdle[slot];
+        r.consumption.fuelLinear = kinematics.fuelLinear[slot];
+        r.consumption.fuelQuadratic = kinematics.fuelQuadratic[slot];
+        r.consumption.ammunition = kinematics.ammunitionRate[slot];
+        r.routeOffset = routes.offset[slot];
+        r.routeLength = routes.length[slot];
+        r.routeCursor = routes.cursor[slot];
+        r.routeLoop = routes.loop[slot] != 0;
+        r.turnRate = routes.turnRate[slot];
+        r.pendingSteps = static_cast<std::uint32_t>(simulationStep - kinematics.updatedStep[slot]);
+    }
+    activeRecording.routeX = routes.waypointX;
+    activeRecording.routeY = routes.waypointY;
+
+    recording = true;
+}
+
+SimulationRecording TacticalVehicleController::stopRecording() {
+    recording = false;
+    activeRecording.stepCount = simulationStep - activeRecording.startStep;
+    activeRecording.finalDigest = stateDigest();
+    return std::move(activeRecording);
+}
+
+/**
+ * @brief Rebuilds the recorded initial state and re-executes every step.
+ *
+ * Records are only published once at the end; intermediate steps run
+ * purely on the kinematic buffers.
+ */
+std::uint64_t TacticalVehicleController::replay(const SimulationRecording& source) {
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    recording = false;
+
+    std::deque<TacticalVehicle> vehicles;
+    for (const auto& r : source.vehicles) {
+        TacticalVehicle v;
+        v.trackId = r.trackId;
+        v.callsign = r.callsign;
+        v.priority = r.priority;
+        v.posX = r.posX;
+        v.posY = r.posY;
+        v.speed = r.speed;
+        v.heading = r.heading;
+        v.targetSpeed = r.targetSpeed;
+        v.distanceToTarget = r.distanceToTarget;
+        v.fuelLevel = r.fuelLevel;
+        v.ammunitionLevel = r.ammunitionLevel;
+        v.routeOffset = r.routeOffset;
+        v.routeLength = r.routeLength;
+        v.routeCursor = r.routeCursor;
+        v.routeLoop = r.routeLoop;
+        vehicles.push_back(v);
+    }
+
+    // Waypoints were recorded in the simulation frame
+    std::vector<RouteWaypoint> waypoints(source.routeX.size());
+    for (std::size_t i = 0; i < waypoints.size() && i < source.routeY.size(); ++i) {
+        waypoints[i].x = source.routeX[i];
+        waypoints[i].y = source.routeY[i];
+    }
+
+    data.replaceVehicles(std::move(vehicles), std::move(waypoints));
+    filteredVehicles.clear();
+    rateScheduler.setDivisors(source.rateDivisors);
+    simulationStep = source.startStep;
+    bindKinematics();
+
+    // Recorded coefficients win over the current lookup tables
+    for (std::size_t slot = 0; slot < source.vehicles.size(); ++slot) {
+        const ConsumptionProfile& profile = source.vehicles[slot].consumption;
+        kinematics.fuelIdle[slot] = profile.fuelIdle;
+        kinematics.fuelLinear[slot] = profile.fuelLinear;
+        kinematics.fuelQuadratic[slot] = profile.fuelQuadratic;
+        kinematics.ammunitionRate[slot] = profile.ammunition;
+        routes.turnRate[slot] = source.vehicles[slot].turnRate;
+        kinematics.updatedStep[slot] = simulationStep - source.vehicles[slot].pendingSteps;
+    }
+
+    random.setSeed(source.seed);
+    timestepSeconds = source.timestep;
+    timestepMicros = std::max<std::uint64_t>(1, std::llround(source.timestep * 1e6));
+    simulationMicros = source.startClock;
+
+    std::size_t targetCursor = 0;
+    TargetChange target;
+    for (std::uint64_t i = 0; i < source.stepCount; ++i) {
+        while (targetCursor < source.targets.size() && source.targets[targetCursor].step <= simulationStep) {
+            target = source.targets[targetCursor++];
+        }
+        advanceKinematics(target.targetX, target.targetY);
+    }
+
+    deadReckonPositions();
+    updateTargetMatrix();
+    updateClusters();
+    publishKinematics();
+    return stateDigest();
+}
+
+// --- Geodetic Mode ---
+/**
+ * @brief Switches to geodetic mode; positions are re-projected on the next step.
+ */
+void TacticalVehicleController::setGeodeticOrigin(double latitude, double longitude) {
+    tangentPlane.setOrigin(latitude, longitude);
+    geodeticMode = true;
+    kinematicsBound = false;
+}
+
+void TacticalVehicleController::disableGeodetic() {
+    geodeticMode = false;
+    largeAreaDistances = false;
+}
+
+MissionTarget TacticalVehicleController::projectTarget(double latitude, double longitude) const {
+    MissionTarget target;
+    tangentPlane.toEnu(&latitude, &longitude, &target.x, &target.y, 1);
+    return target;
+}
+
+/**
+ * @brief Batched projection of all feed-supplied WGS-84 positions into the
+ *        kinematic buffers. Cartesian-only tracks keep their posX/posY, and
+ *        carried slots their integrated position.
+ */
+void TacticalVehicleController::projectGeodeticPositions(const std::vector<std::uint8_t>& carried) {
+    const std::size_t count = kinematics.size();
+    std::vector<double> east(count);
+    std::vector<double> north(count);
+    geoLatitude.assign(count, 0.0);
+    geoLongitude.assign(count, 0.0);
+
+    for (const auto& v : data.vehicles()) {
+        if (v.hasGeodetic) {
+            geoLatitude[v.simIndex] = v.latitude;
+            geoLongitude[v.simIndex] = v.longitude;
+        }
+    }
+
+    tangentPlane.toEnu(geoLatitude.data(), geoLongitude.data(), east.data(), north.data(), count);
+
+    for (const auto& v : data.vehicles()) {
+        if (v.hasGeodetic && !carried[v.simIndex]) {
+            kinematics.posX[v.simIndex] = east[v.simIndex];
+            kinematics.posY[v.simIndex] = north[v.simIndex];
+        }
     }
 }
@@ -1,12 +1,36 @@
 #ifndef TACTICALVEHICLECONTROLLER_H
 #define TACTICALVEHICLECONTROLLER_H
 
+#include "ClusterIndex.h"
+#include "GeoProjection.h"
+#include "InterceptEngine.h"
+#include "ProximityGrid.h"
+#include "RateScheduler.h"
+#include "SimulationKernel.h"
+#include "SimulationRandom.h"
+#include "SimulationRecording.h"
+#include "TacticalVehicleData.h"
+#include "ValueHistogram.h"
+#include "VehicleChangeSet.h"
+
 #include <QString>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
 #include <vector>
 
-class TacticalVehicleData;
-struct TacticalVehicle;
+/**
+ * @enum DistanceReference
+ * @brief Selects which distance the distance range filter is evaluated against.
+ */
+enum class DistanceReference {
+    PrimaryTarget, ///< TacticalVehicle::distanceToTarget
+    NearestTarget, ///< Nearest target of the mission target set
+    MissionTarget  ///< One specific target of the set (FilterCriteria::distanceTargetIndex)
+};
 
 /**
  * @struct FilterCriteria
@@ -55,9 +79,34 @@ struct FilterCriteria {
     // distance slider is at its maximum. This is a deliberate shortcut.
     int distanceMin = 0;
     int distanceMax = 10000;
+    DistanceReference distanceReference = DistanceReference::PrimaryTarget;
+    int distanceTargetIndex = 0;
 
     // --- Affiliation ---
     QString affiliation = "All Types";
+
+    // --- Proximity ---
+    bool proximityActive = false;
+    QString proximityAffiliation;   ///< Keep vehicles within the proximity radius of this affiliation
+
+    // --- Intercept ---
+    bool interceptActive = false;
+    double interceptWithinSeconds = 0.0; ///< Keep vehicles whose threat CPA is at most this far ahead
+};
+
+/**
+ * @struct ExtrapolatedState
+ * @brief Dead-reckoned state of one vehicle at a requested simulation time.
+ */
+struct ExtrapolatedState {
+    double posX = 0.0;
+    double posY = 0.0;
+    double latitude = 0.0;          ///< Geodetic mode only
+    double longitude = 0.0;
+    double distanceToTarget = 0.0;  ///< To the primary target (meters)
+    double speed = 0.0;             ///< km/h, as of the last step
+    double heading = 0.0;           ///< Degrees, as of the last step
+    bool valid = false;             ///< false if the vehicle has no simulation slot
 };
 
 /**
@@ -77,15 +126,415 @@ public:
     void applyFilter(const FilterCriteria& criteria);
     bool isFilterActive() const;
 
+    /**
+     * @brief Matches criteria against the published records without
+     *        changing the controller; safe to call from a worker thread.
+     *
+     * Equivalent to the evaluation inside applyFilter(). While it runs,
+     * runSteps() keeps integrating but defers publishing instead of writing
+     * the records being read. The dataset must not be reloaded meanwhile.
+     *
+     * @param cancelled Polled while evaluating; once it reads true the
+     *        evaluation stops early and its result must be discarded.
+     */
+    std::vector<const TacticalVehicle*> evaluateFilter(const FilterCriteria& criteria,
+                                                       const std::atomic<bool>* cancelled = nullptr) const;
+
+    /// Installs a result of evaluateFilter() as the filtered view (GUI thread).
+    void installFilter(const FilterCriteria& criteria, std::vector<const TacticalVehicle*> result);
+
+    /// Incremented whenever filteredVehicles is rebuilt, including the
+    /// automatic re-filter after a fuel band crossing.
+    std::uint64_t filterRevision() const { return filterGeneration; }
+
     // --- Simulation ---
     void updateSimulation(double targetX, double targetY);
 
+    /**
+     * @brief Advances several steps back-to-back and publishes once at the end.
+     *
+     * Intended for headless batch runs where intermediate states are not
+     * rendered; equivalent to calling updateSimulation() steps times.
+     */
+    void runSteps(std::uint64_t steps, double targetX, double targetY);
+
+    /**
+     * @brief Integrates steps without publishing.
+     *
+     * Only the kinematic buffers advance; proximity, intercepts, clusters
+     * and the records wait for the next publish(). Lets a view integrate at
+     * its tick rate and pay for the derived passes at its refresh rate.
+     */
+    void advanceSteps(std::uint64_t steps, double targetX, double targetY);
+
+    /**
+     * @brief Refreshes derived data and writes the records.
+     *
+     * Deferred, like the publish in runSteps(), while a background filter
+     * evaluation reads the records.
+     */
+    void publish();
+
+    /// Publishes state deferred by a background filter evaluation, if any.
+    void publishDeferred();
+
+    /**
+     * @brief Appends a chunk of a dataset that is still loading.
+     *
+     * Takes recordsMutex, since a background filter evaluation may be
+     * reading the records. The simulation picks the new vehicles up on its
+     * next step; existing vehicles keep their state.
+     */
+    void appendVehicles(TacticalVehicleData::VehicleBatch batch);
+
+    /**
+     * @brief Removes the vehicles at the given positions of the master
+     *        container (e.g. a shard handing vehicles to its neighbour).
+     *
+     * The remaining vehicles keep their state; the slots are laid out
+     * again right away.
+     */
+    void removeVehicles(std::vector<std::size_t> positions);
+
+    /**
+     * @brief Number of threads the kernel pipeline may occupy on the shared
+     *        task scheduler (default 1).
+     *
+     * This is a parallelism hint: the pool itself is sized to the hardware,
+     * so filtering and sorting running at the same time never oversubscribe
+     * the cores. Slots are independent within a step, so results are
+     * identical for any thread count.
+     */
+    void setThreadCount(int threads);
+    int threadCount() const { return workerThreads; }
+
+    // --- Display Extrapolation ---
+    /**
+     * @brief Vehicle state dead-reckoned to timestamp (simulated seconds,
+     *        same clock as simulationClock()).
+     *
+     * Lets views refresh at display rate between simulation steps without
+     * advancing the simulation.
+     */
+    ExtrapolatedState extrapolate(const TacticalVehicle& vehicle, double timestamp) const;
+
+    /// Batched extrapolate() for all slots; arrays are indexed by simIndex.
+    void extrapolateAll(double timestamp, double* x, double* y, double* distance) const;
+
+    /// Simulated seconds at the most recent step.
+    double simulationClock() const { return simulationTime; }
+
+    // --- Rate Groups ---
+    /**
+     * @brief Ticks between updates for Flash, High, Routine and Low priority
+     *        tracks (default: 1 each, i.e. every track on every step).
+     *
+     * A track in a slower group is integrated over the time since its last
+     * update when it comes due, and is dead-reckoned along its current
+     * heading and speed when read in between. Groups are staggered across
+     * their period so the per-step cost stays flat.
+     *
+     * Ignored while recording, since a recording holds one set of divisors.
+     */
+    void setRateDivisors(const RateScheduler::Divisors& divisors);
+    const RateScheduler::Divisors& rateDivisors() const { return rateScheduler.divisors(); }
+
+    // --- Mission Target Set ---
+    /**
+     * @brief Configures additional objectives tracked alongside the primary target.
+     *
+     * Each step the controller maintains a vehicle x target distance matrix
+     * and publishes the nearest target per vehicle.
+     */
+    void setMissionTargets(const std::vector<MissionTarget>& targets);
+    const std::vector<MissionTarget>& missionTargets() const { return targetMatrix.targets; }
+
+    /// Distance from a vehicle to target k of the mission target set (meters).
+    double distanceToMissionTarget(const TacticalVehicle& vehicle, std::size_t target) const;
+
+    /// Sorts a pointer view by distance to target k, reading the matrix directly.
+    void sortByMissionTarget(std::vector<const TacticalVehicle*>& view, std::size_t target, bool ascending) const;
+
+    // --- Geodetic Mode ---
+    /**
+     * @brief Enables geodetic mode with an ENU tangent plane at the given origin.
+     *
+     * Vehicles with a WGS-84 position are projected into posX/posY (east/north)
+     * and the simulation keeps integrating in meters at full speed; latitude
+     * and longitude are recovered with one batched inverse projection when
+     * state is published.
+     */
+    void setGeodeticOrigin(double latitude, double longitude);
+    void disableGeodetic();
+    bool isGeodetic() const { return geodeticMode; }
+    const LocalTangentPlane& projection() const { return tangentPlane; }
+
+    /// Projects a WGS-84 location into the simulation's Cartesian frame.
+    MissionTarget projectTarget(double latitude, double longitude) const;
+
+    /**
+     * @brief Uses great-circle (haversine) distances to the primary target.
+     *
+     * For operational areas too large for a single tangent plane. Evaluated
+     * once per publish rather than per step, so stepping throughput is unaffected.
+     * Only the published target distance changes: integration, proximity,
+     * intercepts and clustering still run in the one tangent plane, so their
+     * planar error keeps growing with distance from the origin.
+     */
+    void setLargeAreaDistances(bool enabled) { largeAreaDistances = enabled; }
+
+    // --- Proximity ---
+    /**
+     * @brief Radius (meters) of the proximity pass; 0 disables it.
+     *
+     * Every friendly-hostile pair and every pair of friendly aircraft
+     * (deconfliction) that came closer than the radius since the previous
+     * publish is reported in proximityPairs(), with its closest approach,
+     * and summarized per vehicle in proximityMask. Tracks are swept as
+     * straight moves between samples taken whenever the fastest track may
+     * have covered half the radius, so contacts made and broken during a
+     * multi-step call are not missed.
+     */
+    void setProximityRadius(double meters);
+    double proximityRadius() const { return proximityRange; }
+
+    /// Pairs in contact since the previous publish, ordered by (first, second) slot.
+    const std::vector<ProximityPair>& proximityPairs() const { return proximityResults; }
+
+    // --- Clustering ---
+    /**
+     * @brief Maintains a ClusterIndex over the published positions (off by
+     *        default, since headless runs do not render).
+     *
+     * The index is updated incrementally on every publish, so map views can
+     * ask for the clusters of any zoom level and viewport without a rebuild.
+     */
+    void setClusteringEnabled(bool enabled);
+    bool isClusteringEnabled() const { return clusteringEnabled; }
+    const ClusterIndex& clusters() const { return clusterIndex; }
+
+    // --- Intercept Geometry ---
+    /**
+     * @brief Restricts CPA evaluation to the given friendly and hostile sets.
+     *
+     * By default (and after every dataset reload) all Friendly tracks are
+     * paired with all Hostile tracks. Sets survive appended chunks, which
+     * join the default sets only.
+     */
+    void setInterceptSets(const std::vector<const TacticalVehicle*>& friendly,
+                          const std::vector<const TacticalVehicle*>& hostile);
+    void resetInterceptSets();
+
+    /// CPA separation (meters) below which an opposing track counts as a threat.
+    void setInterceptRadius(double meters) { interceptRange = meters; }
+    double interceptRadius() const { return interceptRange; }
+
+    /// Pairs re-solved at the last publish (the rest were served from cache).
+    std::size_t interceptPairsSolved() const { return interceptSolved; }
+
+    // --- Consumables ---
+    /**
+     * @brief Fuel and ammunition levels (%) that raise a SupplyEvent when a
+     *        vehicle drops below them (default: 20% each).
+     */
+    void setSupplyAlertLevels(const std::vector<double>& fuel, const std::vector<double>& ammunition);
+
+    /**
+     * @brief Returns and clears the alerts raised since the last call,
+     *        ordered by step, then slot.
+     */
+    std::vector<SupplyEvent> takeSupplyEvents();
+
+    // --- Distributions ---
+    /**
+     * @brief Fuel level (%) of all tracks in 50 buckets over 0-100.
+     *
+     * Maintained on ingest and adjusted per changed track on every publish,
+     * so reading it never scans the fleet.
+     */
+    const ValueHistogram& fuelHistogram() const { return fuelBuckets; }
+
+    /// Distance to the primary target in 50 buckets over 0-10 km (farther
+    /// tracks count in the last bucket), maintained like fuelHistogram().
+    const ValueHistogram& distanceHistogram() const { return distanceBuckets; }
+
+    // --- Change Tracking ---
+    /**
+     * @brief Returns and clears the per-vehicle field changes published since
+     *        the last call; reloaded() is set when the dataset was replaced
+     *        and relayout() when appended vehicles moved slots around.
+     */
+    VehicleChangeSet takeChanges();
+
+    /**
+     * @brief Vehicle occupying a simulation slot (nullptr if out of range).
+     *
+     * Resolved through an index rebuilt on publish and after each rebind.
+     */
+    const TacticalVehicle* vehicleForSlot(std::size_t slot) const;
+
+    /// Read-only access to the contiguous simulation state, indexed by simIndex.
+    const KinematicsBuffers& kinematicState() const { return kinematics; }
+
+    /**
+     * @brief Forces the scalar reference kernel instead of the vectorized one.
+     *
+     * Intended for verification and profiling; results are bit-identical.
+     */
+    void setUseScalarKernel(bool enabled) { useScalarKernel = enabled; }
+
+    void setRandomSeed(std::uint64_t seed);
+    std::uint64_t randomSeed() const { return random.seed(); }
+
+    /**
+     * @brief Sets the simulated time advanced per step (seconds).
+     *
+     * Independent of wall-clock timer jitter, so a step always advances
+     * the same amount of simulated time. May change between steps (see
+     * SimulationClock); tracks lagging in slower rate groups are first
+     * brought up to date at the old timestep. Rejected while recording,
+     * since recordings assume a fixed timestep.
+     */
+    void setTimestep(double seconds);
+    double timestep() const { return timestepSeconds; }
+
+    std::uint64_t currentStep() const { return simulationStep; }
+
+    /// Digest of the current kinematic state (see SimulationKernel::digest()).
+    std::uint64_t stateDigest() const { return SimulationKernel::digest(kinematics); }
+
+    // --- Deterministic Recording & Replay ---
+    /**
+     * @brief Captures seed, timestep and initial state; subsequent target
+     *        changes passed to updateSimulation() are appended.
+     */
+    void startRecording(double targetX, double targetY);
+    SimulationRecording stopRecording();
+    bool isRecording() const { return recording; }
+
+    /**
+     * @brief Replaces the dataset with the recording's initial state and
+     *        re-runs all recorded steps headless, as fast as possible.
+     * @return Digest of the final state; equals recording.finalDigest for a bit-exact replay.
+     */
+    std::uint64_t replay(const SimulationRecording& source);
+
     // --- Derived Views ---
     std::vector<const TacticalVehicle*> filteredVehicles;
 
 private:
+    // --- Simulation Binding ---
+    void ensureKinematicsBound();
+    bool kinematicsStale() const;
+    void bindKinematics();
+    void bindRoutes();
+    void advanceKinematics(double targetX, double targetY);
+    void advanceRange(std::size_t begin, std::size_t end, std::uint64_t fromStep, std::uint64_t toStep,
+                      double targetX, double targetY);
+    std::uint64_t clockAtStep(std::uint64_t step) const;
+    void synchronizeSlots();
+    void deadReckonPositions();
+    void updateTargetMatrix();
+    void updateProximity();
+    void sampleProximitySweep(const double* posX, const double* posY);
+    void sweepProximity(const double* toX, const double* toY);
+    void updateIntercepts();
+    void updateClusters();
+    void configureDefaultInterceptSets();
+    void projectGeodeticPositions(const std::vector<std::uint8_t>& carried);
+    std::vector<const TacticalVehicle*> evaluate(const FilterCriteria& criteria,
+                                                 const std::atomic<bool>* cancelled) const;
+    void refreshPublishedState();
+    void forEachChunk(const char* label, const std::function<void(std::size_t, std::size_t)>& work);
+    void forEachChunk(const char* label, std::size_t first, std::size_t last,
+                      const std::function<void(std::size_t, std::size_t)>& work);
+    void collectSupplyEvents(std::size_t first);
+    void rebuildSupplyThresholds();
+    void publishKinematics();
+    void rebuildSlotIndex() const;
+
     // --- Data Reference ---
     TacticalVehicleData& data; ///< Authoritative vehicle data store
+
+    // --- Simulation State ---
+    KinematicsBuffers kinematics;     ///< Contiguous telemetry working set, indexed by simIndex
+    TargetDistanceMatrix targetMatrix;///< Vehicle x mission target distances
+    RouteArena routes;                ///< Flat waypoint arena and per-slot route progress
+    double lastTargetX = 0.0;         ///< Primary target of the most recent step
+    double lastTargetY = 0.0;
+    std::size_t boundRevision = 0;    ///< Dataset revision the buffers were built from
+    std::size_t boundGeneration = 0;  ///< Dataset generation; unchanged while vehicles are only appended or removed
+    SimulationRandom random;          ///< Counter-based jitter source, keyed by (vehicle, second)
+    std::uint64_t simulationStep = 0; ///< Step counter driving the rate group phases
+    double simulationTime = 0.0;      ///< Simulated seconds since the dataset was bound
+    std::uint64_t simulationMicros = 0; ///< Same clock in whole microseconds; jitter seconds are counted on it
+    double timestepSeconds = 1.0;     ///< Fixed simulated time per step
+    std::uint64_t timestepMicros = 1000000; ///< timestepSeconds rounded to microseconds
+    int workerThreads = 1;            ///< Parallelism hint for the kernel pipeline
+    bool kinematicsBound = false;
+    bool useScalarKernel = false;
+
+    // --- Rate Group State ---
+    RateScheduler rateScheduler;      ///< Per-priority update divisors and phases
+    std::vector<SlotRange> dueRanges; ///< Ranges integrated on the current step
+    std::vector<double> readPosX;     ///< Dead-reckoned positions (empty while all groups are current)
+    std::vector<double> readPosY;
+    std::vector<double> readDistance;
+
+    // --- Proximity State ---
+    ProximityGrid proximityGrid;
+    std::vector<ProximityPair> proximityResults;
+    std::vector<std::uint8_t> proximityGroup;   ///< Per-slot group: ProximityClass * 2 + aerial
+    std::vector<std::uint8_t> proximityMask;    ///< Per-slot mask of classes in range
+    std::vector<std::int32_t> proximityContacts;
+    std::mutex proximityMutex;                  ///< Guards sweptPairs while chunks run concurrently
+    double proximityRange = 1000.0;
+    std::vector<ProximityPair> sweptPairs;      ///< Found since the last publish, unmerged
+    std::vector<double> sweepFromX;             ///< Positions the next sweep starts at (empty = none)
+    std::vector<double> sweepFromY;
+    double sweepElapsed = 0.0;                  ///< Simulated seconds since the sweep sample
+    double sweepSpeedLimit = 0.0;               ///< Fastest track at the sample (m/s)
+
+    // --- Cluster State ---
+    ClusterIndex clusterIndex;
+    std::vector<std::uint8_t> clusterAffiliation; ///< Per-slot ClusterAffiliation
+    std::vector<std::uint8_t> clusterDomain;      ///< Per-slot ClusterDomain
+    bool clusteringEnabled = false;
+
+    // --- Intercept State ---
+    InterceptEngine interceptEngine;
+    std::vector<double> etaToTarget;            ///< Per-slot ETA, refreshed on publish
+    double interceptRange = 1000.0;
+    std::size_t interceptSolved = 0;
+    bool customInterceptSets = false;           ///< Sets came from setInterceptSets(), kept while the dataset grows
+
+    // --- Consumable State ---
+    std::vector<double> fuelAlertLevels{20.0};
+    std::vector<double> ammunitionAlertLevels{20.0};
+    SupplyThresholds supplyThresholds;       ///< Alert levels plus the active fuel filter band
+    std::vector<SupplyEvent> supplyEvents;   ///< Pending alerts, drained by takeSupplyEvents()
+    std::mutex supplyEventMutex;             ///< Guards supplyEvents while chunks run concurrently
+    mutable std::vector<TacticalVehicle*> vehicleBySlot; ///< Rebuilt on publish and after a rebind
+    VehicleChangeSet pendingChanges;         ///< Published field changes, drained by takeChanges()
+    ValueHistogram fuelBuckets{0.0, 100.0, 50};
+    ValueHistogram distanceBuckets{0.0, 10000.0, 50};
+    FilterCriteria activeCriteria;           ///< Last criteria passed to applyFilter()
+    bool filterApplied = false;
+    std::uint64_t filterGeneration = 0;
+    bool fuelBandCrossed = false;            ///< A vehicle left or entered the fuel filter band
+    mutable std::mutex recordsMutex;         ///< Held while published records are written or filtered
+    bool publishPending = false;             ///< Steps were integrated since the last publish
+
+    // --- Geodetic State ---
+    LocalTangentPlane tangentPlane;
+    std::vector<double> geoLatitude;  ///< Per-slot latitude, refreshed on publish
+    std::vector<double> geoLongitude; ///< Per-slot longitude, refreshed on publish
+    bool geodeticMode = false;
+    bool largeAreaDistances = false;
+
+    // --- Recording State ---
+    SimulationRecording activeRecording;
+    bool recording = false;
 };
 
 #endif // TACTICALVEHICLECONTROLLER_H
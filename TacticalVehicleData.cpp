@@ -1,4 +1,5 @@
 #include "TacticalVehicleData.h"
+#include "TaskScheduler.h"
 
 #include <QJsonDocument>
 #include <QJsonArray>
@@ -6,10 +7,76 @@
 #include <QFile>
 #include <QDebug>
 
+#include <algorithm>
+#include <utility>
+
 // --- TacticalVehicleData Implementation ---
 // Owns the persistent tactical dataset and provides JSON ingestion,
 // controlled container access, and stateless sorting predicates.
 
+namespace {
+// Maps one JSON record onto a vehicle and its route waypoints. Touches no
+// shared state, so records can be parsed concurrently.
+void parseVehicleRecord(const QJsonObject &obj, TacticalVehicle &v, std::vector<RouteWaypoint> &route) {
+    // --- Static Identity & Classification ---
+    v.callsign       = obj["callsign"].toString();
+    v.trackId        = obj["trackId"].toString();
+    v.type           = obj["type"].toString();
+    v.classification = obj["classification"].toString();
+    v.affiliation    = obj["affiliation"].toString();
+    v.priority       = obj["priority"].toString();
+    v.domain         = obj["domain"].toString();
+    v.propulsion     = obj["propulsion"].toString();
+    v.natoIcon       = obj["natoIcon"].toString();
+
+    // --- Operational Capabilities ---
+    v.hasSatCom        = obj["hasSatCom"].toBool();
+    v.isAmphibious     = obj["isAmphibious"].toBool();
+    v.isUnmanned       = obj["isUnmanned"].toBool();
+    v.hasActiveDefense = obj["hasActiveDefense"].toBool();
+
+    // --- Technical Specs & Telemetry Baseline ---
+    v.protectionLevel  = obj["protectionLevel"].toInt();
+    v.speed            = obj["speed"].toDouble();
+    v.maxSpeed         = obj["maxSpeed"].toDouble();
+    v.targetSpeed      = obj["targetSpeed"].toDouble();
+    v.fuelLevel        = obj["fuelLevel"].toDouble();
+    v.ammunitionLevel  = obj["ammunitionLevel"].toDouble();
+    v.posX             = obj["posX"].toDouble();
+    v.posY             = obj["posY"].toDouble();
+    v.heading          = obj["heading"].toDouble();
+
+    // --- Optional Geodetic Position (WGS-84) ---
+    if (obj.contains("latitude") && obj.contains("longitude")) {
+        v.latitude    = obj["latitude"].toDouble();
+        v.longitude   = obj["longitude"].toDouble();
+        v.hasGeodetic = true;
+    }
+
+    // --- Optional Route (appended to the shared arena by the caller) ---
+    // Waypoints are {"x", "y"} in meters or {"latitude", "longitude"}.
+    const QJsonArray waypoints = obj["route"].toArray();
+    v.routeLength = static_cast<std::uint32_t>(waypoints.size());
+    v.routeLoop   = obj["routeLoop"].toBool();
+    for (const QJsonValue &point : waypoints) {
+        const QJsonObject waypoint = point.toObject();
+        RouteWaypoint w;
+        if (waypoint.contains("latitude") && waypoint.contains("longitude")) {
+            w.latitude    = waypoint["latitude"].toDouble();
+            w.longitude   = waypoint["longitude"].toDouble();
+            w.hasGeodetic = true;
+        } else {
+            w.x = waypoint["x"].toDouble();
+            w.y = waypoint["y"].toDouble();
+        }
+        route.push_back(w);
+    }
+
+    // Distance is dynamically updated by the simulation engine
+    v.distanceToTarget = 0.0;
+}
+}
+
 // --- Lifecycle ---
 TacticalVehicleData::TacticalVehicleData() {
     // Intentionally minimal.
@@ -20,20 +87,31 @@ TacticalVehicleData::TacticalVehicleData() {
 /**
  * @brief Parses data from a JSON file and initializes internal containers.
  *
- * This function fully resets the internal dataset before loading to ensure
- * no stale or partially-loaded data remains.
+ * The dataset is replaced as a whole once the file has been read, so no
+ * stale or partially-loaded data remains. A file that cannot be read or
+ * parsed leaves the current dataset untouched.
  *
  * @param path The file system path or Qt resource path to the source JSON file.
  */
 void TacticalVehicleData::loadVehiclesFromJson(const QString &path) {
-    QFile file(path);
-    if (!file.open(QIODevice::ReadOnly)) {
-        qWarning() << "Data Error: Unable to open JSON file at" << path;
+    QJsonArray records;
+    if (!readJsonRecords(path, records)) {
         return;
     }
 
     // Reset database to ensure a clean, deterministic state
-    allVehicles.clear();
+    replaceVehicles({}, {});
+    appendVehicles(parseRecords(records, 0, static_cast<std::size_t>(records.size())));
+
+    qDebug() << "Tactical System: Successfully indexed" << allVehicles.size() << "assets.";
+}
+
+bool TacticalVehicleData::readJsonRecords(const QString &path, QJsonArray &records) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Data Error: Unable to open JSON file at" << path;
+        return false;
+    }
 
     QByteArray data = file.readAll();
     file.close();
@@ -44,55 +122,107 @@ void TacticalVehicleData::loadVehiclesFromJson(const QString &path) {
     // Validation of JSON syntax and high-level structure
     if (parseError.error != QJsonParseError::NoError) {
         qWarning() << "Parse Error at offset" << parseError.offset << ":" << parseError.errorString();
-        return;
+        return false;
     }
     if (!doc.isArray()) {
         qWarning() << "Structural Error: JSON root must be an array.";
-        return;
+        return false;
     }
 
-    QJsonArray array = doc.array();
-
-    // Map JSON attributes to TacticalVehicle member variables
-    for (const QJsonValue &value : std::as_const(array)) {
-        QJsonObject obj = value.toObject();
-        TacticalVehicle v;
-
-        // --- Static Identity & Classification ---
-        v.callsign       = obj["callsign"].toString();
-        v.trackId        = obj["trackId"].toString();
-        v.type           = obj["type"].toString();
-        v.classification = obj["classification"].toString();
-        v.affiliation    = obj["affiliation"].toString();
-        v.priority       = obj["priority"].toString();
-        v.domain         = obj["domain"].toString();
-        v.propulsion     = obj["propulsion"].toString();
-        v.natoIcon       = obj["natoIcon"].toString();
-
-        // --- Operational Capabilities ---
-        v.hasSatCom        = obj["hasSatCom"].toBool();
-        v.isAmphibious     = obj["isAmphibious"].toBool();
-        v.isUnmanned       = obj["isUnmanned"].toBool();
-        v.hasActiveDefense = obj["hasActiveDefense"].toBool();
-
-        // --- Technical Specs & Telemetry Baseline ---
-        v.protectionLevel  = obj["protectionLevel"].toInt();
-        v.speed            = obj["speed"].toDouble();
-        v.maxSpeed         = obj["maxSpeed"].toDouble();
-        v.targetSpeed      = obj["targetSpeed"].toDouble();
-        v.fuelLevel        = obj["fuelLevel"].toDouble();
-        v.ammunitionLevel  = obj["ammunitionLevel"].toDouble();
-        v.posX             = obj["posX"].toDouble();
-        v.posY             = obj["posY"].toDouble();
-        v.heading          = obj["heading"].toDouble();
-
-        // Distance is dynamically updated by the simulation engine
-        v.distanceToTarget = 0.0;
-
-        allVehicles.push_back(v);
+    records = doc.array();
+    return true;
+}
+
+/**
+ * @brief Parses a range of records into a batch.
+ *
+ * Records are parsed in parallel, then concatenated in file order so route
+ * offsets and the container layout do not depend on thread timing.
+ */
+TacticalVehicleData::VehicleBatch TacticalVehicleData::parseRecords(const QJsonArray &records,
+                                                                    std::size_t begin, std::size_t end) {
+    constexpr std::size_t MIN_RECORDS_PER_TASK = 1024;
+    end = std::min(end, static_cast<std::size_t>(records.size()));
+    const std::size_t count = begin < end ? end - begin : 0;
+    std::vector<TacticalVehicle> parsed(count);
+    std::vector<std::vector<RouteWaypoint>> parsedRoutes(count);
+
+    TaskScheduler& scheduler = TaskScheduler::shared();
+    scheduler.parallelFor("ingest.parse", 0, count, MIN_RECORDS_PER_TASK, scheduler.concurrency() * 4,
+                          [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            parseVehicleRecord(records.at(static_cast<qsizetype>(begin + i)).toObject(),
+                               parsed[i], parsedRoutes[i]);
+        }
+    });
+
+    VehicleBatch batch;
+    batch.vehicles = std::move(parsed);
+    for (std::size_t i = 0; i < count; ++i) {
+        batch.vehicles[i].routeOffset = static_cast<std::uint32_t>(batch.routes.size());
+        batch.routes.insert(batch.routes.end(), parsedRoutes[i].begin(), parsedRoutes[i].end());
     }
+    return batch;
+}
 
-    qDebug() << "Tactical System: Successfully indexed" << allVehicles.size() << "assets.";
+/**
+ * @brief Appends a parsed batch; the deque keeps earlier vehicles in place,
+ *        so views holding pointers into the dataset stay valid.
+ *
+ * New vehicles take their container position as a provisional simIndex.
+ * It lies past every slot bound so far, which is how a binding tells the
+ * appended vehicles from the ones whose state it keeps.
+ */
+void TacticalVehicleData::appendVehicles(VehicleBatch batch) {
+    const std::uint32_t base = static_cast<std::uint32_t>(routeArena.size());
+    routeArena.insert(routeArena.end(), batch.routes.begin(), batch.routes.end());
+    for (TacticalVehicle& vehicle : batch.vehicles) {
+        vehicle.routeOffset += base;
+        vehicle.simIndex = allVehicles.size();
+        allVehicles.push_back(std::move(vehicle));
+    }
+    ++datasetRevision;
+}
+
+void TacticalVehicleData::removeVehicles(std::vector<std::size_t> positions) {
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+
+    std::deque<TacticalVehicle> vehicles;
+    std::vector<RouteWaypoint> routes;
+    routes.reserve(routeArena.size());
+
+    std::size_t nextRemoved = 0;
+    for (std::size_t i = 0; i < allVehicles.size(); ++i) {
+        if (nextRemoved < positions.size() && positions[nextRemoved] == i) {
+            ++nextRemoved;
+            continue;
+        }
+        TacticalVehicle& v = allVehicles[i];
+        const auto routeBase = static_cast<std::uint32_t>(routes.size());
+        if (std::size_t(v.routeOffset) + v.routeLength <= routeArena.size()) {
+            routes.insert(routes.end(), routeArena.begin() + v.routeOffset,
+                          routeArena.begin() + v.routeOffset + v.routeLength);
+        } else {
+            v.routeLength = 0;
+        }
+        v.routeOffset = routeBase;
+        vehicles.push_back(std::move(v));
+    }
+
+    allVehicles = std::move(vehicles);
+    routeArena = std::move(routes);
+    ++datasetRevision;
+}
+
+/**
+ * @brief Installs a complete dataset and invalidates dependent caches.
+ */
+void TacticalVehicleData::replaceVehicles(std::deque<TacticalVehicle> vehicles, std::vector<RouteWaypoint> routes) {
+    allVehicles = std::move(vehicles);
+    routeArena = std::move(routes);
+    ++datasetRevision;
+    ++datasetGeneration;
 }
 
 // --- Container Accessors ---
@@ -108,16 +238,16 @@ const std::deque<TacticalVehicle>& TacticalVehicleData::vehicles() const {
 /**
  * @brief Mutable access to the vehicle container.
  *
- * Intended for controlled use cases such as:
- *  - Simulation updates
- *  - In-place sorting of the master dataset
+ * Intended for simulation updates, which write telemetry fields in place.
+ * The container is never reordered: simulation slots and cached record
+ * pointers rely on that between rebinds.
  */
 std::deque<TacticalVehicle>& TacticalVehicleData::vehiclesMutable() {
     return allVehicles;
 }
 
 // --- Static Sorting Predicates ---
-// Used by std::sort to arrange filtered pointer views and the master container.
+// Used by std::sort to arrange filtered pointer views.
 
 // --- Distance Sorting ---
 bool TacticalVehicleData::sortByDistanceAsc(const TacticalVehicle* a, const TacticalVehicle* b) {
@@ -128,6 +258,31 @@ bool TacticalVehicleData::sortByDistanceDesc(const TacticalVehicle* a, const Tac
     return a->distanceToTarget > b->distanceToTarget;
 }
 
+bool TacticalVehicleData::sortByNearestTargetAsc(const TacticalVehicle* a, const TacticalVehicle* b) {
+    return a->nearestTargetDistance < b->nearestTargetDistance;
+}
+
+bool TacticalVehicleData::sortByNearestTargetDesc(const TacticalVehicle* a, const TacticalVehicle* b) {
+    return a->nearestTargetDistance > b->nearestTargetDistance;
+}
+
+// --- Intercept Sorting ---
+bool TacticalVehicleData::sortByTimeToCpaAsc(const TacticalVehicle* a, const TacticalVehicle* b) {
+    return a->timeToCpa < b->timeToCpa;
+}
+
+bool TacticalVehicleData::sortByTimeToCpaDesc(const TacticalVehicle* a, const TacticalVehicle* b) {
+    return a->timeToCpa > b->timeToCpa;
+}
+
+bool TacticalVehicleData::sortByEtaAsc(const TacticalVehicle* a, const TacticalVehicle* b) {
+    return a->etaToTarget < b->etaToTarget;
+}
+
+bool TacticalVehicleData::sortByEtaDesc(const TacticalVehicle* a, const TacticalVehicle* b) {
+    return a->etaToTarget > b->etaToTarget;
+}
+
 // --- Fuel Economy Sorting ---
 bool TacticalVehicleData::sortByFuelAsc(const TacticalVehicle* a, const TacticalVehicle* b) {
     return a->fuelLevel < b->fuelLevel;
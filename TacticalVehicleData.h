@@ -3,9 +3,11 @@
 
 #include "TacticalVehicle.h"
 
+#include <QJsonArray>
 #include <QString>
 
 #include <deque>
+#include <vector>
 
 /**
  * @class TacticalVehicleData
@@ -16,26 +18,105 @@
  */
 class TacticalVehicleData {
 public:
+    /**
+     * @struct VehicleBatch
+     * @brief A run of parsed records and their waypoints, ready to append.
+     *
+     * Route offsets index into routes; appendVehicles() rebases them onto
+     * the dataset's arena.
+     */
+    struct VehicleBatch {
+        std::vector<TacticalVehicle> vehicles;
+        std::vector<RouteWaypoint> routes;
+    };
+
     // --- Lifecycle ---
     TacticalVehicleData();
 
     // --- Persistence ---
     /**
      * @brief Loads and parses vehicle data from a JSON resource.
+     *
+     * The current dataset is kept if the file cannot be read or parsed.
      * @param path File system or Qt resource path (e.g. ":/data/vehicles.json")
      */
     void loadVehiclesFromJson(const QString &path);
 
+    /**
+     * @brief Replaces the dataset with an externally constructed one.
+     *
+     * Used when vehicles originate from a source other than JSON
+     * (e.g. a simulation recording being replayed). Route offsets of the
+     * vehicles index into the supplied waypoint arena.
+     */
+    void replaceVehicles(std::deque<TacticalVehicle> vehicles, std::vector<RouteWaypoint> routes = {});
+
+    /**
+     * @brief Appends parsed records to the dataset (progressive loading).
+     *
+     * Existing vehicles keep their addresses and their simIndex; the
+     * revision is incremented so dependent caches rebind, but the
+     * generation is not, so the simulation keeps their state.
+     */
+    void appendVehicles(VehicleBatch batch);
+
+    /**
+     * @brief Removes the vehicles at the given container positions.
+     *
+     * Survivors keep their order and simIndex, and the route arena is
+     * compacted to their routes. References into the container are
+     * invalidated. Like appendVehicles(), this increments the revision but
+     * not the generation.
+     */
+    void removeVehicles(std::vector<std::size_t> positions);
+
+    // --- Incremental Ingestion ---
+    // Stateless halves of loadVehiclesFromJson(), so a loader thread can
+    // parse a dataset in chunks and hand them over with appendVehicles().
+
+    /**
+     * @brief Reads a JSON file and returns its top-level record array.
+     * @return False (with a warning) if the file cannot be read or is not an array.
+     */
+    static bool readJsonRecords(const QString &path, QJsonArray &records);
+
+    /// Parses records [begin, end) in parallel, keeping file order.
+    static VehicleBatch parseRecords(const QJsonArray &records, std::size_t begin, std::size_t end);
+
     // --- Data Access ---
     const std::deque<TacticalVehicle>& vehicles() const;
     std::deque<TacticalVehicle>& vehiclesMutable();
 
+    /// Flat waypoint arena shared by all routes (see TacticalVehicle::routeOffset).
+    const std::vector<RouteWaypoint>& routeWaypoints() const { return routeArena; }
+
+    /**
+     * @brief Monotonic counter incremented whenever the dataset is reloaded.
+     *
+     * Lets dependent caches (e.g. simulation buffers) detect stale bindings.
+     */
+    std::size_t revision() const { return datasetRevision; }
+
+    /**
+     * @brief Counter incremented when the dataset is replaced, but not when
+     *        vehicles are appended to or removed from it.
+     */
+    std::size_t generation() const { return datasetGeneration; }
+
     // --- Sorting Predicates ---
     // Stateless comparators intended for std::sort on pointer-based views.
 
     // Distance-based
     static bool sortByDistanceAsc(const TacticalVehicle* a, const TacticalVehicle* b);
     static bool sortByDistanceDesc(const TacticalVehicle* a, const TacticalVehicle* b);
+    static bool sortByNearestTargetAsc(const TacticalVehicle* a, const TacticalVehicle* b);
+    static bool sortByNearestTargetDesc(const TacticalVehicle* a, const TacticalVehicle* b);
+
+    // Intercept-based
+    static bool sortByTimeToCpaAsc(const TacticalVehicle* a, const TacticalVehicle* b);
+    static bool sortByTimeToCpaDesc(const TacticalVehicle* a, const TacticalVehicle* b);
+    static bool sortByEtaAsc(const TacticalVehicle* a, const TacticalVehicle* b);
+    static bool sortByEtaDesc(const TacticalVehicle* a, const TacticalVehicle* b);
 
     // Fuel-based
     static bool sortByFuelAsc(const TacticalVehicle* a, const TacticalVehicle* b);
@@ -52,6 +133,9 @@ public:
 private:
     // --- Data Storage ---
     std::deque<TacticalVehicle> allVehicles; ///< Master container owning all vehicles
+    std::vector<RouteWaypoint> routeArena;   ///< Waypoints of all routes, back to back
+    std::size_t datasetRevision = 0;         ///< Incremented on every (re)load
+    std::size_t datasetGeneration = 0;       ///< Incremented when the dataset is replaced
 };
 
 #endif // TACTICALVEHICLEDATA_H
@@ -6,18 +6,58 @@ QT = core gui
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
 SOURCES += \
+    ClusterIndex.cpp \
+    ConsumptionModel.cpp \
+    DatasetLoader.cpp \
+    FilterWorker.cpp \
+    FixedFormat.cpp \
+    GeoProjection.cpp \
+    InterceptEngine.cpp \
     MainWindow.cpp \
+    PerformanceMonitor.cpp \
+    ProximityGrid.cpp \
     RangeSlider.cpp \
+    RateScheduler.cpp \
+    SimulationClock.cpp \
+    SimulationKernel.cpp \
+    SimulationRecording.cpp \
+    TacticalMapView.cpp \
     TacticalVehicleController.cpp \
     TacticalVehicleData.cpp \
+    TaskScheduler.cpp \
+    TrackUpdateBus.cpp \
+    ValueHistogram.cpp \
+    VehicleChangeSet.cpp \
+    VehicleTableModel.cpp \
     main.cpp
 
 HEADERS += \
+    ClusterIndex.h \
+    ConsumptionModel.h \
+    DatasetLoader.h \
+    FilterWorker.h \
+    FixedFormat.h \
+    GeoProjection.h \
+    InterceptEngine.h \
     MainWindow.h \
+    PerformanceMonitor.h \
+    ProximityGrid.h \
     RangeSlider.h \
+    RateScheduler.h \
+    SimdSupport.h \
+    SimulationClock.h \
+    SimulationKernel.h \
+    SimulationRandom.h \
+    SimulationRecording.h \
+    TacticalMapView.h \
     TacticalVehicle.h \
     TacticalVehicleController.h \
-    TacticalVehicleData.h
+    TacticalVehicleData.h \
+    TaskScheduler.h \
+    TrackUpdateBus.h \
+    ValueHistogram.h \
+    VehicleChangeSet.h \
+    VehicleTableModel.h
 
 RESOURCES += \
     resources.qrc
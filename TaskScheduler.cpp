@@ -0,0 +1,246 @@
+#include "TaskScheduler.h"
+
+#include <chrono>
+
+// --- TaskScheduler Implementation ---
+
+namespace {
+// Identifies the pool and queue of the current thread (outside threads: none)
+thread_local const TaskScheduler* t_owner = nullptr;
+thread_local std::size_t t_queue = 0;
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+// --- TaskGroup ---
+TaskGroup::TaskGroup(TaskScheduler& scheduler) : m_scheduler(scheduler) {
+}
+
+TaskGroup::~TaskGroup() {
+    wait();
+}
+
+void TaskGroup::run(const char* label, std::function<void()> fn) {
+    m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    TaskScheduler::WorkItem item;
+    item.fn = std::move(fn);
+    item.label = label;
+    item.group = this;
+    m_scheduler.submit(std::move(item));
+}
+
+void TaskGroup::wait() {
+    while (m_pending.load(std::memory_order_acquire) > 0) {
+        if (m_scheduler.runOne()) {
+            continue;
+        }
+        // The remaining tasks are running elsewhere; sleep until the last
+        // one finishes or there is new work to help with
+        std::unique_lock<std::mutex> lock(m_scheduler.m_sleepMutex);
+        m_scheduler.m_wake.wait(lock, [this] {
+            return m_pending.load(std::memory_order_acquire) == 0 ||
+                   m_scheduler.m_queued.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+// --- Lifecycle ---
+TaskScheduler::TaskScheduler(unsigned workers) {
+    if (workers == 0) {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        workers = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    for (unsigned i = 0; i <= workers; ++i) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+    m_busyMs.assign(workers + 1, 0.0);
+
+    m_threads.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i) {
+        m_threads.emplace_back(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+TaskScheduler& TaskScheduler::shared() {
+    static TaskScheduler instance;
+    return instance;
+}
+
+// --- Queues ---
+std::size_t TaskScheduler::currentQueue() const {
+    return t_owner == this ? t_queue : m_queues.size() - 1;
+}
+
+void TaskScheduler::submit(WorkItem item) {
+    {
+        WorkQueue& queue = *m_queues[currentQueue()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.items.push_back(std::move(item));
+    }
+    m_queued.fetch_add(1, std::memory_order_release);
+
+    // Taking the lock orders the notify after a sleeper's predicate check
+    { std::lock_guard<std::mutex> lock(m_sleepMutex); }
+    m_wake.notify_one();
+}
+
+bool TaskScheduler::popLocal(std::size_t index, WorkItem& item) {
+    WorkQueue& queue = *m_queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.items.empty()) {
+        return false;
+    }
+    item = std::move(queue.items.back());
+    queue.items.pop_back();
+    return true;
+}
+
+/**
+ * @brief Takes the oldest task of another queue, starting after the thief's
+ *        own index so victims are spread across the pool.
+ */
+bool TaskScheduler::steal(std::size_t thief, WorkItem& item) {
+    const std::size_t count = m_queues.size();
+    for (std::size_t offset = 1; offset <= count; ++offset) {
+        WorkQueue& queue = *m_queues[(thief + offset) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.items.empty()) {
+            item = std::move(queue.items.front());
+            queue.items.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TaskScheduler::runOne() {
+    if (m_queued.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    const std::size_t own = currentQueue();
+    WorkItem item;
+    if (!popLocal(own, item) && !steal(own, item)) {
+        return false;
+    }
+    m_queued.fetch_sub(1, std::memory_order_relaxed);
+    execute(item);
+    return true;
+}
+
+void TaskScheduler::execute(WorkItem& item) {
+    const auto start = std::chrono::steady_clock::now();
+    item.fn();
+    record(item.label, elapsedMs(start));
+
+    // The group may be destroyed as soon as its count drops to zero, so it
+    // is not touched after the decrement
+    if (item.group && item.group->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        { std::lock_guard<std::mutex> lock(m_sleepMutex); }
+        m_wake.notify_all();
+    }
+}
+
+void TaskScheduler::workerLoop(std::size_t index) {
+    t_owner = this;
+    t_queue = index;
+
+    for (;;) {
+        if (runOne()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wake.wait(lock, [this] {
+            return m_stopping || m_queued.load(std::memory_order_acquire) > 0;
+        });
+        if (m_stopping) {
+            return;
+        }
+    }
+}
+
+// --- Parallel Algorithms ---
+void TaskScheduler::parallelFor(const char* label, std::size_t begin, std::size_t end, std::size_t grain,
+                                std::size_t maxTasks, const std::function<void(std::size_t, std::size_t)>& body) {
+    if (begin >= end) {
+        return;
+    }
+
+    const std::size_t count = end - begin;
+    // Rounded down, so every chunk holds at least grain elements
+    const std::size_t byGrain = count / std::max<std::size_t>(1, grain);
+    const std::size_t tasks = m_threads.empty() ? 1 : std::max<std::size_t>(1, std::min(maxTasks, byGrain));
+
+    if (tasks == 1) {
+        const auto start = std::chrono::steady_clock::now();
+        body(begin, end);
+        record(label, elapsedMs(start));
+        return;
+    }
+
+    // Even split: chunk sizes differ by at most one element
+    TaskGroup group(*this);
+    for (std::size_t t = 1; t < tasks; ++t) {
+        const std::size_t chunkBegin = begin + count * t / tasks;
+        const std::size_t chunkEnd = begin + count * (t + 1) / tasks;
+        group.run(label, [&body, chunkBegin, chunkEnd] { body(chunkBegin, chunkEnd); });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    body(begin, begin + count / tasks);
+    record(label, elapsedMs(start));
+
+    group.wait();
+}
+
+// --- Timing Surface ---
+void TaskScheduler::record(const char* label, double milliseconds) {
+    std::lock_guard<std::mutex> lock(m_timingMutex);
+    TaskTiming& timing = m_timings[label];
+    timing.label = label;
+    ++timing.tasks;
+    timing.totalMs += milliseconds;
+    timing.maxMs = std::max(timing.maxMs, milliseconds);
+    m_busyMs[currentQueue()] += milliseconds;
+}
+
+std::vector<TaskTiming> TaskScheduler::timings() const {
+    std::vector<TaskTiming> result;
+    {
+        std::lock_guard<std::mutex> lock(m_timingMutex);
+        result.reserve(m_timings.size());
+        for (const auto& entry : m_timings) {
+            result.push_back(entry.second);
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const TaskTiming& a, const TaskTiming& b) {
+        return a.totalMs > b.totalMs;
+    });
+    return result;
+}
+
+std::vector<double> TaskScheduler::workerBusyMs() const {
+    std::lock_guard<std::mutex> lock(m_timingMutex);
+    return m_busyMs;
+}
+
+void TaskScheduler::resetTimings() {
+    std::lock_guard<std::mutex> lock(m_timingMutex);
+    m_timings.clear();
+    std::fill(m_busyMs.begin(), m_busyMs.end(), 0.0);
+}
@@ -0,0 +1,201 @@
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class TaskScheduler;
+
+/**
+ * @struct TaskTiming
+ * @brief Accumulated wall time of all tasks submitted under one label.
+ */
+struct TaskTiming {
+    const char* label = "";
+    std::uint64_t tasks = 0;
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+};
+
+/**
+ * @class TaskGroup
+ * @brief Set of tasks that can be waited for together.
+ *
+ * The waiting thread executes queued tasks (its own group's or anyone
+ * else's) while there are any, so nested parallel sections cannot deadlock
+ * the pool. Once nothing is left to steal it sleeps until the group
+ * completes or new work is queued.
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(TaskScheduler& scheduler);
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /// Queues fn; label must be a string literal (used for timing).
+    void run(const char* label, std::function<void()> fn);
+    void wait();
+
+private:
+    friend class TaskScheduler;
+
+    TaskScheduler& m_scheduler;
+    std::atomic<std::size_t> m_pending{0};
+};
+
+/**
+ * @class TaskScheduler
+ * @brief Small work-stealing thread pool shared by simulation, filtering,
+ *        sorting and ingestion.
+ *
+ * Every worker owns a deque: it pushes and pops its own work at the back
+ * (LIFO, cache-warm) and steals from the front of other deques (FIFO,
+ * oldest and usually largest work first). Threads outside the pool submit
+ * through a shared injection queue and help execute while they wait.
+ * One process-wide instance (shared()) sized to the hardware keeps
+ * concurrent subsystems from oversubscribing the cores.
+ *
+ * Each task is timed under its label; timings() and workerBusyMs() show
+ * where the cores go.
+ */
+class TaskScheduler {
+public:
+    /// workers = 0 uses one worker per hardware thread, minus the caller.
+    explicit TaskScheduler(unsigned workers = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    static TaskScheduler& shared();
+
+    unsigned workerCount() const { return static_cast<unsigned>(m_threads.size()); }
+
+    /// Threads that can execute tasks at once: the workers plus the caller.
+    unsigned concurrency() const { return workerCount() + 1; }
+
+    // --- Parallel Algorithms ---
+    /**
+     * @brief Splits [begin, end) into at most maxTasks chunks of at least
+     *        grain elements and runs body(chunkBegin, chunkEnd) on each.
+     *
+     * The caller executes the first chunk itself and returns once all
+     * chunks are done. A single chunk runs inline without touching the pool.
+     */
+    void parallelFor(const char* label, std::size_t begin, std::size_t end, std::size_t grain,
+                     std::size_t maxTasks, const std::function<void(std::size_t, std::size_t)>& body);
+
+    /**
+     * @brief Sorts [first, last): runs are sorted in parallel, then merged
+     *        pairwise in parallel rounds.
+     *
+     * Stable like std::stable_sort: runs are stable-sorted and merges keep
+     * the left run first on ties, so equal elements end up in input order
+     * whatever the run count, i.e. the same on every machine.
+     */
+    template <typename Iterator, typename Compare>
+    void parallelSort(const char* label, Iterator first, Iterator last, Compare comp,
+                      std::size_t grain = 16384);
+
+    // --- Timing Surface ---
+    /// Per-label totals since the last reset, largest total first.
+    std::vector<TaskTiming> timings() const;
+
+    /// Busy time per worker since the last reset; the last entry covers
+    /// threads outside the pool that executed tasks.
+    std::vector<double> workerBusyMs() const;
+
+    void resetTimings();
+
+private:
+    friend class TaskGroup;
+
+    struct WorkItem {
+        std::function<void()> fn;
+        const char* label = "";
+        TaskGroup* group = nullptr;
+    };
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<WorkItem> items;
+    };
+
+    void submit(WorkItem item);
+    bool runOne();
+    bool popLocal(std::size_t queue, WorkItem& item);
+    bool steal(std::size_t thief, WorkItem& item);
+    void execute(WorkItem& item);
+    void record(const char* label, double milliseconds);
+    void workerLoop(std::size_t index);
+    std::size_t currentQueue() const;
+
+    // --- Queues ---
+    // One per worker plus the injection queue (last) for outside threads.
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    std::vector<std::thread> m_threads;
+    std::atomic<std::size_t> m_queued{0};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+    bool m_stopping = false;
+
+    // --- Timing ---
+    mutable std::mutex m_timingMutex;
+    std::unordered_map<const char*, TaskTiming> m_timings;
+    std::vector<double> m_busyMs;
+};
+
+// --- Template Implementation ---
+template <typename Iterator, typename Compare>
+void TaskScheduler::parallelSort(const char* label, Iterator first, Iterator last, Compare comp,
+                                 std::size_t grain) {
+    const std::size_t count = static_cast<std::size_t>(last - first);
+    const std::size_t runs = std::min<std::size_t>(concurrency(), count / std::max<std::size_t>(1, grain));
+
+    if (runs < 2) {
+        parallelFor(label, 0, 1, 1, 1, [&](std::size_t, std::size_t) {
+            std::stable_sort(first, last, comp);
+        });
+        return;
+    }
+
+    std::vector<std::size_t> bounds(runs + 1);
+    for (std::size_t r = 0; r <= runs; ++r) {
+        bounds[r] = count * r / runs;
+    }
+
+    parallelFor(label, 0, runs, 1, runs, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t r = begin; r < end; ++r) {
+            std::stable_sort(first + bounds[r], first + bounds[r + 1], comp);
+        }
+    });
+
+    // Round k merges neighbouring runs 2^k apart
+    for (std::size_t width = 1; width < runs; width *= 2) {
+        const std::size_t merges = (runs + 2 * width - 1) / (2 * width);
+        parallelFor(label, 0, merges, 1, merges, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t m = begin; m < end; ++m) {
+                const std::size_t low = m * 2 * width;
+                const std::size_t middle = std::min(runs, low + width);
+                const std::size_t high = std::min(runs, low + 2 * width);
+                if (middle < high) {
+                    std::inplace_merge(first + bounds[low], first + bounds[middle], first + bounds[high], comp);
+                }
+            }
+        });
+    }
+}
+
+#endif // TASKSCHEDULER_H
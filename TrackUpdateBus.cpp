@@ -0,0 +1,154 @@
+#include "TrackUpdateBus.h"
+#include "TacticalVehicleData.h"
+
+#include <QHash>
+
+#include <utility>
+
+// --- TrackUpdateBus Implementation ---
+
+TrackUpdateBus::TrackUpdateBus(const TacticalVehicleData& data, const TacticalVehicleController& controller,
+                               QObject *parent)
+    : QObject(parent), m_data(data), m_controller(controller) {
+}
+
+// --- Subscriptions ---
+void TrackUpdateBus::subscribe(QObject *receiver, const TacticalVehicle& vehicle, Handler handler) {
+    Subscription subscription;
+    subscription.receiver = receiver;
+    subscription.vehicle = &vehicle;
+    subscription.trackId = vehicle.trackId;
+    subscription.handler = std::move(handler);
+    m_subscriptions.push_back(std::move(subscription));
+
+    if (!m_watched.contains(receiver)) {
+        m_watched.insert(receiver);
+        connect(receiver, &QObject::destroyed, this, [this, receiver]() {
+            m_watched.remove(receiver);
+            unsubscribe(receiver);
+        });
+    }
+
+    deliver(m_subscriptions.back(), VehicleChangeSet::AllFields, m_controller.simulationClock());
+}
+
+void TrackUpdateBus::unsubscribe(QObject *receiver) {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_subscriptions.size(); ++i) {
+        if (m_subscriptions[i].receiver != receiver) {
+            if (kept != i) {
+                m_subscriptions[kept] = std::move(m_subscriptions[i]);
+            }
+            ++kept;
+        }
+    }
+    m_subscriptions.resize(kept);
+}
+
+// --- Publishing ---
+void TrackUpdateBus::publish(const VehicleChangeSet& changes, double timestamp) {
+    if (changes.reloaded()) {
+        rebindVehicles();
+    }
+    // Indexed loop: handlers may subscribe further receivers
+    for (std::size_t i = 0; i < m_subscriptions.size(); ++i) {
+        Subscription& subscription = m_subscriptions[i];
+        const VehicleChangeSet::Fields changed = changes.reloaded()
+            ? VehicleChangeSet::Fields(VehicleChangeSet::AllFields)
+            : changes.fieldsOf(subscription.vehicle->simIndex);
+        deliver(subscription, changed, timestamp);
+    }
+}
+
+void TrackUpdateBus::publishFrame(double timestamp) {
+    for (std::size_t i = 0; i < m_subscriptions.size(); ++i) {
+        deliver(m_subscriptions[i], 0, timestamp);
+    }
+}
+
+/**
+ * @brief Adds the kinematic fields whose dead-reckoned value moved since the
+ *        previous delivery and calls the handler if anything changed.
+ */
+void TrackUpdateBus::deliver(Subscription& subscription, VehicleChangeSet::Fields changed, double timestamp) {
+    const TacticalVehicle& vehicle = *subscription.vehicle;
+
+    TrackUpdate update;
+    update.vehicle = &vehicle;
+    update.state = m_controller.extrapolate(vehicle, timestamp);
+    if (!update.state.valid) {
+        // Not simulated yet: the published record is current
+        update.state.posX = vehicle.posX;
+        update.state.posY = vehicle.posY;
+        update.state.latitude = vehicle.latitude;
+        update.state.longitude = vehicle.longitude;
+        update.state.distanceToTarget = vehicle.distanceToTarget;
+        update.state.speed = vehicle.speed;
+        update.state.heading = vehicle.heading;
+    }
+
+    const ExtrapolatedState& previous = subscription.delivered;
+    if (update.state.posX != previous.posX || update.state.posY != previous.posY) {
+        changed |= VehicleChangeSet::Position;
+    }
+    if (update.state.distanceToTarget != previous.distanceToTarget) {
+        changed |= VehicleChangeSet::Distance;
+    }
+    if (update.state.speed != previous.speed) {
+        changed |= VehicleChangeSet::Speed;
+    }
+    if (update.state.heading != previous.heading) {
+        changed |= VehicleChangeSet::Heading;
+    }
+    if (changed == 0) {
+        return;
+    }
+
+    update.changed = changed;
+    subscription.delivered = update.state;
+    subscription.handler(update);
+}
+
+/**
+ * @brief Finds the subscribed tracks in a reloaded dataset (one pass).
+ *
+ * Subscriptions whose track is gone are dropped after a final delivery
+ * without a vehicle, so their receivers can stop expecting updates.
+ */
+void TrackUpdateBus::rebindVehicles() {
+    if (m_subscriptions.empty()) {
+        return;
+    }
+    QHash<QString, const TacticalVehicle*> byTrackId;
+    for (const Subscription& subscription : m_subscriptions) {
+        byTrackId.insert(subscription.trackId, nullptr);
+    }
+    for (const auto& vehicle : m_data.vehicles()) {
+        auto it = byTrackId.find(vehicle.trackId);
+        if (it != byTrackId.end()) {
+            it.value() = &vehicle;
+        }
+    }
+
+    std::vector<Handler> gone;
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_subscriptions.size(); ++i) {
+        const TacticalVehicle *vehicle = byTrackId.value(m_subscriptions[i].trackId);
+        if (!vehicle) {
+            gone.push_back(std::move(m_subscriptions[i].handler));
+            continue;
+        }
+        m_subscriptions[i].vehicle = vehicle;
+        if (kept != i) {
+            m_subscriptions[kept] = std::move(m_subscriptions[i]);
+        }
+        ++kept;
+    }
+    m_subscriptions.resize(kept);
+
+    // Called once the list is consistent: handlers may unsubscribe
+    const TrackUpdate removed;
+    for (const Handler& handler : gone) {
+        handler(removed);
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef TRACKUPDATEBUS_H
+#define TRACKUPDATEBUS_H
+
+#include "TacticalVehicleController.h"
+#include "VehicleChangeSet.h"
+
+#include <QObject>
+#include <QSet>
+#include <QString>
+
+#include <functional>
+#include <vector>
+
+class TacticalVehicleData;
+
+/**
+ * @struct TrackUpdate
+ * @brief One delivery of the track update bus to a subscriber.
+ *
+ * A delivery with a null vehicle (and no changed fields) is the last one of
+ * a subscription: its track is not in the reloaded dataset.
+ */
+struct TrackUpdate {
+    const TacticalVehicle *vehicle = nullptr; ///< Published record of the track; null once it is gone
+    ExtrapolatedState state;                  ///< Kinematics dead-reckoned to the delivery time
+    VehicleChangeSet::Fields changed = 0;     ///< Fields that differ from the previous delivery
+};
+
+/**
+ * @class TrackUpdateBus
+ * @brief Pushes per-track updates to subscribers (e.g. entity dialogs).
+ *
+ * A subscription holds the track's record, whose simIndex keys the change
+ * set, so each delivery resolves in O(1) and a publish costs as much as the
+ * number of subscriptions, not the fleet size. Subscriptions end
+ * automatically when their receiver is destroyed, or after a final delivery
+ * without a vehicle when a reload drops their track.
+ *
+ * Subscribers only hear about a track when one of its fields changed:
+ * publish() forwards the simulation's change set once per tick, and
+ * publishFrame() forwards dead-reckoned motion between ticks.
+ */
+class TrackUpdateBus : public QObject {
+    Q_OBJECT
+
+public:
+    using Handler = std::function<void(const TrackUpdate&)>;
+
+    TrackUpdateBus(const TacticalVehicleData& data, const TacticalVehicleController& controller,
+                   QObject *parent = nullptr);
+
+    // --- Subscriptions ---
+    /**
+     * @brief Subscribes receiver to one track; handler is called right away
+     *        with every field marked changed.
+     */
+    void subscribe(QObject *receiver, const TacticalVehicle& vehicle, Handler handler);
+    void unsubscribe(QObject *receiver);
+    std::size_t subscriptionCount() const { return m_subscriptions.size(); }
+
+    // --- Publishing ---
+    /**
+     * @brief Delivers the fields changed by the last simulation tick.
+     * @param timestamp Simulated time the extrapolated state refers to.
+     */
+    void publish(const VehicleChangeSet& changes, double timestamp);
+
+    /// Delivers dead-reckoned position and distance between ticks.
+    void publishFrame(double timestamp);
+
+private:
+    struct Subscription {
+        QObject *receiver = nullptr;
+        const TacticalVehicle *vehicle = nullptr; ///< Stable while the dataset is loaded
+        QString trackId;                          ///< Re-resolves the vehicle after a reload
+        Handler handler;
+        ExtrapolatedState delivered;              ///< State of the previous delivery
+    };
+
+    void deliver(Subscription& subscription, VehicleChangeSet::Fields changed, double timestamp);
+    void rebindVehicles();
+
+    const TacticalVehicleData& m_data;
+    const TacticalVehicleController& m_controller;
+    std::vector<Subscription> m_subscriptions;
+    QSet<QObject*> m_watched;   ///< Receivers whose destruction is observed
+};
+
+#endif // TRACKUPDATEBUS_H
@@ -0,0 +1,59 @@
+#include "ValueHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+// --- ValueHistogram Implementation ---
+// Per-slot bucket bookkeeping; Qt-free so it can live next to the
+// simulation buffers.
+
+namespace {
+constexpr std::uint16_t NO_BUCKET = 0xFFFF;
+}
+
+ValueHistogram::ValueHistogram(double minimum, double maximum, std::size_t buckets)
+    : m_minimum(minimum), m_maximum(maximum),
+      m_counts(std::min<std::size_t>(std::max<std::size_t>(buckets, 1), NO_BUCKET), 0) {
+    m_bucketsPerUnit = maximum > minimum ? double(m_counts.size()) / (maximum - minimum) : 0.0;
+}
+
+std::uint16_t ValueHistogram::bucketOf(double value) const {
+    if (!std::isfinite(value)) {
+        return NO_BUCKET;
+    }
+    const double bucket = std::floor((value - m_minimum) * m_bucketsPerUnit);
+    const double last = double(m_counts.size() - 1);
+    return static_cast<std::uint16_t>(std::clamp(bucket, 0.0, last));
+}
+
+void ValueHistogram::assign(const double* values, std::size_t count) {
+    std::fill(m_counts.begin(), m_counts.end(), 0);
+    m_slotBucket.resize(count);
+    for (std::size_t slot = 0; slot < count; ++slot) {
+        const std::uint16_t bucket = bucketOf(values[slot]);
+        m_slotBucket[slot] = bucket;
+        if (bucket != NO_BUCKET) {
+            ++m_counts[bucket];
+        }
+    }
+    ++m_revision;
+}
+
+void ValueHistogram::set(std::size_t slot, double value) {
+    if (slot >= m_slotBucket.size()) {
+        return;
+    }
+    const std::uint16_t bucket = bucketOf(value);
+    const std::uint16_t previous = m_slotBucket[slot];
+    if (bucket == previous) {
+        return;
+    }
+    if (previous != NO_BUCKET) {
+        --m_counts[previous];
+    }
+    if (bucket != NO_BUCKET) {
+        ++m_counts[bucket];
+    }
+    m_slotBucket[slot] = bucket;
+    ++m_revision;
+}
@@ -0,0 +1,47 @@
+#ifndef VALUEHISTOGRAM_H
+#define VALUEHISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class ValueHistogram
+ * @brief Bucket counts of one per-slot value, maintained incrementally.
+ *
+ * Remembers the bucket of every slot, so set() moves a single count when a
+ * value crosses a bucket boundary and does nothing otherwise. Readers get
+ * the distribution in O(buckets) without scanning the fleet.
+ *
+ * Values outside [minimum, maximum] are counted in the first or last
+ * bucket; non-finite values are not counted.
+ */
+class ValueHistogram {
+public:
+    ValueHistogram(double minimum, double maximum, std::size_t buckets);
+
+    /// Rebuilds all counts from count slot values (e.g. after ingest).
+    void assign(const double* values, std::size_t count);
+
+    /// Updates one slot; O(1).
+    void set(std::size_t slot, double value);
+
+    const std::vector<std::uint32_t>& counts() const { return m_counts; }
+    double minimum() const { return m_minimum; }
+    double maximum() const { return m_maximum; }
+
+    /// Incremented whenever a count changed.
+    std::uint64_t revision() const { return m_revision; }
+
+private:
+    std::uint16_t bucketOf(double value) const;
+
+    double m_minimum;
+    double m_maximum;
+    double m_bucketsPerUnit;
+    std::vector<std::uint32_t> m_counts;
+    std::vector<std::uint16_t> m_slotBucket;  ///< Bucket per slot (NO_BUCKET when not counted)
+    std::uint64_t m_revision = 0;
+};
+
+#endif // VALUEHISTOGRAM_H
@@ -0,0 +1,67 @@
+#include "VehicleChangeSet.h"
+
+// --- VehicleChangeSet Implementation ---
+// Qt-free so the controller can record changes without touching the UI layer.
+
+// --- Recording ---
+void VehicleChangeSet::mark(std::size_t slot, Fields fields) {
+    if (fields == 0) {
+        return;
+    }
+    if (slot >= m_mask.size()) {
+        m_mask.resize(slot + 1, 0);
+    }
+    if (m_mask[slot] == 0) {
+        m_slots.push_back(static_cast<std::uint32_t>(slot));
+    }
+    m_mask[slot] |= fields;
+    m_fields |= fields;
+}
+
+void VehicleChangeSet::markReloaded() {
+    clear();
+    m_reloaded = true;
+}
+
+void VehicleChangeSet::remapSlots(const std::vector<std::uint32_t>& newSlotOf) {
+    std::vector<std::uint32_t> moved;
+    std::vector<Fields> fields;
+    moved.reserve(m_slots.size());
+    fields.reserve(m_slots.size());
+    for (const std::uint32_t slot : m_slots) {
+        if (slot < newSlotOf.size() && newSlotOf[slot] != RemovedSlot) {
+            moved.push_back(newSlotOf[slot]);
+            fields.push_back(m_mask[slot]);
+        }
+    }
+
+    const bool reloaded = m_reloaded;
+    clear();
+    for (std::size_t i = 0; i < moved.size(); ++i) {
+        mark(moved[i], fields[i]);
+    }
+    m_reloaded = reloaded;
+    m_relayout = true;
+}
+
+void VehicleChangeSet::merge(const VehicleChangeSet& later) {
+    // Slots recorded here cannot follow a later relayout without its
+    // mapping, so the merged set reports a reload instead
+    if (later.m_reloaded || (later.m_relayout && !m_slots.empty())) {
+        markReloaded();
+    }
+    m_relayout = m_relayout || later.m_relayout;
+    for (const std::uint32_t slot : later.m_slots) {
+        mark(slot, later.m_mask[slot]);
+    }
+}
+
+void VehicleChangeSet::clear() {
+    for (const std::uint32_t slot : m_slots) {
+        m_mask[slot] = 0;
+    }
+    m_slots.clear();
+    m_fields = 0;
+    m_reloaded = false;
+    m_relayout = false;
+}
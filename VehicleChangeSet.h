@@ -0,0 +1,84 @@
+#ifndef VEHICLECHANGESET_H
+#define VEHICLECHANGESET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class VehicleChangeSet
+ * @brief Records which vehicles (by simIndex) and which of their fields
+ *        changed since the set was last drained.
+ *
+ * Each slot carries a field bitmask; slots are also listed in the order they
+ * were first marked, so consumers visit only the changed vehicles and
+ * clearing costs as much as the number of changes, not the fleet size.
+ */
+class VehicleChangeSet {
+public:
+    /// Field bits; one bit per group of telemetry that views display together.
+    enum Field : std::uint16_t {
+        Position      = 1 << 0,  ///< posX / posY
+        Speed         = 1 << 1,
+        Heading       = 1 << 2,
+        Distance      = 1 << 3,  ///< distanceToTarget
+        Fuel          = 1 << 4,
+        Ammunition    = 1 << 5,
+        NearestTarget = 1 << 6,  ///< nearestTargetDistance / nearestTargetIndex
+        Intercept     = 1 << 7,  ///< timeToCpa / cpaDistance / cpaPartner
+        Eta           = 1 << 8,  ///< etaToTarget
+        Proximity     = 1 << 9,  ///< proximityMask / proximityContacts
+        Route         = 1 << 10, ///< routeCursor
+        Geodetic      = 1 << 11, ///< latitude / longitude
+        AllFields     = (1 << 12) - 1
+    };
+    using Fields = std::uint16_t;
+
+    /// remapSlots() target of a vehicle that was removed.
+    static constexpr std::uint32_t RemovedSlot = 0xFFFFFFFFu;
+
+    // --- Recording ---
+    void mark(std::size_t slot, Fields fields);
+
+    /**
+     * @brief Records that the dataset was replaced; slots recorded before
+     *        refer to the old layout and are dropped.
+     */
+    void markReloaded();
+
+    /**
+     * @brief Records that vehicles moved to new slots but kept their state
+     *        (vehicles were appended or removed); recorded slots follow
+     *        their vehicles.
+     * @param newSlotOf New slot of every old slot, or RemovedSlot.
+     */
+    void remapSlots(const std::vector<std::uint32_t>& newSlotOf);
+
+    /// Folds a later change set into this one.
+    void merge(const VehicleChangeSet& later);
+
+    void clear();
+
+    // --- Queries ---
+    bool isEmpty() const { return m_slots.empty() && !m_reloaded && !m_relayout; }
+    bool reloaded() const { return m_reloaded; }
+    /// Slots were reassigned since the set was drained; slot-keyed caches are stale.
+    bool relayout() const { return m_relayout; }
+
+    /// Union of the fields changed on any slot.
+    Fields fields() const { return m_fields; }
+
+    Fields fieldsOf(std::size_t slot) const { return slot < m_mask.size() ? m_mask[slot] : 0; }
+
+    /// Changed slots, in the order they were first marked.
+    const std::vector<std::uint32_t>& changedSlots() const { return m_slots; }
+
+private:
+    std::vector<Fields> m_mask;          ///< Per-slot changed fields (0 = unchanged)
+    std::vector<std::uint32_t> m_slots;  ///< Slots with a non-zero mask
+    Fields m_fields = 0;
+    bool m_reloaded = false;
+    bool m_relayout = false;
+};
+
+#endif // VEHICLECHANGESET_H
@@ -0,0 +1,365 @@
+#include "VehicleTableModel.h"
+#include "FixedFormat.h"
+
+#include <QColor>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+// --- VehicleTableModel Implementation ---
+
+namespace {
+QString fixedText(double value, int decimals) {
+    char buffer[24];
+    const int length = formatFixed(value, decimals, buffer);
+    return length > 0 ? QString::fromLatin1(buffer, length) : QString::number(value, 'f', decimals);
+}
+}
+
+VehicleTableModel::VehicleTableModel(QObject *parent) : QAbstractTableModel(parent) {
+}
+
+// --- QAbstractTableModel Interface ---
+int VehicleTableModel::rowCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(m_rows.size());
+}
+
+int VehicleTableModel::columnCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant VehicleTableModel::data(const QModelIndex &index, int role) const {
+    const TacticalVehicle *vehicle = vehicleAt(index.row());
+    if (!vehicle) {
+        return QVariant();
+    }
+
+    switch (role) {
+    case Qt::DisplayRole:
+        switch (index.column()) {
+        case CallsignColumn:   return vehicle->callsign;
+        case TypeColumn:       return vehicle->type;
+        case TrackIdColumn:    return vehicle->trackId;
+        case DistanceColumn:   return cellText(*vehicle).distance;
+        case FuelColumn:       return cellText(*vehicle).fuel;
+        case ProtectionColumn: return cellText(*vehicle).protection;
+        default:               return QVariant();
+        }
+
+    case Qt::ForegroundRole:
+        return cellText(*vehicle).foreground;
+
+    case Qt::TextAlignmentRole:
+        if (index.column() >= DistanceColumn) {
+            return int(Qt::AlignRight | Qt::AlignVCenter);
+        }
+        return int(Qt::AlignLeft | Qt::AlignVCenter);
+
+    default:
+        return QVariant();
+    }
+}
+
+/**
+ * @brief Display fragments of one vehicle, formatted only when stale.
+ *
+ * Static fields (protection level, affiliation colour) are formatted once
+ * per vehicle; distance and fuel are re-formatted only when their value
+ * changed since the text was cached. Repaints and scrolling therefore
+ * mostly return shared copies of cached strings.
+ */
+const VehicleTableModel::CellText& VehicleTableModel::cellText(const TacticalVehicle& vehicle) const {
+    if (vehicle.simIndex >= m_cellText.size()) {
+        m_cellText.resize(vehicle.simIndex + 1);
+    }
+    CellText& text = m_cellText[vehicle.simIndex];
+
+    if (text.vehicle != &vehicle) {
+        text = CellText();
+        text.vehicle = &vehicle;
+        text.protection = QString::number(vehicle.protectionLevel);
+        if (vehicle.affiliation.contains("Friendly", Qt::CaseInsensitive)) {
+            text.foreground = QColor(0, 162, 232);
+        } else if (vehicle.affiliation.contains("Hostile", Qt::CaseInsensitive)) {
+            text.foreground = QColor(Qt::red);
+        } else {
+            text.foreground = QColor(Qt::white);
+        }
+    }
+
+    // NaN never compares equal, so a fresh entry is always formatted
+    if (!(text.distanceValue == vehicle.distanceToTarget)) {
+        text.distanceValue = vehicle.distanceToTarget;
+        text.distance = fixedText(vehicle.distanceToTarget, 0);
+    }
+    if (!(text.fuelValue == vehicle.fuelLevel)) {
+        text.fuelValue = vehicle.fuelLevel;
+        text.fuel = fixedText(vehicle.fuelLevel, 1);
+    }
+    return text;
+}
+
+QVariant VehicleTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    switch (section) {
+    case CallsignColumn:   return QString("Callsign");
+    case TypeColumn:       return QString("Type");
+    case TrackIdColumn:    return QString("Track ID");
+    case DistanceColumn:   return QString("Distance to target (m)");
+    case FuelColumn:       return QString("Est. fuel level (%)");
+    case ProtectionColumn: return QString("Protection level");
+    default:               return QVariant();
+    }
+}
+
+// --- Row Management ---
+void VehicleTableModel::setRows(std::vector<const TacticalVehicle*> rows, std::uint64_t filterRevision) {
+    beginResetModel();
+    m_rows = std::move(rows);
+    // A reset may follow a dataset reload, which reassigns the slots
+    m_cellText.clear();
+    if (m_order) {
+        ScopedLatency latency(LatencySort);
+        TaskScheduler::shared().parallelSort("sort.view", m_rows.begin(), m_rows.end(), m_order);
+    }
+    m_filterRevision = filterRevision;
+    m_rowIndexValid = false;
+    endResetModel();
+}
+
+/**
+ * @brief Diffs the displayed rows against a new view.
+ *
+ * Removals are emitted per run of adjacent rows, from the bottom up so the
+ * row numbers of pending runs stay valid. Insertions are grouped by target
+ * row; past MAX_SCATTERED_INSERTS a reset is cheaper for the view as well.
+ */
+void VehicleTableModel::updateRows(const std::vector<const TacticalVehicle*>& rows, std::uint64_t filterRevision) {
+    constexpr std::size_t MAX_SCATTERED_INSERTS = 1024;
+    m_filterRevision = filterRevision;
+
+    // --- Removals ---
+    const std::unordered_set<const TacticalVehicle*> wanted(rows.begin(), rows.end());
+    int row = static_cast<int>(m_rows.size()) - 1;
+    while (row >= 0) {
+        if (wanted.count(m_rows[row])) {
+            --row;
+            continue;
+        }
+        const int last = row;
+        while (row >= 0 && !wanted.count(m_rows[row])) {
+            --row;
+        }
+        beginRemoveRows(QModelIndex(), row + 1, last);
+        m_rows.erase(m_rows.begin() + (row + 1), m_rows.begin() + (last + 1));
+        endRemoveRows();
+        m_rowIndexValid = false;
+    }
+
+    // --- Insertions ---
+    const std::unordered_set<const TacticalVehicle*> shown(m_rows.begin(), m_rows.end());
+    std::vector<const TacticalVehicle*> added;
+    for (const TacticalVehicle *vehicle : rows) {
+        if (!shown.count(vehicle)) {
+            added.push_back(vehicle);
+        }
+    }
+    if (added.empty()) {
+        return;
+    }
+    if (added.size() > MAX_SCATTERED_INSERTS) {
+        std::vector<const TacticalVehicle*> merged = m_rows;
+        merged.insert(merged.end(), added.begin(), added.end());
+        setRows(std::move(merged), filterRevision);
+        return;
+    }
+
+    std::vector<std::pair<int, const TacticalVehicle*>> placed;
+    placed.reserve(added.size());
+    if (m_order) {
+        // Binary search needs sorted rows; live keys may have drifted since
+        resort();
+        std::stable_sort(added.begin(), added.end(), m_order);
+        for (const TacticalVehicle *vehicle : added) {
+            const auto position = std::upper_bound(m_rows.begin(), m_rows.end(), vehicle, m_order);
+            placed.emplace_back(static_cast<int>(position - m_rows.begin()), vehicle);
+        }
+    } else {
+        for (const TacticalVehicle *vehicle : added) {
+            placed.emplace_back(static_cast<int>(m_rows.size()), vehicle);
+        }
+    }
+
+    // Groups sharing a target row are inserted together, bottom group first
+    std::size_t end = placed.size();
+    while (end > 0) {
+        const int position = placed[end - 1].first;
+        std::size_t begin = end - 1;
+        while (begin > 0 && placed[begin - 1].first == position) {
+            --begin;
+        }
+        beginInsertRows(QModelIndex(), position, position + static_cast<int>(end - begin) - 1);
+        std::vector<const TacticalVehicle*> group;
+        group.reserve(end - begin);
+        for (std::size_t i = begin; i < end; ++i) {
+            group.push_back(placed[i].second);
+        }
+        m_rows.insert(m_rows.begin() + position, group.begin(), group.end());
+        endInsertRows();
+        end = begin;
+    }
+    m_rowIndexValid = false;
+}
+
+const TacticalVehicle* VehicleTableModel::vehicleAt(int row) const {
+    if (row < 0 || static_cast<std::size_t>(row) >= m_rows.size()) {
+        return nullptr;
+    }
+    return m_rows[row];
+}
+
+// Formatted text is checked against its owner and values, so only the row index is dropped
+void VehicleTableModel::invalidateSlotIndex() {
+    m_rowIndexValid = false;
+}
+
+// --- Change Propagation ---
+VehicleChangeSet::Fields VehicleTableModel::columnFields(int column) {
+    switch (column) {
+    case DistanceColumn: return VehicleChangeSet::Distance;
+    case FuelColumn:     return VehicleChangeSet::Fuel;
+    default:             return 0;  // Identity and specification columns are static
+    }
+}
+
+void VehicleTableModel::applyChanges(const VehicleChangeSet& changes) {
+    if (m_rows.empty() || changes.isEmpty()) {
+        return;
+    }
+    // A reorder repaints the visible rows anyway
+    if ((changes.fields() & m_orderFields) && resort()) {
+        return;
+    }
+
+    VehicleChangeSet::Fields displayed = 0;
+    for (int column = 0; column < ColumnCount; ++column) {
+        displayed |= columnFields(column);
+    }
+    if (!(changes.fields() & displayed)) {
+        return;
+    }
+
+    ensureRowIndex();
+    std::vector<std::pair<int, VehicleChangeSet::Fields>> dirty;
+    for (const std::uint32_t slot : changes.changedSlots()) {
+        const VehicleChangeSet::Fields fields = changes.fieldsOf(slot) & displayed;
+        if (fields && slot < m_rowOfSlot.size() && m_rowOfSlot[slot] >= 0) {
+            dirty.emplace_back(m_rowOfSlot[slot], fields);
+        }
+    }
+    std::sort(dirty.begin(), dirty.end());
+
+    // One signal per run of adjacent rows, over the union of their columns
+    std::size_t i = 0;
+    while (i < dirty.size()) {
+        const int first = dirty[i].first;
+        int last = first;
+        VehicleChangeSet::Fields fields = dirty[i].second;
+        while (++i < dirty.size() && dirty[i].first == last + 1) {
+            last = dirty[i].first;
+            fields |= dirty[i].second;
+        }
+
+        int firstColumn = ColumnCount;
+        int lastColumn = -1;
+        for (int column = 0; column < ColumnCount; ++column) {
+            if (columnFields(column) & fields) {
+                firstColumn = std::min(firstColumn, column);
+                lastColumn = column;
+            }
+        }
+        emit dataChanged(index(first, firstColumn), index(last, lastColumn), {Qt::DisplayRole});
+    }
+}
+
+void VehicleTableModel::ensureRowIndex() {
+    if (m_rowIndexValid) {
+        return;
+    }
+    std::size_t slotCount = 0;
+    for (const TacticalVehicle *vehicle : m_rows) {
+        slotCount = std::max(slotCount, vehicle->simIndex + 1);
+    }
+    m_rowOfSlot.assign(slotCount, -1);
+    for (std::size_t row = 0; row < m_rows.size(); ++row) {
+        m_rowOfSlot[m_rows[row]->simIndex] = static_cast<int>(row);
+    }
+    m_rowIndexValid = true;
+}
+
+// --- Reordering ---
+/**
+ * @brief Re-applies the active sort; returns false (and emits nothing) when
+ *        the rows are still in order.
+ */
+bool VehicleTableModel::resort() {
+    if (!m_order || std::is_sorted(m_rows.begin(), m_rows.end(), m_order)) {
+        return false;
+    }
+    ScopedLatency latency(LatencySort);
+    beginReorder();
+    TaskScheduler::shared().parallelSort("sort.view", m_rows.begin(), m_rows.end(), m_order);
+    endReorder();
+    return true;
+}
+
+void VehicleTableModel::beginReorder() {
+    emit layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+
+    m_persistent = persistentIndexList();
+    m_persistentVehicles.clear();
+    m_persistentVehicles.reserve(m_persistent.size());
+    for (const QModelIndex &index : std::as_const(m_persistent)) {
+        m_persistentVehicles.push_back(vehicleAt(index.row()));
+    }
+}
+
+/**
+ * @brief Moves persistent indexes to the new rows of their vehicles.
+ *
+ * Only done when a view holds persistent indexes (usually a handful), so
+ * the extra pass over the rows is skipped in the common case.
+ */
+void VehicleTableModel::endReorder() {
+    if (!m_persistent.isEmpty()) {
+        std::unordered_map<const TacticalVehicle*, int> rowOf;
+        rowOf.reserve(m_persistentVehicles.size());
+        for (const TacticalVehicle *vehicle : m_persistentVehicles) {
+            rowOf.emplace(vehicle, -1);
+        }
+        for (std::size_t row = 0; row < m_rows.size(); ++row) {
+            auto it = rowOf.find(m_rows[row]);
+            if (it != rowOf.end()) {
+                it->second = static_cast<int>(row);
+            }
+        }
+
+        QModelIndexList moved;
+        moved.reserve(m_persistent.size());
+        for (int i = 0; i < m_persistent.size(); ++i) {
+            const int row = rowOf[m_persistentVehicles[i]];
+            moved.append(row < 0 ? QModelIndex() : index(row, m_persistent[i].column()));
+        }
+        changePersistentIndexList(m_persistent, moved);
+    }
+
+    m_persistent.clear();
+    m_persistentVehicles.clear();
+    m_rowIndexValid = false;
+    emit layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
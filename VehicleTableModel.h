@@ -0,0 +1,153 @@
+#ifndef VEHICLETABLEMODEL_H
+#define VEHICLETABLEMODEL_H
+
+#include "PerformanceMonitor.h"
+#include "TacticalVehicle.h"
+#include "TaskScheduler.h"
+#include "VehicleChangeSet.h"
+
+#include <QAbstractTableModel>
+#include <QColor>
+#include <QModelIndexList>
+#include <QString>
+
+#include <cstdint>
+#include <limits>
+#include <functional>
+#include <vector>
+
+/**
+ * @class VehicleTableModel
+ * @brief Table model over a view of vehicle pointers (results panel).
+ *
+ * The model stores only the row order; cell text is formatted in data()
+ * when the view asks for it, and a QTableView only asks for the rows in its
+ * viewport. Refreshing or re-sorting the results therefore costs work
+ * proportional to the visible rows, not to the fleet size. Formatted text
+ * is cached per vehicle and only rebuilt when the displayed value changed.
+ *
+ * Live updates are diff-based: applyChanges() emits dataChanged only for
+ * the cells whose fields changed, and updateRows() turns a new filter result
+ * into row removals and insertions instead of a model reset.
+ *
+ * Rows point into TacticalVehicleData's deque, whose elements never move
+ * while the dataset is loaded; reloading the dataset requires setRows().
+ */
+class VehicleTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    enum Column {
+        CallsignColumn,
+        TypeColumn,
+        TrackIdColumn,
+        DistanceColumn,
+        FuelColumn,
+        ProtectionColumn,
+        ColumnCount
+    };
+
+    explicit VehicleTableModel(QObject *parent = nullptr);
+
+    // --- QAbstractTableModel Interface ---
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    // --- Row Management ---
+    /**
+     * @brief Replaces the displayed rows (model reset), keeping the current
+     *        sort order.
+     * @param filterRevision Controller filter revision the rows were taken from.
+     */
+    void setRows(std::vector<const TacticalVehicle*> rows, std::uint64_t filterRevision);
+
+    /**
+     * @brief Brings the rows in line with a new view of the same dataset.
+     *
+     * Rows no longer present are removed and new ones inserted at their
+     * sorted position (or appended when unsorted); the remaining rows keep
+     * their order, selection and scroll position.
+     */
+    void updateRows(const std::vector<const TacticalVehicle*>& rows, std::uint64_t filterRevision);
+    std::uint64_t filterRevision() const { return m_filterRevision; }
+
+    const TacticalVehicle* vehicleAt(int row) const;
+
+    /// Drops the slot-keyed caches after the displayed vehicles moved slots.
+    void invalidateSlotIndex();
+
+    /**
+     * @brief Reorders the rows in place; views keep their selection and
+     *        repaint only what is visible.
+     * @param keyFields Fields the order depends on; applyChanges() re-sorts
+     *        when one of them changes (0 for static keys).
+     */
+    template <typename Compare>
+    void sortRows(Compare comp, VehicleChangeSet::Fields keyFields = 0);
+
+    /**
+     * @brief Announces telemetry changes for the displayed rows (live updates).
+     *
+     * Re-sorts when a sort key changed; otherwise emits one dataChanged per
+     * run of adjacent changed rows, spanning only the affected columns.
+     */
+    void applyChanges(const VehicleChangeSet& changes);
+
+    /// Vehicle fields displayed in a column.
+    static VehicleChangeSet::Fields columnFields(int column);
+
+private:
+    using Order = std::function<bool(const TacticalVehicle*, const TacticalVehicle*)>;
+
+    /// Cached display fragments of one vehicle (indexed by simIndex)
+    struct CellText {
+        const TacticalVehicle *vehicle = nullptr;  ///< Owner; a mismatch means the slot was reassigned
+        QString protection;
+        QColor foreground;
+        QString distance;
+        QString fuel;
+        double distanceValue = std::numeric_limits<double>::quiet_NaN();
+        double fuelValue = std::numeric_limits<double>::quiet_NaN();
+    };
+
+    const CellText& cellText(const TacticalVehicle& vehicle) const;
+
+    bool resort();
+    void beginReorder();
+    void endReorder();
+    void ensureRowIndex();
+
+    std::vector<const TacticalVehicle*> m_rows;
+    std::uint64_t m_filterRevision = 0;
+
+    // Active sort, re-applied to new rows and after key changes
+    Order m_order;
+    VehicleChangeSet::Fields m_orderFields = 0;
+
+    // Formatted text per simIndex, filled lazily for the rows the view asks for
+    mutable std::vector<CellText> m_cellText;
+
+    // simIndex -> row (-1 when not displayed); rebuilt lazily after row changes
+    std::vector<int> m_rowOfSlot;
+    bool m_rowIndexValid = false;
+
+    // Persistent indexes (selection, current row) across a reorder
+    QModelIndexList m_persistent;
+    std::vector<const TacticalVehicle*> m_persistentVehicles;
+};
+
+// --- Template Implementation ---
+template <typename Compare>
+void VehicleTableModel::sortRows(Compare comp, VehicleChangeSet::Fields keyFields) {
+    m_order = comp;
+    m_orderFields = keyFields;
+
+    ScopedLatency latency(LatencySort);
+    beginReorder();
+    TaskScheduler::shared().parallelSort("sort.view", m_rows.begin(), m_rows.end(), comp);
+    endReorder();
+}
+
+#endif // VEHICLETABLEMODEL_H
@@ -0,0 +1,115 @@
+#include "BatchRunner.h"
+#include "ShardWorker.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QThread>
+
+#include <algorithm>
+
+// Headless entry point: runs the simulation without any GUI, as fast as
+// the hardware allows, and reports throughput.
+int main(int argc, char **argv) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("TacticalVehicleBatch");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Headless faster-than-real-time tactical vehicle simulation.");
+    parser.addHelpOption();
+
+    QCommandLineOption scenarioOption({"s", "scenario"}, "Scenario JSON file.", "path", ":/data/vehicles.json");
+    QCommandLineOption stepsOption({"n", "steps"}, "Number of simulation steps.", "count", "3600");
+    QCommandLineOption timestepOption("dt", "Simulated seconds per step.", "seconds", "1.0");
+    QCommandLineOption threadsOption({"j", "threads"}, "Worker threads (0 = all cores).", "count", "1");
+    QCommandLineOption ratesOption("rates", "Steps between updates for Flash,High,Routine,Low tracks.", "list", "1,1,1,1");
+    QCommandLineOption scaleOption("scale", "Replicate the fleet N times.", "factor", "1");
+    QCommandLineOption seedOption("seed", "Deterministic random seed.", "value");
+    QCommandLineOption targetOption("target", "Mission target as X,Y (meters).", "x,y", "0,0");
+    QCommandLineOption targetsOption("targets", "Additional mission targets as X,Y;X,Y;...", "list");
+    QCommandLineOption originOption("origin", "Enable geodetic mode with tangent plane origin LAT,LON.", "lat,lon");
+    QCommandLineOption largeAreaOption("large-area", "Use great-circle distances to the target (geodetic mode).");
+    QCommandLineOption proximityOption("proximity", "Proximity pass radius in meters (0 = disabled).", "meters", "1000");
+    QCommandLineOption intervalOption("interval", "Steps between statistics rows / snapshots.", "count", "0");
+    QCommandLineOption statsOption("stats", "Write CSV statistics to file instead of stdout.", "path");
+    QCommandLineOption snapshotOption("snapshots", "Write CSV full-state snapshots to file.", "path");
+    QCommandLineOption recordOption("record", "Save a replayable recording of the run.", "path");
+    QCommandLineOption replayOption("replay", "Replay a recording and verify it is bit-exact.", "path");
+    QCommandLineOption shardsOption("shards", "Split the fleet across N worker processes (0 = in-process).", "count", "0");
+    QCommandLineOption shardByOption("shard-by", "Shard partition: hash (track ID) or spatial (X strips, with migration).", "mode", "hash");
+    QCommandLineOption migrateOption("migrate-every", "Steps between spatial shard migrations.", "count", "1");
+
+    // Internal: started by the shard coordinator
+    QCommandLineOption shardWorkerOption("shard-worker", "Run as a shard worker of the given coordinator.", "server");
+    QCommandLineOption shardIndexOption("shard-index", "Shard served by this worker.", "index", "0");
+    shardWorkerOption.setFlags(QCommandLineOption::HiddenFromHelp);
+    shardIndexOption.setFlags(QCommandLineOption::HiddenFromHelp);
+
+    parser.addOptions({scenarioOption, stepsOption, timestepOption, threadsOption, ratesOption, scaleOption,
+                       seedOption, targetOption, targetsOption, originOption, largeAreaOption,
+                       proximityOption, intervalOption, statsOption, snapshotOption,
+                       recordOption, replayOption, shardsOption, shardByOption, migrateOption,
+                       shardWorkerOption, shardIndexOption});
+    parser.process(app);
+
+    if (parser.isSet(shardWorkerOption)) {
+        ShardWorker worker(parser.value(shardWorkerOption), parser.value(shardIndexOption).toInt());
+        return worker.run();
+    }
+
+    BatchOptions options;
+    options.scenarioPath = parser.value(scenarioOption);
+    options.steps = parser.value(stepsOption).toULongLong();
+    options.timestep = parser.value(timestepOption).toDouble();
+    options.threads = parser.value(threadsOption).toInt();
+    if (options.threads <= 0) {
+        options.threads = QThread::idealThreadCount();
+    }
+    const QStringList rates = parser.value(ratesOption).split(',');
+    if (rates.size() == int(options.rateDivisors.size())) {
+        for (int c = 0; c < rates.size(); ++c) {
+            options.rateDivisors[c] = static_cast<std::uint32_t>(std::max(1, rates[c].toInt()));
+        }
+    }
+    options.scale = std::max(1, parser.value(scaleOption).toInt());
+    if (parser.isSet(seedOption)) {
+        options.seeded = true;
+        options.seed = parser.value(seedOption).toULongLong();
+    }
+    const QStringList target = parser.value(targetOption).split(',');
+    if (target.size() == 2) {
+        options.targetX = target[0].toDouble();
+        options.targetY = target[1].toDouble();
+    }
+    const QStringList targets = parser.value(targetsOption).split(';', Qt::SkipEmptyParts);
+    for (const QString& entry : targets) {
+        const QStringList xy = entry.split(',');
+        if (xy.size() == 2) {
+            options.missionTargets.push_back({xy[0].toDouble(), xy[1].toDouble()});
+        }
+    }
+    const QStringList origin = parser.value(originOption).split(',');
+    if (origin.size() == 2) {
+        options.geodetic = true;
+        options.originLatitude = origin[0].toDouble();
+        options.originLongitude = origin[1].toDouble();
+        options.largeArea = parser.isSet(largeAreaOption);
+    }
+    options.proximityRadius = parser.value(proximityOption).toDouble();
+    options.reportInterval = parser.value(intervalOption).toULongLong();
+    options.statsPath = parser.value(statsOption);
+    options.snapshotPath = parser.value(snapshotOption);
+    options.recordPath = parser.value(recordOption);
+    options.replayPath = parser.value(replayOption);
+    options.shards = std::max(0, parser.value(shardsOption).toInt());
+    if (parser.value(shardByOption) == "spatial") {
+        options.shardPartition = ShardPartition::Spatial;
+    } else if (parser.value(shardByOption) != "hash") {
+        qWarning() << "Batch Error: Unknown shard partition" << parser.value(shardByOption);
+        return 1;
+    }
+    options.migrationInterval = std::max<qulonglong>(1, parser.value(migrateOption).toULongLong());
+
+    BatchSimulationRunner runner(options);
+    return runner.run();
+}
@@ -0,0 +1,14 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    tst_clusterindex \
+    tst_fixedformat \
+    tst_interceptengine \
+    tst_proximitygrid \
+    tst_ratescheduler \
+    tst_shardcoordinator \
+    tst_simulationclock \
+    tst_simulationkernel \
+    tst_taskscheduler \
+    tst_valuehistogram \
+    tst_vehiclecontroller
@@ -0,0 +1,223 @@
+#include "ClusterIndex.h"
+
+#include <QtTest>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// --- ClusterIndex Tests ---
+
+namespace {
+constexpr double BASE_CELL = 250.0;
+constexpr double EVERYWHERE = 1e12;
+
+std::vector<ClusterSummary> clustersAt(const ClusterIndex& index, int level) {
+    std::vector<ClusterSummary> clusters;
+    index.query(level, -EVERYWHERE, -EVERYWHERE, EVERYWHERE, EVERYWHERE, clusters);
+    std::sort(clusters.begin(), clusters.end(), [](const ClusterSummary& a, const ClusterSummary& b) {
+        return std::tie(a.x, a.y, a.count) < std::tie(b.x, b.y, b.count);
+    });
+    return clusters;
+}
+
+bool near(double a, double b) {
+    return std::fabs(a - b) <= 1e-6 * std::max(1.0, std::fabs(a));
+}
+}
+
+class TestClusterIndex : public QObject {
+    Q_OBJECT
+
+private slots:
+    void insertGroupsTracksByCell();
+    void moveWithinCellShiftsCentroid();
+    void moveAcrossCellsUpdatesEveryLevel();
+    void nonFinitePositionRemovesTrack();
+    void incrementalMatchesRebuild();
+    void levelForPicksSmallestReadableLevel();
+};
+
+void TestClusterIndex::insertGroupsTracksByCell() {
+    const std::vector<std::uint8_t> affiliation = {ClusterFriendly, ClusterHostile, ClusterFriendly};
+    const std::vector<std::uint8_t> domain = {ClusterLand, ClusterAir, ClusterSea};
+    const std::vector<double> posX = {10.0, 110.0, 600.0};
+    const std::vector<double> posY = {20.0, 40.0, 20.0};
+
+    ClusterIndex index;
+    index.configure(affiliation.data(), domain.data(), 3, BASE_CELL);
+    index.update(posX.data(), posY.data(), 3);
+
+    QCOMPARE(index.clusterCount(0), std::size_t(2));
+    const std::vector<ClusterSummary> clusters = clustersAt(index, 0);
+    QCOMPARE(clusters.size(), std::size_t(2));
+
+    const ClusterSummary& pair = clusters[0];
+    QCOMPARE(pair.count, 2u);
+    QCOMPARE(pair.x, 60.0);
+    QCOMPARE(pair.y, 30.0);
+    QCOMPARE(pair.affiliations[ClusterFriendly], 1u);
+    QCOMPARE(pair.affiliations[ClusterHostile], 1u);
+    QCOMPARE(pair.domains[ClusterAir], 1u);
+
+    // A single track reports its slot
+    QCOMPARE(clusters[1].count, 1u);
+    QCOMPARE(clusters[1].slot, 2u);
+
+    // Level 2 cells are 1 km wide and hold all three tracks
+    QCOMPARE(index.clusterCount(2), std::size_t(1));
+    QCOMPARE(clustersAt(index, 2)[0].count, 3u);
+}
+
+void TestClusterIndex::moveWithinCellShiftsCentroid() {
+    const std::vector<std::uint8_t> affiliation = {ClusterFriendly, ClusterFriendly};
+    const std::vector<std::uint8_t> domain = {ClusterLand, ClusterLand};
+    std::vector<double> posX = {10.0, 30.0};
+    std::vector<double> posY = {10.0, 10.0};
+
+    ClusterIndex index;
+    index.configure(affiliation.data(), domain.data(), 2, BASE_CELL);
+    index.update(posX.data(), posY.data(), 2);
+    const std::uint64_t revision = index.revision();
+
+    posX[1] = 50.0;
+    index.update(posX.data(), posY.data(), 2);
+    QCOMPARE(clustersAt(index, 0)[0].x, 30.0);
+    QVERIFY(index.revision() > revision);
+
+    // Unchanged positions leave the revision alone
+    const std::uint64_t settled = index.revision();
+    index.update(posX.data(), posY.data(), 2);
+    QCOMPARE(index.revision(), settled);
+}
+
+void TestClusterIndex::moveAcrossCellsUpdatesEveryLevel() {
+    const std::vector<std::uint8_t> affiliation = {ClusterFriendly, ClusterHostile};
+    const std::vector<std::uint8_t> domain = {ClusterLand, ClusterLand};
+    std::vector<double> posX = {10.0, 10.0};
+    std::vector<double> posY = {10.0, 10.0};
+
+    ClusterIndex index;
+    index.configure(affiliation.data(), domain.data(), 2, BASE_CELL);
+    index.update(posX.data(), posY.data(), 2);
+    QCOMPARE(index.clusterCount(0), std::size_t(1));
+
+    // Into the neighbouring level-0 cell, which shares its level-1 parent
+    posX[1] = 300.0;
+    index.update(posX.data(), posY.data(), 2);
+    QCOMPARE(index.clusterCount(0), std::size_t(2));
+    QCOMPARE(index.clusterCount(1), std::size_t(1));
+    const ClusterSummary parent = clustersAt(index, 1)[0];
+    QCOMPARE(parent.count, 2u);
+    // Level 1 averages the child cell centres
+    QCOMPARE(parent.x, 250.0);
+    QCOMPARE(parent.affiliations[ClusterHostile], 1u);
+
+    // Far away: every level below the common ancestor splits
+    posX[1] = 1e6;
+    index.update(posX.data(), posY.data(), 2);
+    for (int level = 0; level < 12; ++level) {
+        QCOMPARE(index.clusterCount(level), std::size_t(2));
+    }
+    QCOMPARE(index.clusterCount(ClusterIndex::LEVEL_COUNT - 1), std::size_t(1));
+
+    // Back again: the emptied cells are dropped
+    posX[1] = 20.0;
+    index.update(posX.data(), posY.data(), 2);
+    for (int level = 0; level < ClusterIndex::LEVEL_COUNT; ++level) {
+        QCOMPARE(index.clusterCount(level), std::size_t(1));
+    }
+    QCOMPARE(clustersAt(index, 0)[0].x, 15.0);
+}
+
+void TestClusterIndex::nonFinitePositionRemovesTrack() {
+    const std::vector<std::uint8_t> affiliation = {ClusterNeutral};
+    const std::vector<std::uint8_t> domain = {ClusterSea};
+    std::vector<double> posX = {10.0};
+    std::vector<double> posY = {10.0};
+
+    ClusterIndex index;
+    index.configure(affiliation.data(), domain.data(), 1, BASE_CELL);
+    index.update(posX.data(), posY.data(), 1);
+
+    posX[0] = std::numeric_limits<double>::quiet_NaN();
+    index.update(posX.data(), posY.data(), 1);
+    for (int level = 0; level < ClusterIndex::LEVEL_COUNT; ++level) {
+        QCOMPARE(index.clusterCount(level), std::size_t(0));
+    }
+
+    posX[0] = 5.0;
+    index.update(posX.data(), posY.data(), 1);
+    QCOMPARE(index.clusterCount(0), std::size_t(1));
+    QCOMPARE(clustersAt(index, 0)[0].domains[ClusterSea], 1u);
+}
+
+void TestClusterIndex::incrementalMatchesRebuild() {
+    constexpr std::size_t COUNT = 500;
+    std::mt19937 random(7);
+    std::uniform_real_distribution<double> position(-20000.0, 20000.0);
+    std::normal_distribution<double> step(0.0, 400.0);
+
+    std::vector<std::uint8_t> affiliation(COUNT);
+    std::vector<std::uint8_t> domain(COUNT);
+    std::vector<double> posX(COUNT);
+    std::vector<double> posY(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        affiliation[i] = static_cast<std::uint8_t>(i % CLUSTER_AFFILIATION_COUNT);
+        domain[i] = static_cast<std::uint8_t>(i % CLUSTER_DOMAIN_COUNT);
+        posX[i] = position(random);
+        posY[i] = position(random);
+    }
+
+    ClusterIndex incremental;
+    incremental.configure(affiliation.data(), domain.data(), COUNT, BASE_CELL);
+    incremental.update(posX.data(), posY.data(), COUNT);
+
+    for (int tick = 0; tick < 20; ++tick) {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            posX[i] += step(random);
+            posY[i] += step(random);
+        }
+        incremental.update(posX.data(), posY.data(), COUNT);
+    }
+
+    ClusterIndex rebuilt;
+    rebuilt.configure(affiliation.data(), domain.data(), COUNT, BASE_CELL);
+    rebuilt.update(posX.data(), posY.data(), COUNT);
+
+    for (int level = 0; level < ClusterIndex::LEVEL_COUNT; ++level) {
+        const std::vector<ClusterSummary> expected = clustersAt(rebuilt, level);
+        const std::vector<ClusterSummary> actual = clustersAt(incremental, level);
+        QCOMPARE(actual.size(), expected.size());
+        for (std::size_t c = 0; c < expected.size(); ++c) {
+            QCOMPARE(actual[c].count, expected[c].count);
+            QVERIFY(near(actual[c].x, expected[c].x));
+            QVERIFY(near(actual[c].y, expected[c].y));
+            QVERIFY(actual[c].affiliations == expected[c].affiliations);
+            QVERIFY(actual[c].domains == expected[c].domains);
+            if (expected[c].count == 1) {
+                QCOMPARE(actual[c].slot, expected[c].slot);
+            }
+        }
+    }
+}
+
+void TestClusterIndex::levelForPicksSmallestReadableLevel() {
+    ClusterIndex index;
+    index.configure(nullptr, nullptr, 0, BASE_CELL);
+
+    // 250 m cells at 1 px/m are far wider than twice 40 px
+    QCOMPARE(index.levelFor(1.0, 40.0), -1);
+    // 0.16 px/m: 40 px at level 0
+    QCOMPARE(index.levelFor(0.16, 40.0), 0);
+    // 0.01 px/m: 250 m * 2^4 = 4 km = 40 px
+    QCOMPARE(index.levelFor(0.01, 40.0), 4);
+    QCOMPARE(index.levelFor(1e-12, 40.0), ClusterIndex::LEVEL_COUNT - 1);
+}
+
+QTEST_APPLESS_MAIN(TestClusterIndex)
+
+#include "tst_clusterindex.moc"
@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = tst_clusterindex
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../ClusterIndex.cpp \
+    tst_clusterindex.cpp
+
+HEADERS += \
+    ../../ClusterIndex.h
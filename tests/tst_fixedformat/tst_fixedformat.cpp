@@ -0,0 +1,78 @@
+#include "FixedFormat.h"
+
+#include <QtTest>
+
+#include <limits>
+#include <string>
+
+// --- formatFixed Tests ---
+
+namespace {
+std::string format(double value, int decimals) {
+    char buffer[24];
+    const int length = formatFixed(value, decimals, buffer);
+    return std::string(buffer, static_cast<std::size_t>(length));
+}
+}
+
+class TestFixedFormat : public QObject {
+    Q_OBJECT
+
+private slots:
+    void formatsDecimals();
+    void padsLeadingZeros();
+    void roundsHalfAwayFromZero();
+    void formatsNegativeValues();
+    void rejectsUnsupportedInput();
+    void fitsLargestValue();
+};
+
+void TestFixedFormat::formatsDecimals() {
+    QCOMPARE(format(42.0, 0), std::string("42"));
+    QCOMPARE(format(42.5, 1), std::string("42.5"));
+    QCOMPARE(format(3.14159, 2), std::string("3.14"));
+    QCOMPARE(format(12.0, 3), std::string("12.000"));
+}
+
+void TestFixedFormat::padsLeadingZeros() {
+    QCOMPARE(format(0.0, 0), std::string("0"));
+    QCOMPARE(format(0.0, 2), std::string("0.00"));
+    QCOMPARE(format(0.05, 2), std::string("0.05"));
+    QCOMPARE(format(0.007, 3), std::string("0.007"));
+}
+
+void TestFixedFormat::roundsHalfAwayFromZero() {
+    QCOMPARE(format(2.5, 0), std::string("3"));
+    QCOMPARE(format(-2.5, 0), std::string("-3"));
+    QCOMPARE(format(9.96, 1), std::string("10.0"));
+}
+
+void TestFixedFormat::formatsNegativeValues() {
+    QCOMPARE(format(-7.25, 2), std::string("-7.25"));
+    QCOMPARE(format(-0.5, 1), std::string("-0.5"));
+    // Values that round to zero lose their sign
+    QCOMPARE(format(-0.0004, 3), std::string("0.000"));
+}
+
+void TestFixedFormat::rejectsUnsupportedInput() {
+    char buffer[24];
+    QCOMPARE(formatFixed(std::numeric_limits<double>::quiet_NaN(), 1, buffer), 0);
+    QCOMPARE(formatFixed(std::numeric_limits<double>::infinity(), 1, buffer), 0);
+    QCOMPARE(formatFixed(1.0, -1, buffer), 0);
+    QCOMPARE(formatFixed(1.0, 4, buffer), 0);
+    // Scaled values past 2^53 would lose digits
+    QCOMPARE(formatFixed(1e13, 3, buffer), 0);
+    QCOMPARE(formatFixed(-1e16, 0, buffer), 0);
+}
+
+void TestFixedFormat::fitsLargestValue() {
+    // Just below the fast-path limit, with a sign
+    QCOMPARE(format(-999999999999.999, 3), std::string("-999999999999.999"));
+    const std::string text = format(-9007199254740991.0, 0);
+    QCOMPARE(text, std::string("-9007199254740991"));
+    QVERIFY(text.size() <= 24);
+}
+
+QTEST_APPLESS_MAIN(TestFixedFormat)
+
+#include "tst_fixedformat.moc"
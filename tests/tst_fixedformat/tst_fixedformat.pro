@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = tst_fixedformat
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../FixedFormat.cpp \
+    tst_fixedformat.cpp
+
+HEADERS += \
+    ../../FixedFormat.h
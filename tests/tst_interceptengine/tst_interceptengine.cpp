@@ -0,0 +1,212 @@
+#include "InterceptEngine.h"
+
+#include <QtTest>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// --- InterceptEngine Tests ---
+
+namespace {
+constexpr double PI_CONST = 3.14159265358979323846;
+
+/// Velocity in m/s, same heading convention as the engine and the kernel.
+void velocityOf(const KinematicsBuffers& k, std::size_t i, double& vx, double& vy) {
+    const double rad = (k.heading[i] - 90.0) * (PI_CONST / 180.0);
+    vx = k.speed[i] / 3.6 * std::cos(rad);
+    vy = k.speed[i] / 3.6 * std::sin(rad);
+}
+
+/// Moves every slot along its true velocity.
+void advance(KinematicsBuffers& k, double seconds) {
+    for (std::size_t i = 0; i < k.size(); ++i) {
+        double vx = 0.0;
+        double vy = 0.0;
+        velocityOf(k, i, vx, vy);
+        k.posX[i] += vx * seconds;
+        k.posY[i] += vy * seconds;
+    }
+}
+
+/// An engine with the same sets that solves every pair from scratch.
+InterceptEngine fullSolve(const InterceptEngine& engine, const KinematicsBuffers& k, double now, double radius) {
+    InterceptEngine fresh;
+    fresh.configure(engine.friendlySlots(), engine.hostileSlots(), engine.slotCount());
+    fresh.setHorizon(engine.horizon());
+    fresh.update(k, now, radius);
+    return fresh;
+}
+
+bool near(double a, double b, double tolerance) {
+    return a == b || std::fabs(a - b) <= tolerance;
+}
+
+void place(KinematicsBuffers& k, std::size_t i, double x, double y, double heading, double speed) {
+    k.posX[i] = x;
+    k.posY[i] = y;
+    k.heading[i] = heading;
+    k.speed[i] = speed;
+}
+}
+
+class TestInterceptEngine : public QObject {
+    Q_OBJECT
+
+private slots:
+    void cachedPairsMatchFullSolve();
+    void subToleranceChangeErrorIsBounded();
+    void changedPairsAreResolved();
+    void etaCoversClosingRecedingAndZeroRange();
+};
+
+void TestInterceptEngine::cachedPairsMatchFullSolve() {
+    constexpr std::size_t COUNT = 300;
+    constexpr double RADIUS = 1000.0;
+    std::mt19937 random(17);
+    std::uniform_real_distribution<double> position(0.0, 20000.0);
+    std::uniform_real_distribution<double> heading(0.0, 360.0);
+    std::uniform_real_distribution<double> speed(20.0, 80.0);
+
+    KinematicsBuffers k;
+    k.resize(COUNT);
+    std::vector<std::uint32_t> friendly;
+    std::vector<std::uint32_t> hostile;
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        place(k, i, position(random), position(random), heading(random), speed(random));
+        // A third of the slots is in neither set
+        if (i % 3 == 0) friendly.push_back(static_cast<std::uint32_t>(i));
+        if (i % 3 == 1) hostile.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    InterceptEngine engine;
+    engine.configure(friendly, hostile, COUNT);
+    QVERIFY(engine.update(k, 0.0, RADIUS) > 0);
+    QVERIFY(engine.pairCount() > 0);
+    // Nothing moved: every pair is served from the cache
+    QCOMPARE(engine.update(k, 0.0, RADIUS), std::size_t(0));
+
+    // At constant velocities the cached invariants give the full solution,
+    // before and after each pair's CPA
+    for (int step = 1; step <= 6; ++step) {
+        advance(k, 30.0);
+        const double now = 30.0 * step;
+        engine.update(k, now, RADIUS);
+        const InterceptEngine fresh = fullSolve(engine, k, now, RADIUS);
+        QCOMPARE(engine.pairCount(), fresh.pairCount());
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            QCOMPARE(engine.cpaPartner(i), fresh.cpaPartner(i));
+            QVERIFY(near(engine.timeToCpa(i), fresh.timeToCpa(i), 1e-6));
+            QVERIFY(near(engine.cpaDistance(i), fresh.cpaDistance(i), 1e-6));
+        }
+    }
+}
+
+void TestInterceptEngine::subToleranceChangeErrorIsBounded() {
+    // Head-on along parallel lines 300 m apart, 10 m/s each: CPA in 100 s
+    KinematicsBuffers k;
+    k.resize(2);
+    place(k, 0, 0.0, 0.0, 90.0, 36.0);
+    place(k, 1, 2000.0, 300.0, 270.0, 36.0);
+
+    InterceptEngine engine;
+    engine.configure({0}, {1}, 2);
+    QCOMPARE(engine.update(k, 0.0, 500.0), std::size_t(1));
+    QVERIFY(near(engine.timeToCpa(0), 100.0, 1e-9));
+    QVERIFY(near(engine.cpaDistance(0), 300.0, 1e-9));
+
+    // A 1.5 degree turn moves the velocity by 0.26 m/s, inside the 0.5 m/s
+    // tolerance: the stale solution is kept
+    k.heading[1] = 271.5;
+    QCOMPARE(engine.update(k, 0.0, 500.0), std::size_t(0));
+    QVERIFY(near(engine.cpaDistance(0), 300.0, 1e-9));
+
+    const InterceptEngine fresh = fullSolve(engine, k, 0.0, 500.0);
+    const double staleError = std::fabs(engine.cpaDistance(0) - fresh.cpaDistance(0));
+    QVERIFY(staleError > 1.0);
+
+    // The separations of both solutions drift apart by at most the velocity
+    // change per second, so the CPA distances differ by at most that times
+    // the later CPA time
+    double vx = 0.0;
+    double vy = 0.0;
+    velocityOf(k, 1, vx, vy);
+    const double velocityChange = std::hypot(vx - -10.0, vy);
+    QVERIFY(velocityChange <= 0.5);
+    const double bound = velocityChange * std::max(engine.timeToCpa(0), fresh.timeToCpa(0));
+    QVERIFY(staleError <= bound + 1e-9);
+    // ...which the tolerance caps at 0.5 m/s times the horizon
+    QVERIFY(bound <= 0.5 * engine.horizon());
+}
+
+void TestInterceptEngine::changedPairsAreResolved() {
+    // Two friendlies and two hostiles, all four pairs within reach
+    KinematicsBuffers k;
+    k.resize(4);
+    place(k, 0, 0.0, 0.0, 90.0, 36.0);
+    place(k, 1, 2000.0, 300.0, 270.0, 36.0);
+    place(k, 2, 0.0, 1000.0, 90.0, 36.0);
+    place(k, 3, 2000.0, 1300.0, 270.0, 36.0);
+
+    InterceptEngine engine;
+    engine.configure({0, 2}, {1, 3}, 4);
+    QCOMPARE(engine.update(k, 0.0, 500.0), std::size_t(4));
+    QCOMPARE(engine.pairCount(), std::size_t(4));
+
+    // Below the tolerance nothing is re-solved, however often it repeats
+    k.heading[1] = 271.5;
+    QCOMPARE(engine.update(k, 0.0, 500.0), std::size_t(0));
+    k.speed[3] = 37.0;
+    QCOMPARE(engine.update(k, 0.0, 500.0), std::size_t(0));
+
+    // A 5 degree turn (0.87 m/s away from the cached velocity) re-solves
+    // exactly the pairs of that hostile
+    advance(k, 10.0);
+    k.heading[1] = 275.0;
+    QCOMPARE(engine.update(k, 10.0, 500.0), std::size_t(2));
+
+    // The re-solved pairs match a full solve; the others keep their error
+    const InterceptEngine fresh = fullSolve(engine, k, 10.0, 500.0);
+    for (const std::size_t slot : {std::size_t(0), std::size_t(2)}) {
+        if (engine.cpaPartner(slot) == 1) {
+            QCOMPARE(fresh.cpaPartner(slot), 1);
+            QVERIFY(near(engine.timeToCpa(slot), fresh.timeToCpa(slot), 1e-9));
+            QVERIFY(near(engine.cpaDistance(slot), fresh.cpaDistance(slot), 1e-9));
+        }
+    }
+    QCOMPARE(engine.cpaPartner(1), fresh.cpaPartner(1));
+    QVERIFY(near(engine.timeToCpa(1), fresh.timeToCpa(1), 1e-9));
+    QVERIFY(near(engine.cpaDistance(1), fresh.cpaDistance(1), 1e-9));
+
+    // invalidate() forces a full re-solve
+    engine.invalidate();
+    QCOMPARE(engine.update(k, 10.0, 500.0), std::size_t(4));
+}
+
+void TestInterceptEngine::etaCoversClosingRecedingAndZeroRange() {
+    KinematicsBuffers k;
+    k.resize(4);
+    place(k, 0, 1000.0, 0.0, 270.0, 36.0); // Closing at 10 m/s
+    place(k, 1, 1000.0, 0.0, 90.0, 36.0);  // Receding
+    place(k, 2, 1000.0, 0.0, 270.0, 0.0);  // Stationary
+    place(k, 3, 0.0, 0.0, 90.0, 36.0);     // On the target
+
+    InterceptEngine engine;
+    engine.configure({0, 1, 2, 3}, {}, 4);
+    engine.update(k, 0.0, 500.0);
+
+    std::vector<double> eta(4, -1.0);
+    engine.computeEta(k, 0.0, 0.0, eta.data());
+    QVERIFY(near(eta[0], 100.0, 1e-9));
+    QVERIFY(std::isinf(eta[1]));
+    QVERIFY(std::isinf(eta[2]));
+    QCOMPARE(eta[3], 0.0);
+
+    // Half way there, at the same closing speed
+    k.posX[0] = 500.0;
+    engine.computeEta(k, 0.0, 0.0, eta.data());
+    QVERIFY(near(eta[0], 50.0, 1e-9));
+}
+
+QTEST_APPLESS_MAIN(TestInterceptEngine)
+#include "tst_interceptengine.moc"
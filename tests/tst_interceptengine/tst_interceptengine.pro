@@ -0,0 +1,19 @@
+TEMPLATE = app
+TARGET = tst_interceptengine
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../InterceptEngine.cpp \
+    ../../ProximityGrid.cpp \
+    ../../SimulationKernel.cpp \
+    tst_interceptengine.cpp
+
+HEADERS += \
+    ../../InterceptEngine.h \
+    ../../ProximityGrid.h \
+    ../../SimulationKernel.h
@@ -0,0 +1,211 @@
+#include "ProximityGrid.h"
+
+#include <QtTest>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// --- ProximityGrid Tests ---
+
+namespace {
+// Friendly <-> hostile and hostile <-> hostile interact; other tracks do not
+const std::uint8_t INTERACTS[3] = {
+    0,
+    1u << ProximityHostile,
+    (1u << ProximityFriendly) | (1u << ProximityHostile)
+};
+
+void sortPairs(std::vector<ProximityPair>& pairs) {
+    std::sort(pairs.begin(), pairs.end(), [](const ProximityPair& a, const ProximityPair& b) {
+        return std::tie(a.first, a.second) < std::tie(b.first, b.second);
+    });
+}
+
+/// Closest approach of two straight moves, by brute force over every pair.
+std::vector<ProximityPair> bruteForceSwept(const std::vector<double>& fromX, const std::vector<double>& fromY,
+                                           const std::vector<double>& toX, const std::vector<double>& toY,
+                                           const std::vector<std::uint8_t>& group, double radius) {
+    std::vector<ProximityPair> pairs;
+    for (std::size_t i = 0; i < toX.size(); ++i) {
+        for (std::size_t j = i + 1; j < toX.size(); ++j) {
+            if (!(INTERACTS[group[i]] & (1u << group[j]))) {
+                continue;
+            }
+            // Separation s(t) = a + b t; |s|^2 is smallest at t = -(a.b)/(b.b) in [0, 1]
+            const double ax = fromX[j] - fromX[i];
+            const double ay = fromY[j] - fromY[i];
+            const double bx = (toX[j] - fromX[j]) - (toX[i] - fromX[i]);
+            const double by = (toY[j] - fromY[j]) - (toY[i] - fromY[i]);
+            const double bb = bx * bx + by * by;
+            const double t = bb > 0.0 ? std::min(1.0, std::max(0.0, -(ax * bx + ay * by) / bb)) : 0.0;
+            const double distance = std::hypot(ax + bx * t, ay + by * t);
+            if (distance <= radius) {
+                pairs.push_back({static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j), distance});
+            }
+        }
+    }
+    return pairs;
+}
+}
+
+class TestProximityGrid : public QObject {
+    Q_OBJECT
+
+private slots:
+    void staticPairsRespectRadius();
+    void findPairsMatchesBruteForce();
+    void crossingTracksAreSwept();
+    void sweptPairsMatchBruteForce();
+    void forEachNearCoversRange();
+};
+
+void TestProximityGrid::staticPairsRespectRadius() {
+    const std::vector<double> posX = {0.0, 99.9, 1000.0, 1100.1};
+    const std::vector<double> posY = {0.0, 0.0, 0.0, 0.0};
+    const std::vector<std::uint8_t> group(4, ProximityHostile);
+
+    ProximityGrid grid;
+    grid.build(posX.data(), posY.data(), 4, 100.0);
+    std::vector<ProximityPair> pairs;
+    grid.findPairs(posX.data(), posY.data(), group.data(), INTERACTS, 100.0, 0, 4, pairs);
+    QCOMPARE(pairs.size(), std::size_t(1));
+    QCOMPARE(pairs[0].first, 0u);
+    QCOMPARE(pairs[0].second, 1u);
+
+    // Standing still, the swept query agrees
+    pairs.clear();
+    grid.findSweptPairs(posX.data(), posY.data(), posX.data(), posY.data(), group.data(), INTERACTS, 100.0,
+                        0, 4, pairs);
+    QCOMPARE(pairs.size(), std::size_t(1));
+    QCOMPARE(pairs[0].second, 1u);
+}
+
+void TestProximityGrid::findPairsMatchesBruteForce() {
+    constexpr std::size_t COUNT = 600;
+    constexpr double RADIUS = 250.0;
+    std::mt19937 random(11);
+    std::uniform_real_distribution<double> position(0.0, 8000.0);
+
+    std::vector<double> posX(COUNT);
+    std::vector<double> posY(COUNT);
+    std::vector<std::uint8_t> group(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        posX[i] = position(random);
+        posY[i] = position(random);
+        group[i] = static_cast<std::uint8_t>(i % 3);
+    }
+    // Non-finite positions take no part
+    posX[7] = std::nan("");
+
+    ProximityGrid grid;
+    grid.build(posX.data(), posY.data(), COUNT, RADIUS);
+    std::vector<ProximityPair> pairs;
+    grid.findPairs(posX.data(), posY.data(), group.data(), INTERACTS, RADIUS, 0, COUNT, pairs);
+    sortPairs(pairs);
+
+    const std::vector<ProximityPair> expected = bruteForceSwept(posX, posY, posX, posY, group, RADIUS);
+    QCOMPARE(pairs.size(), expected.size());
+    for (std::size_t p = 0; p < expected.size(); ++p) {
+        QCOMPARE(pairs[p].first, expected[p].first);
+        QCOMPARE(pairs[p].second, expected[p].second);
+        QVERIFY(std::fabs(pairs[p].distance - expected[p].distance) < 1e-9);
+    }
+}
+
+void TestProximityGrid::crossingTracksAreSwept() {
+    // Two tracks cross at the origin and end 700 m apart; a third pair
+    // stands still just outside the radius
+    const std::vector<double> fromX = {-500.0, 0.0, 5000.0, 5100.5};
+    const std::vector<double> fromY = {0.0, -500.0, 0.0, 0.0};
+    const std::vector<double> toX = {500.0, 0.0, 5000.0, 5100.5};
+    const std::vector<double> toY = {0.0, 500.0, 0.0, 0.0};
+    const std::vector<std::uint8_t> group = {ProximityFriendly, ProximityHostile, ProximityHostile, ProximityHostile};
+    constexpr double RADIUS = 100.0;
+
+    // The end positions alone show no contact
+    ProximityGrid grid;
+    grid.build(toX.data(), toY.data(), 4, RADIUS + 2.0 * 1000.0);
+    std::vector<ProximityPair> pairs;
+    grid.findPairs(toX.data(), toY.data(), group.data(), INTERACTS, RADIUS, 0, 4, pairs);
+    QVERIFY(pairs.empty());
+
+    grid.findSweptPairs(fromX.data(), fromY.data(), toX.data(), toY.data(), group.data(), INTERACTS, RADIUS,
+                        0, 4, pairs);
+    QCOMPARE(pairs.size(), std::size_t(1));
+    QCOMPARE(pairs[0].first, 0u);
+    QCOMPARE(pairs[0].second, 1u);
+    QVERIFY(pairs[0].distance < 1e-9);
+}
+
+void TestProximityGrid::sweptPairsMatchBruteForce() {
+    constexpr std::size_t COUNT = 500;
+    constexpr double RADIUS = 150.0;
+    constexpr double MAX_MOVE = 400.0;
+    std::mt19937 random(5);
+    std::uniform_real_distribution<double> position(0.0, 10000.0);
+    std::uniform_real_distribution<double> move(-MAX_MOVE / std::sqrt(2.0), MAX_MOVE / std::sqrt(2.0));
+
+    std::vector<double> fromX(COUNT);
+    std::vector<double> fromY(COUNT);
+    std::vector<double> toX(COUNT);
+    std::vector<double> toY(COUNT);
+    std::vector<std::uint8_t> group(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        fromX[i] = position(random);
+        fromY[i] = position(random);
+        toX[i] = fromX[i] + move(random);
+        toY[i] = fromY[i] + move(random);
+        group[i] = static_cast<std::uint8_t>(i % 3);
+    }
+
+    ProximityGrid grid;
+    grid.build(toX.data(), toY.data(), COUNT, RADIUS + 2.0 * MAX_MOVE);
+    std::vector<ProximityPair> pairs;
+    grid.findSweptPairs(fromX.data(), fromY.data(), toX.data(), toY.data(), group.data(), INTERACTS, RADIUS,
+                        0, COUNT, pairs);
+    sortPairs(pairs);
+
+    const std::vector<ProximityPair> expected = bruteForceSwept(fromX, fromY, toX, toY, group, RADIUS);
+    QVERIFY(!expected.empty());
+    QCOMPARE(pairs.size(), expected.size());
+    for (std::size_t p = 0; p < expected.size(); ++p) {
+        QCOMPARE(pairs[p].first, expected[p].first);
+        QCOMPARE(pairs[p].second, expected[p].second);
+        QVERIFY(std::fabs(pairs[p].distance - expected[p].distance) < 1e-6);
+    }
+}
+
+void TestProximityGrid::forEachNearCoversRange() {
+    constexpr std::size_t COUNT = 300;
+    std::mt19937 random(3);
+    std::uniform_real_distribution<double> position(-3000.0, 3000.0);
+    std::vector<double> posX(COUNT);
+    std::vector<double> posY(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        posX[i] = position(random);
+        posY[i] = position(random);
+    }
+
+    ProximityGrid grid;
+    grid.build(posX.data(), posY.data(), COUNT, 200.0);
+    // Ranges below, at and above the cell size, and one covering the table
+    for (const double range : {50.0, 200.0, 650.0, 1e6}) {
+        for (std::size_t i = 0; i < COUNT; i += 17) {
+            std::vector<int> visits(COUNT, 0);
+            grid.forEachNear(i, range, [&visits](std::uint32_t j) { ++visits[j]; });
+            for (std::size_t j = 0; j < COUNT; ++j) {
+                QVERIFY(visits[j] <= 1);
+                if (std::hypot(posX[j] - posX[i], posY[j] - posY[i]) <= range) {
+                    QCOMPARE(visits[j], 1);
+                }
+            }
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(TestProximityGrid)
+
+#include "tst_proximitygrid.moc"
@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = tst_proximitygrid
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../ProximityGrid.cpp \
+    tst_proximitygrid.cpp
+
+HEADERS += \
+    ../../ProximityGrid.h
@@ -0,0 +1,133 @@
+#include "RateScheduler.h"
+
+#include <QtTest>
+
+#include <algorithm>
+#include <vector>
+
+// --- RateScheduler Tests ---
+
+namespace {
+using ClassBegin = std::array<std::size_t, RATE_CLASS_COUNT + 1>;
+
+// Flash 0-9, High 10-29, Routine 30-99, Low 100-106
+const ClassBegin CLASS_BEGIN = {0, 10, 30, 100, 107};
+}
+
+class TestRateScheduler : public QObject {
+    Q_OBJECT
+
+private slots:
+    void uniformUpdatesEverySlot();
+    void divisorsBelowOneAreClamped();
+    void everySlotOncePerPeriod();
+    void phasesDifferByAtMostOneSlot();
+    void emptyClassesYieldNoRange();
+    void classOfFollowsRuns();
+};
+
+void TestRateScheduler::uniformUpdatesEverySlot() {
+    RateScheduler scheduler;
+    scheduler.configure(CLASS_BEGIN);
+    QVERIFY(scheduler.isUniform());
+
+    for (std::uint64_t tick = 0; tick < 3; ++tick) {
+        std::vector<SlotRange> ranges;
+        scheduler.dueRanges(tick, ranges);
+        QCOMPARE(ranges.size(), RATE_CLASS_COUNT);
+        for (std::size_t c = 0; c < RATE_CLASS_COUNT; ++c) {
+            QCOMPARE(ranges[c].begin, CLASS_BEGIN[c]);
+            QCOMPARE(ranges[c].end, CLASS_BEGIN[c + 1]);
+        }
+    }
+}
+
+void TestRateScheduler::divisorsBelowOneAreClamped() {
+    RateScheduler scheduler;
+    scheduler.setDivisors({0, 1, 4, 0});
+    QCOMPARE(scheduler.divisors()[0], 1u);
+    QCOMPARE(scheduler.divisors()[2], 4u);
+    QCOMPARE(scheduler.divisors()[3], 1u);
+    QVERIFY(!scheduler.isUniform());
+
+    scheduler.setDivisors({1, 1, 1, 0});
+    QVERIFY(scheduler.isUniform());
+}
+
+void TestRateScheduler::everySlotOncePerPeriod() {
+    RateScheduler scheduler;
+    scheduler.configure(CLASS_BEGIN);
+    scheduler.setDivisors({1, 2, 5, 3});
+
+    // Over the common period each class is updated once per own period
+    constexpr std::uint64_t PERIOD = 30;
+    std::vector<std::uint32_t> updates(CLASS_BEGIN[RATE_CLASS_COUNT], 0);
+    for (std::uint64_t tick = 0; tick < PERIOD; ++tick) {
+        std::vector<SlotRange> ranges;
+        scheduler.dueRanges(tick, ranges);
+        for (std::size_t r = 0; r < ranges.size(); ++r) {
+            QVERIFY(ranges[r].begin < ranges[r].end);
+            if (r > 0) {
+                QVERIFY(ranges[r - 1].end <= ranges[r].begin);
+            }
+            for (std::size_t slot = ranges[r].begin; slot < ranges[r].end; ++slot) {
+                ++updates[slot];
+            }
+        }
+    }
+
+    for (std::size_t slot = 0; slot < updates.size(); ++slot) {
+        const std::uint32_t divisor = scheduler.divisors()[scheduler.classOf(slot)];
+        QCOMPARE(updates[slot], static_cast<std::uint32_t>(PERIOD / divisor));
+    }
+}
+
+void TestRateScheduler::phasesDifferByAtMostOneSlot() {
+    RateScheduler scheduler;
+    scheduler.configure({0, 0, 0, 70, 70});
+    scheduler.setDivisors({1, 1, 8, 1});
+
+    std::size_t smallest = 70;
+    std::size_t largest = 0;
+    for (std::uint64_t tick = 0; tick < 8; ++tick) {
+        std::vector<SlotRange> ranges;
+        scheduler.dueRanges(tick, ranges);
+        QCOMPARE(ranges.size(), std::size_t(1));
+        smallest = std::min(smallest, ranges[0].end - ranges[0].begin);
+        largest = std::max(largest, ranges[0].end - ranges[0].begin);
+    }
+    QCOMPARE(smallest, std::size_t(8));
+    QCOMPARE(largest, std::size_t(9));
+}
+
+void TestRateScheduler::emptyClassesYieldNoRange() {
+    RateScheduler scheduler;
+    scheduler.configure({0, 0, 5, 5, 5});
+    // Fewer slots than phases: some ticks update nothing
+    scheduler.setDivisors({1, 10, 1, 1});
+
+    std::size_t due = 0;
+    for (std::uint64_t tick = 0; tick < 10; ++tick) {
+        std::vector<SlotRange> ranges;
+        scheduler.dueRanges(tick, ranges);
+        QVERIFY(ranges.size() <= 1);
+        for (const SlotRange& range : ranges) {
+            due += range.end - range.begin;
+        }
+    }
+    QCOMPARE(due, std::size_t(5));
+}
+
+void TestRateScheduler::classOfFollowsRuns() {
+    RateScheduler scheduler;
+    scheduler.configure(CLASS_BEGIN);
+    QCOMPARE(scheduler.classOf(0), RateFlash);
+    QCOMPARE(scheduler.classOf(9), RateFlash);
+    QCOMPARE(scheduler.classOf(10), RateHigh);
+    QCOMPARE(scheduler.classOf(99), RateRoutine);
+    QCOMPARE(scheduler.classOf(100), RateLow);
+}
+
+QTEST_APPLESS_MAIN(TestRateScheduler)
+
+#include "tst_ratescheduler.moc"
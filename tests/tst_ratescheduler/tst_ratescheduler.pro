@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = tst_ratescheduler
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../RateScheduler.cpp \
+    tst_ratescheduler.cpp
+
+HEADERS += \
+    ../../RateScheduler.h
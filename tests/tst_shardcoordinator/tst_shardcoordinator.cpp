@@ -0,0 +1,190 @@
+#include "ShardCoordinator.h"
+#include "ShardWorker.h"
+#include "TacticalVehicleController.h"
+#include "TacticalVehicleData.h"
+
+#include <QCoreApplication>
+#include <QStringList>
+#include <QtTest>
+
+#include <vector>
+
+// --- ShardCoordinator Tests ---
+// The coordinator starts this executable again with --shard-worker, so the
+// worker processes run the same build as the test.
+
+namespace {
+constexpr int FLEET_SIZE = 240;
+constexpr double TARGET_X = 6000.0;
+constexpr double TARGET_Y = -2000.0;
+
+TacticalVehicle makeVehicle(int index) {
+    static const char* const PRIORITIES[] = {"Flash", "High", "Routine", "Low"};
+    TacticalVehicle vehicle;
+    vehicle.callsign = QString("Unit %1").arg(index);
+    vehicle.trackId = QString("S-%1").arg(index);
+    vehicle.affiliation = index % 2 == 0 ? "Friendly" : "Hostile";
+    vehicle.priority = PRIORITIES[index % 4];
+    vehicle.domain = "Land";
+    vehicle.maxSpeed = 90.0;
+    vehicle.targetSpeed = 40.0 + index % 30;
+    vehicle.speed = vehicle.targetSpeed;
+    // East- and westbound tracks spread over 20 km, so spatial strips trade members
+    vehicle.heading = index % 3 == 0 ? 270.0 : 90.0 + index % 7;
+    vehicle.posX = -10000.0 + (index * 7919) % 20000;
+    vehicle.posY = 200.0 * (index % 50);
+    return vehicle;
+}
+
+TacticalVehicleData::VehicleBatch makeFleet() {
+    TacticalVehicleData::VehicleBatch batch;
+    for (int i = 0; i < FLEET_SIZE; ++i) {
+        batch.vehicles.push_back(makeVehicle(i));
+    }
+    return batch;
+}
+
+/**
+ * @brief Uniform rate divisors: a slot's phase inside a slower rate group
+ *        follows the shard's slot layout, so only a uniform schedule steps
+ *        every vehicle at the same ticks in every partition.
+ */
+ShardSettings makeSettings() {
+    ShardSettings settings;
+    settings.seeded = true;
+    settings.seed = 23;
+    settings.timestep = 1.0;
+    settings.threads = 1;
+    settings.proximityRadius = 500.0;
+    return settings;
+}
+
+/// The same run in this process, configured the way ShardWorker configures its controller.
+void runSingleProcess(TacticalVehicleData& data, const ShardSettings& settings,
+                      const std::vector<std::uint64_t>& chunks) {
+    TacticalVehicleController controller(data);
+    controller.setRandomSeed(settings.seed);
+    controller.setThreadCount(settings.threads);
+    controller.setTimestep(settings.timestep);
+    controller.setRateDivisors(settings.rateDivisors);
+    controller.setProximityRadius(settings.proximityRadius);
+    for (const std::uint64_t steps : chunks) {
+        controller.runSteps(steps, TARGET_X, TARGET_Y);
+    }
+}
+
+/// Integrated telemetry; pair results only see a shard and are left out.
+bool sameKinematics(const TacticalVehicle& a, const TacticalVehicle& b) {
+    return a.posX == b.posX && a.posY == b.posY && a.heading == b.heading && a.speed == b.speed
+        && a.fuelLevel == b.fuelLevel && a.ammunitionLevel == b.ammunitionLevel
+        && a.distanceToTarget == b.distanceToTarget;
+}
+
+std::size_t totalMembers(const ShardCoordinator& coordinator) {
+    std::size_t total = 0;
+    for (int s = 0; s < coordinator.shardCount(); ++s) {
+        total += coordinator.shardSize(s);
+    }
+    return total;
+}
+}
+
+class TestShardCoordinator : public QObject {
+    Q_OBJECT
+
+private slots:
+    void trackHashMatchesSingleProcess();
+    void spatialMigrationKeepsEveryTrack();
+};
+
+void TestShardCoordinator::trackHashMatchesSingleProcess() {
+    const ShardSettings settings = makeSettings();
+    const std::vector<std::uint64_t> chunks = {120, 80};
+
+    TacticalVehicleData reference;
+    reference.appendVehicles(makeFleet());
+    runSingleProcess(reference, settings, chunks);
+
+    for (const int shardCount : {2, 3}) {
+        TacticalVehicleData data;
+        data.appendVehicles(makeFleet());
+        ShardCoordinator coordinator(data);
+        QVERIFY(coordinator.start(shardCount, ShardPartition::TrackHash, settings));
+        QCOMPARE(coordinator.shardCount(), shardCount);
+        QCOMPARE(totalMembers(coordinator), std::size_t(FLEET_SIZE));
+        for (int s = 0; s < shardCount; ++s) {
+            QVERIFY(coordinator.shardSize(s) > 0);
+        }
+
+        for (const std::uint64_t steps : chunks) {
+            QVERIFY(coordinator.runSteps(steps, TARGET_X, TARGET_Y));
+        }
+        coordinator.stop();
+
+        // Jitter streams follow the vehicle, so the merged fleet is the
+        // single-process fleet bit for bit
+        QCOMPARE(data.vehicles().size(), reference.vehicles().size());
+        for (std::size_t i = 0; i < reference.vehicles().size(); ++i) {
+            QCOMPARE(data.vehicles()[i].trackId, reference.vehicles()[i].trackId);
+            QVERIFY(sameKinematics(data.vehicles()[i], reference.vehicles()[i]));
+        }
+        QCOMPARE(coordinator.migrations(), std::uint64_t(0));
+    }
+}
+
+void TestShardCoordinator::spatialMigrationKeepsEveryTrack() {
+    const ShardSettings settings = makeSettings();
+    const std::vector<std::uint64_t> chunks(6, 50);
+
+    TacticalVehicleData data;
+    data.appendVehicles(makeFleet());
+    ShardCoordinator coordinator(data);
+    coordinator.setMigrationInterval(5);
+    QVERIFY(coordinator.start(3, ShardPartition::Spatial, settings));
+    QCOMPARE(totalMembers(coordinator), std::size_t(FLEET_SIZE));
+
+    std::vector<double> lastX;
+    for (const auto& v : data.vehicles()) {
+        lastX.push_back(v.posX);
+    }
+    for (const std::uint64_t steps : chunks) {
+        QVERIFY(coordinator.runSteps(steps, TARGET_X, TARGET_Y));
+
+        // Every track moves, so one whose record did not change was merged
+        // from no shard; with the member count unchanged, none is held twice
+        QCOMPARE(totalMembers(coordinator), std::size_t(FLEET_SIZE));
+        for (std::size_t i = 0; i < data.vehicles().size(); ++i) {
+            QVERIFY(data.vehicles()[i].posX != lastX[i]);
+            lastX[i] = data.vehicles()[i].posX;
+        }
+    }
+    QVERIFY(coordinator.migrations() > 0);
+    coordinator.stop();
+
+    // Migrated tracks keep their state and draws: the run still matches a
+    // single process
+    TacticalVehicleData reference;
+    reference.appendVehicles(makeFleet());
+    runSingleProcess(reference, settings, chunks);
+    for (std::size_t i = 0; i < reference.vehicles().size(); ++i) {
+        QCOMPARE(data.vehicles()[i].trackId, reference.vehicles()[i].trackId);
+        QVERIFY(sameKinematics(data.vehicles()[i], reference.vehicles()[i]));
+    }
+}
+
+int main(int argc, char **argv) {
+    QCoreApplication app(argc, argv);
+
+    const QStringList arguments = app.arguments();
+    const int server = arguments.indexOf("--shard-worker");
+    if (server >= 0) {
+        const int index = arguments.indexOf("--shard-index");
+        ShardWorker worker(arguments.value(server + 1), index >= 0 ? arguments.value(index + 1).toInt() : 0);
+        return worker.run();
+    }
+
+    TestShardCoordinator test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "tst_shardcoordinator.moc"
@@ -0,0 +1,35 @@
+TEMPLATE = app
+TARGET = tst_shardcoordinator
+
+QT = core network testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../ClusterIndex.cpp \
+    ../../ConsumptionModel.cpp \
+    ../../GeoProjection.cpp \
+    ../../InterceptEngine.cpp \
+    ../../PerformanceMonitor.cpp \
+    ../../ProximityGrid.cpp \
+    ../../RateScheduler.cpp \
+    ../../ShardCoordinator.cpp \
+    ../../ShardProtocol.cpp \
+    ../../ShardWorker.cpp \
+    ../../SimulationKernel.cpp \
+    ../../SimulationRecording.cpp \
+    ../../TacticalVehicleController.cpp \
+    ../../TacticalVehicleData.cpp \
+    ../../TaskScheduler.cpp \
+    ../../ValueHistogram.cpp \
+    ../../VehicleChangeSet.cpp \
+    tst_shardcoordinator.cpp
+
+HEADERS += \
+    ../../ShardCoordinator.h \
+    ../../ShardProtocol.h \
+    ../../ShardWorker.h \
+    ../../TacticalVehicleController.h \
+    ../../TacticalVehicleData.h
@@ -0,0 +1,162 @@
+#include "SimulationClock.h"
+
+#include <QtTest>
+
+#include <cmath>
+#include <cstdint>
+
+// --- SimulationClock Tests ---
+
+namespace {
+/// Base 0.1 s, budget 50 ms, with a measured cost of 10 ms per step
+/// (5 affordable steps per tick).
+SimulationClock loadedClock() {
+    SimulationClock clock;
+    clock.setBaseTimestep(0.1);
+    clock.setMaxTimestep(1.0);
+    clock.setStepBudget(0.05);
+    clock.reportStepCost(0.01, 1);
+    return clock;
+}
+}
+
+class TestSimulationClock : public QObject {
+    Q_OBJECT
+
+private slots:
+    void carriesFractionalDebt();
+    void warpScalesSteps();
+    void pauseAndSingleStep();
+    void overloadShedsDebt();
+    void coarsensInWholeMultiples();
+    void coarseningIsCappedByMaxTimestep();
+    void multipleReleasesAfterLoadDrops();
+    void disablingCoarseningResetsMultiple();
+    void achievedWarpReportsDeliveredRate();
+};
+
+void TestSimulationClock::carriesFractionalDebt() {
+    SimulationClock clock;
+    clock.setBaseTimestep(0.1);
+
+    // 25 ms heartbeats owe a quarter step each; nothing may be lost
+    std::uint64_t steps = 0;
+    for (int tick = 0; tick < 400; ++tick) {
+        const ClockTick planned = clock.advance(0.025);
+        QCOMPARE(planned.multiple, 1u);
+        QCOMPARE(planned.timestep, 0.1);
+        steps += planned.steps;
+    }
+    QVERIFY(steps >= 99 && steps <= 100);
+    QVERIFY(!clock.isSaturated());
+}
+
+void TestSimulationClock::warpScalesSteps() {
+    SimulationClock clock;
+    clock.setBaseTimestep(0.1);
+    clock.setWarp(4.0);
+    QCOMPARE(clock.advance(1.0).steps, std::uint64_t(40));
+
+    // Non-positive factors are ignored
+    clock.setWarp(0.0);
+    QCOMPARE(clock.warp(), 4.0);
+}
+
+void TestSimulationClock::pauseAndSingleStep() {
+    SimulationClock clock;
+    clock.setBaseTimestep(0.1);
+    clock.setPaused(true);
+    QCOMPARE(clock.advance(1.0).steps, std::uint64_t(0));
+
+    clock.requestSingleStep();
+    const ClockTick single = clock.advance(1.0);
+    QCOMPARE(single.steps, std::uint64_t(1));
+    QCOMPARE(single.timestep, 0.1);
+    QCOMPARE(clock.advance(1.0).steps, std::uint64_t(0));
+
+    // Time spent paused is not owed afterwards
+    clock.setPaused(false);
+    QCOMPARE(clock.advance(0.1).steps, std::uint64_t(1));
+}
+
+void TestSimulationClock::overloadShedsDebt() {
+    SimulationClock clock = loadedClock();
+    clock.setCoarseningEnabled(false);
+
+    // 10 steps owed, 5 affordable: the rest is dropped, not queued
+    const ClockTick planned = clock.advance(1.0);
+    QCOMPARE(planned.steps, std::uint64_t(5));
+    QCOMPARE(planned.multiple, 1u);
+    QVERIFY(clock.isSaturated());
+    QVERIFY(clock.advance(0.0).steps <= 1);
+}
+
+void TestSimulationClock::coarsensInWholeMultiples() {
+    SimulationClock clock = loadedClock();
+
+    // 10 steps owed, 5 affordable: two base steps per step keep up
+    const ClockTick planned = clock.advance(1.0);
+    QCOMPARE(planned.multiple, 2u);
+    QCOMPARE(planned.timestep, 0.2);
+    QCOMPARE(planned.steps, std::uint64_t(5));
+    QVERIFY(clock.isSaturated());
+    QCOMPARE(clock.lastAdvance(), 1.0);
+}
+
+void TestSimulationClock::coarseningIsCappedByMaxTimestep() {
+    SimulationClock clock = loadedClock();
+    clock.setMaxTimestep(0.3);
+
+    // 100 steps owed would need a multiple of 20; capped at 3, the rest is shed
+    const ClockTick planned = clock.advance(10.0);
+    QCOMPARE(planned.multiple, 3u);
+    QCOMPARE(planned.steps, std::uint64_t(5));
+}
+
+void TestSimulationClock::multipleReleasesAfterLoadDrops() {
+    SimulationClock clock = loadedClock();
+    QCOMPARE(clock.advance(1.0).multiple, 2u);
+
+    // 4 steps per tick fit the budget again; the multiple holds for a while
+    for (int tick = 1; tick < 10; ++tick) {
+        QCOMPARE(clock.advance(0.4).multiple, 2u);
+    }
+    QCOMPARE(clock.advance(0.4).multiple, 1u);
+
+    // A renewed overload coarsens again at once
+    QCOMPARE(clock.advance(1.0).multiple, 2u);
+}
+
+void TestSimulationClock::disablingCoarseningResetsMultiple() {
+    SimulationClock clock = loadedClock();
+    QCOMPARE(clock.advance(1.0).multiple, 2u);
+
+    clock.setCoarseningEnabled(false);
+    QVERIFY(!clock.isCoarseningEnabled());
+    const ClockTick planned = clock.advance(1.0);
+    QCOMPARE(planned.multiple, 1u);
+    QCOMPARE(planned.timestep, 0.1);
+}
+
+void TestSimulationClock::achievedWarpReportsDeliveredRate() {
+    SimulationClock clock = loadedClock();
+    clock.setCoarseningEnabled(false);
+
+    // 2 steps per 100 ms heartbeat fit the budget: the warp is delivered
+    clock.setWarp(2.0);
+    for (int tick = 0; tick < 11; ++tick) {
+        clock.advance(0.1);
+    }
+    QVERIFY(std::fabs(clock.achievedWarp() - 2.0) < 0.2);
+
+    // 20 steps owed per heartbeat, 5 affordable: a quarter is delivered
+    clock.setWarp(20.0);
+    for (int tick = 0; tick < 11; ++tick) {
+        clock.advance(0.1);
+    }
+    QVERIFY(std::fabs(clock.achievedWarp() - 5.0) < 0.5);
+}
+
+QTEST_APPLESS_MAIN(TestSimulationClock)
+
+#include "tst_simulationclock.moc"
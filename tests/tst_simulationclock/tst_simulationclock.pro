@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = tst_simulationclock
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../SimulationClock.cpp \
+    tst_simulationclock.cpp
+
+HEADERS += \
+    ../../SimulationClock.h
@@ -0,0 +1,121 @@
+#include "SimulationKernel.h"
+#include "SimulationRandom.h"
+
+#include <QtTest>
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+// --- SimulationKernel Tests ---
+
+namespace {
+constexpr double TIMESTEP = 0.1;
+constexpr int STEPS = 200;
+constexpr double TARGET_X = 1500.0;
+constexpr double TARGET_Y = -800.0;
+
+/// A varied fleet: stationary, slow and fast slots, some about to run dry.
+KinematicsBuffers makeFleet(std::size_t count) {
+    KinematicsBuffers k;
+    k.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        k.posX[i] = -3000.0 + 37.5 * double(i);
+        k.posY[i] = 2000.0 - 11.25 * double(i % 97);
+        k.speed[i] = i % 5 == 0 ? 0.0 : 10.0 + double(i % 13) * 7.3;
+        k.targetSpeed[i] = k.speed[i];
+        k.heading[i] = double((i * 53) % 360) + 0.25;
+        k.fuelLevel[i] = i % 4 == 0 ? 0.05 : 100.0;
+        k.ammunitionLevel[i] = i % 6 == 0 ? 30.01 : 100.0;
+        k.fuelIdle[i] = 2.0;
+        k.fuelLinear[i] = 0.05;
+        k.fuelQuadratic[i] = 0.0004;
+        k.ammunitionRate[i] = 3.0;
+        k.streamKey[i] = i;
+    }
+    return k;
+}
+
+template <typename Integrate>
+std::vector<SupplyEvent> run(KinematicsBuffers& k, std::size_t begin, std::size_t end, Integrate integrate) {
+    const SimulationRandom random(42);
+    SupplyThresholds thresholds;
+    thresholds.fuel = {50.0, 0.01};
+    thresholds.ammunition = {30.0};
+
+    std::vector<SupplyEvent> events;
+    for (int step = 0; step < STEPS; ++step) {
+        // Jitter once per simulated second, so headings and the cache change too
+        if (step % 10 == 0) {
+            SimulationKernel::applyJitter(k, begin, end, random, std::uint64_t(step / 10), std::uint64_t(step / 10 + 1));
+        }
+        SimulationKernel::refreshHeadingCache(k, begin, end);
+        integrate(k, begin, end, TIMESTEP, TARGET_X, TARGET_Y, thresholds, events);
+    }
+    std::sort(events.begin(), events.end(), [](const SupplyEvent& a, const SupplyEvent& b) {
+        return std::make_tuple(a.slot, a.kind, a.threshold) < std::make_tuple(b.slot, b.kind, b.threshold);
+    });
+    return events;
+}
+
+bool sameBits(const std::vector<double>& a, const std::vector<double>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+}
+}
+
+class TestSimulationKernel : public QObject {
+    Q_OBJECT
+
+private slots:
+    void vectorMatchesScalar();
+    void unalignedRangeMatchesScalar();
+};
+
+void TestSimulationKernel::vectorMatchesScalar() {
+    // Empty, below and around one SSE2 pair, and a large odd fleet
+    for (const std::size_t count : {std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(3), std::size_t(1001)}) {
+        KinematicsBuffers vector = makeFleet(count);
+        KinematicsBuffers scalar = makeFleet(count);
+        const std::vector<SupplyEvent> vectorEvents = run(vector, 0, count, SimulationKernel::integrate);
+        const std::vector<SupplyEvent> scalarEvents = run(scalar, 0, count, SimulationKernel::integrateScalar);
+
+        QVERIFY(sameBits(vector.posX, scalar.posX));
+        QVERIFY(sameBits(vector.posY, scalar.posY));
+        QVERIFY(sameBits(vector.speed, scalar.speed));
+        QVERIFY(sameBits(vector.distanceToTarget, scalar.distanceToTarget));
+        QVERIFY(sameBits(vector.fuelLevel, scalar.fuelLevel));
+        QVERIFY(sameBits(vector.ammunitionLevel, scalar.ammunitionLevel));
+        QCOMPARE(SimulationKernel::digest(vector), SimulationKernel::digest(scalar));
+
+        QCOMPARE(vectorEvents.size(), scalarEvents.size());
+        for (std::size_t e = 0; e < vectorEvents.size(); ++e) {
+            QCOMPARE(vectorEvents[e].slot, scalarEvents[e].slot);
+            QVERIFY(vectorEvents[e].kind == scalarEvents[e].kind);
+            QCOMPARE(vectorEvents[e].threshold, scalarEvents[e].threshold);
+            QVERIFY(std::memcmp(&vectorEvents[e].level, &scalarEvents[e].level, sizeof(double)) == 0);
+        }
+        if (count > 6) {
+            // The fleet runs slots dry and crosses every threshold
+            QVERIFY(!vectorEvents.empty());
+        }
+    }
+}
+
+void TestSimulationKernel::unalignedRangeMatchesScalar() {
+    // An odd first slot and an odd length exercise the head and tail handling
+    KinematicsBuffers vector = makeFleet(64);
+    KinematicsBuffers scalar = makeFleet(64);
+    run(vector, 3, 60, SimulationKernel::integrate);
+    run(scalar, 3, 60, SimulationKernel::integrateScalar);
+
+    QCOMPARE(SimulationKernel::digest(vector), SimulationKernel::digest(scalar));
+    // Slots outside the range are untouched
+    const KinematicsBuffers initial = makeFleet(64);
+    QCOMPARE(vector.posX[2], initial.posX[2]);
+    QCOMPARE(vector.posX[60], initial.posX[60]);
+}
+
+QTEST_APPLESS_MAIN(TestSimulationKernel)
+
+#include "tst_simulationkernel.moc"
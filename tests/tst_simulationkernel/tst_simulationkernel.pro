@@ -0,0 +1,17 @@
+TEMPLATE = app
+TARGET = tst_simulationkernel
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../SimulationKernel.cpp \
+    tst_simulationkernel.cpp
+
+HEADERS += \
+    ../../SimdSupport.h \
+    ../../SimulationKernel.h \
+    ../../SimulationRandom.h
@@ -0,0 +1,149 @@
+#include "TaskScheduler.h"
+
+#include <QtTest>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// --- TaskScheduler Tests ---
+
+namespace {
+struct Keyed {
+    std::uint32_t key = 0;
+    std::uint32_t order = 0;  ///< Input position, to check stability
+};
+}
+
+class TestTaskScheduler : public QObject {
+    Q_OBJECT
+
+private slots:
+    void parallelForVisitsEveryIndexOnce();
+    void parallelForRespectsGrainAndTaskLimit();
+    void parallelSortIsStable();
+    void nestedWaitsComplete();
+    void waitSleepsUntilSlowTasksFinish();
+};
+
+void TestTaskScheduler::parallelForVisitsEveryIndexOnce() {
+    TaskScheduler scheduler(3);
+    for (const std::size_t grain : {std::size_t(1), std::size_t(7), std::size_t(64)}) {
+        for (const std::size_t maxTasks : {std::size_t(1), std::size_t(2), std::size_t(3), std::size_t(8)}) {
+            const std::size_t edge = grain * maxTasks;
+            for (const std::size_t count : {std::size_t(0), std::size_t(1), grain - 1, grain, grain + 1,
+                                            edge - 1, edge, edge + 1, std::size_t(1000)}) {
+                // A non-zero begin catches chunks computed from 0
+                const std::size_t begin = 5;
+                std::vector<std::atomic<int>> visits(begin + count + 5);
+                scheduler.parallelFor("test.for", begin, begin + count, grain, maxTasks,
+                                      [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+                    for (std::size_t i = chunkBegin; i < chunkEnd; ++i) {
+                        visits[i].fetch_add(1);
+                    }
+                });
+                for (std::size_t i = 0; i < visits.size(); ++i) {
+                    const bool inside = i >= begin && i < begin + count;
+                    QCOMPARE(visits[i].load(), inside ? 1 : 0);
+                }
+            }
+        }
+    }
+}
+
+void TestTaskScheduler::parallelForRespectsGrainAndTaskLimit() {
+    TaskScheduler scheduler(3);
+    for (const std::size_t count : {std::size_t(10), std::size_t(99), std::size_t(100), std::size_t(101), std::size_t(5000)}) {
+        std::atomic<std::size_t> chunks{0};
+        std::atomic<std::size_t> smallest{count};
+        scheduler.parallelFor("test.for", 0, count, 25, 4, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+            ++chunks;
+            std::size_t current = smallest.load();
+            while (chunkEnd - chunkBegin < current && !smallest.compare_exchange_weak(current, chunkEnd - chunkBegin)) {
+            }
+        });
+        QVERIFY(chunks.load() >= 1);
+        QVERIFY(chunks.load() <= 4);
+        if (chunks.load() > 1) {
+            QVERIFY(smallest.load() >= 25);
+        }
+    }
+}
+
+void TestTaskScheduler::parallelSortIsStable() {
+    // Run counts follow the concurrency: 1 to 5 runs for these pools
+    for (const unsigned workers : {0u, 1u, 2u, 4u}) {
+        TaskScheduler scheduler(workers == 0 ? 1 : workers);
+        for (const std::size_t count : {std::size_t(0), std::size_t(1), std::size_t(63), std::size_t(64),
+                                        std::size_t(1000), std::size_t(4097)}) {
+            std::vector<Keyed> values(count);
+            std::uint32_t state = 12345;
+            for (std::size_t i = 0; i < count; ++i) {
+                state = state * 1103515245u + 12345u;
+                values[i].key = (state >> 16) % 7;  // Many equal keys
+                values[i].order = static_cast<std::uint32_t>(i);
+            }
+
+            // A grain of 64 (or the whole range) splits into several runs
+            const std::size_t grain = workers == 0 ? count + 1 : 64;
+            scheduler.parallelSort("test.sort", values.begin(), values.end(),
+                                   [](const Keyed& a, const Keyed& b) { return a.key < b.key; }, grain);
+
+            for (std::size_t i = 1; i < count; ++i) {
+                QVERIFY(values[i - 1].key <= values[i].key);
+                if (values[i - 1].key == values[i].key) {
+                    QVERIFY(values[i - 1].order < values[i].order);
+                }
+            }
+        }
+    }
+}
+
+void TestTaskScheduler::nestedWaitsComplete() {
+    // More outer tasks than threads, each waiting for its own inner tasks
+    TaskScheduler scheduler(2);
+    std::atomic<std::size_t> visited{0};
+    scheduler.parallelFor("test.outer", 0, 16, 1, 16, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            scheduler.parallelFor("test.inner", 0, 64, 1, 8, [&](std::size_t innerBegin, std::size_t innerEnd) {
+                visited += innerEnd - innerBegin;
+            });
+        }
+    });
+    QCOMPARE(visited.load(), std::size_t(16 * 64));
+
+    TaskGroup outer(scheduler);
+    std::atomic<int> leaves{0};
+    for (int i = 0; i < 8; ++i) {
+        outer.run("test.group", [&scheduler, &leaves]() {
+            TaskGroup inner(scheduler);
+            for (int j = 0; j < 8; ++j) {
+                inner.run("test.leaf", [&leaves]() { ++leaves; });
+            }
+            inner.wait();
+        });
+    }
+    outer.wait();
+    QCOMPARE(leaves.load(), 64);
+}
+
+void TestTaskScheduler::waitSleepsUntilSlowTasksFinish() {
+    // The waiter runs out of work to steal and must wake on completion
+    TaskScheduler scheduler(2);
+    TaskGroup group(scheduler);
+    std::atomic<int> done{0};
+    for (int i = 0; i < 3; ++i) {
+        group.run("test.slow", [&done]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            ++done;
+        });
+    }
+    group.wait();
+    QCOMPARE(done.load(), 3);
+}
+
+QTEST_APPLESS_MAIN(TestTaskScheduler)
+
+#include "tst_taskscheduler.moc"
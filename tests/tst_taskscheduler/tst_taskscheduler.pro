@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = tst_taskscheduler
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../TaskScheduler.cpp \
+    tst_taskscheduler.cpp
+
+HEADERS += \
+    ../../TaskScheduler.h
@@ -0,0 +1,94 @@
+#include "ValueHistogram.h"
+
+#include <QtTest>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// --- ValueHistogram Tests ---
+
+class TestValueHistogram : public QObject {
+    Q_OBJECT
+
+private slots:
+    void assignCountsEveryFiniteValue();
+    void outOfRangeValuesClampToEdgeBuckets();
+    void setMovesOneCount();
+    void setWithinBucketKeepsRevision();
+    void nonFiniteValuesAreNotCounted();
+    void setIgnoresUnknownSlots();
+};
+
+void TestValueHistogram::assignCountsEveryFiniteValue() {
+    ValueHistogram histogram(0.0, 100.0, 10);
+    const std::vector<double> values = {0.0, 5.0, 9.999, 10.0, 55.0, 99.0, 100.0};
+    histogram.assign(values.data(), values.size());
+
+    const std::vector<std::uint32_t>& counts = histogram.counts();
+    QCOMPARE(counts.size(), std::size_t(10));
+    QCOMPARE(counts[0], 3u);
+    QCOMPARE(counts[1], 1u);
+    QCOMPARE(counts[5], 1u);
+    // The maximum itself lands in the last bucket
+    QCOMPARE(counts[9], 2u);
+    QCOMPARE(histogram.revision(), std::uint64_t(1));
+}
+
+void TestValueHistogram::outOfRangeValuesClampToEdgeBuckets() {
+    ValueHistogram histogram(0.0, 100.0, 4);
+    const std::vector<double> values = {-50.0, 250.0};
+    histogram.assign(values.data(), values.size());
+
+    QCOMPARE(histogram.counts()[0], 1u);
+    QCOMPARE(histogram.counts()[3], 1u);
+}
+
+void TestValueHistogram::setMovesOneCount() {
+    ValueHistogram histogram(0.0, 100.0, 4);
+    const std::vector<double> values = {10.0, 10.0, 90.0};
+    histogram.assign(values.data(), values.size());
+
+    histogram.set(0, 60.0);
+    QCOMPARE(histogram.counts()[0], 1u);
+    QCOMPARE(histogram.counts()[2], 1u);
+    QCOMPARE(histogram.counts()[3], 1u);
+    QCOMPARE(histogram.revision(), std::uint64_t(2));
+}
+
+void TestValueHistogram::setWithinBucketKeepsRevision() {
+    ValueHistogram histogram(0.0, 100.0, 4);
+    const std::vector<double> values = {10.0};
+    histogram.assign(values.data(), values.size());
+
+    histogram.set(0, 20.0);
+    QCOMPARE(histogram.counts()[0], 1u);
+    QCOMPARE(histogram.revision(), std::uint64_t(1));
+}
+
+void TestValueHistogram::nonFiniteValuesAreNotCounted() {
+    ValueHistogram histogram(0.0, 100.0, 4);
+    const std::vector<double> values = {std::numeric_limits<double>::quiet_NaN(), 30.0};
+    histogram.assign(values.data(), values.size());
+    QCOMPARE(histogram.counts()[0] + histogram.counts()[1] + histogram.counts()[2] + histogram.counts()[3], 1u);
+
+    // Leaving and re-entering the counted range moves the count back
+    histogram.set(1, std::numeric_limits<double>::infinity());
+    QCOMPARE(histogram.counts()[1], 0u);
+    histogram.set(0, 80.0);
+    QCOMPARE(histogram.counts()[3], 1u);
+}
+
+void TestValueHistogram::setIgnoresUnknownSlots() {
+    ValueHistogram histogram(0.0, 100.0, 4);
+    const std::vector<double> values = {10.0};
+    histogram.assign(values.data(), values.size());
+
+    histogram.set(5, 90.0);
+    QCOMPARE(histogram.counts()[3], 0u);
+    QCOMPARE(histogram.revision(), std::uint64_t(1));
+}
+
+QTEST_APPLESS_MAIN(TestValueHistogram)
+
+#include "tst_valuehistogram.moc"
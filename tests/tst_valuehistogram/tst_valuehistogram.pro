@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = tst_valuehistogram
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../ValueHistogram.cpp \
+    tst_valuehistogram.cpp
+
+HEADERS += \
+    ../../ValueHistogram.h
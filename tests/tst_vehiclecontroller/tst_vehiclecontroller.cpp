@@ -0,0 +1,203 @@
+#include "TacticalVehicleController.h"
+#include "TacticalVehicleData.h"
+#include "SimulationRecording.h"
+
+#include <QTemporaryDir>
+#include <QtTest>
+
+#include <cmath>
+#include <deque>
+#include <set>
+#include <vector>
+
+// --- TacticalVehicleController Tests ---
+
+namespace {
+TacticalVehicle makeVehicle(int index) {
+    TacticalVehicle vehicle;
+    vehicle.callsign = QString("Unit %1").arg(index);
+    vehicle.trackId = QString("T-%1").arg(index);
+    vehicle.affiliation = index % 2 == 0 ? "Friendly" : "Hostile";
+    vehicle.priority = index % 3 == 0 ? "Flash" : "Routine";
+    vehicle.domain = "Land";
+    vehicle.maxSpeed = 80.0;
+    vehicle.targetSpeed = 20.0 + index % 7;
+    vehicle.speed = vehicle.targetSpeed;
+    vehicle.heading = (index * 37) % 360;
+    vehicle.posX = 1000.0 + 150.0 * index;
+    vehicle.posY = -500.0 + 90.0 * (index % 11);
+    return vehicle;
+}
+
+TacticalVehicleData::VehicleBatch makeBatch(int first, int count) {
+    TacticalVehicleData::VehicleBatch batch;
+    for (int i = first; i < first + count; ++i) {
+        batch.vehicles.push_back(makeVehicle(i));
+    }
+    return batch;
+}
+
+/// Every record holds a distinct slot inside the bound buffers.
+bool slotsAreBound(const TacticalVehicleData& data, const TacticalVehicleController& controller) {
+    const std::size_t count = controller.kinematicState().size();
+    if (count != data.vehicles().size()) {
+        return false;
+    }
+    std::set<std::size_t> seen;
+    for (const TacticalVehicle& vehicle : data.vehicles()) {
+        if (vehicle.simIndex >= count || !seen.insert(vehicle.simIndex).second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Records a run with a target change half way, saves and reloads it,
+ *        and replays it on a fresh controller.
+ */
+void recordAndReplay(const RateScheduler::Divisors& divisors) {
+    TacticalVehicleData data;
+    data.appendVehicles(makeBatch(0, 40));
+    TacticalVehicleController controller(data);
+    controller.setRandomSeed(7);
+    controller.setTimestep(0.5);
+    controller.setRateDivisors(divisors);
+    // The recording starts part way into a run, with rate groups out of phase
+    controller.runSteps(3, 0.0, 0.0);
+
+    controller.startRecording(0.0, 0.0);
+    for (int step = 0; step < 60; ++step) {
+        const bool moved = step >= 30;
+        controller.runSteps(1, moved ? 4000.0 : 0.0, moved ? -2000.0 : 0.0);
+    }
+    const SimulationRecording recorded = controller.stopRecording();
+    QCOMPARE(recorded.stepCount, std::uint64_t(60));
+    QCOMPARE(recorded.targets.size(), std::size_t(2));
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QString path = directory.filePath("run.tvgr");
+    QVERIFY(recorded.save(path));
+    SimulationRecording loaded;
+    QVERIFY(loaded.load(path));
+    QCOMPARE(loaded.finalDigest, recorded.finalDigest);
+    QVERIFY(loaded.rateDivisors == recorded.rateDivisors);
+
+    TacticalVehicleData replayData;
+    TacticalVehicleController replayer(replayData);
+    QCOMPARE(replayer.replay(loaded), recorded.finalDigest);
+}
+}
+
+class TestVehicleController : public QObject {
+    Q_OBJECT
+
+private slots:
+    void deferredPublishBindsAppendedVehicles();
+    void targetAndProximityChangesBindAppendedVehicles();
+    void replayIsBitExact();
+    void replayIsBitExactWithRateGroups();
+    void recordingFixesRateDivisors();
+    void proximitySweepsMovesBetweenPublishes();
+};
+
+void TestVehicleController::deferredPublishBindsAppendedVehicles() {
+    TacticalVehicleData data;
+    data.appendVehicles(makeBatch(0, 8));
+    TacticalVehicleController controller(data);
+    controller.runSteps(1, 0.0, 0.0);
+
+    // A step whose publish waits (as for a running filter), then a loaded chunk
+    controller.advanceSteps(1, 0.0, 0.0);
+    controller.appendVehicles(makeBatch(8, 5));
+    controller.publishDeferred();
+
+    QVERIFY(slotsAreBound(data, controller));
+    const KinematicsBuffers& kinematics = controller.kinematicState();
+    for (const TacticalVehicle& vehicle : data.vehicles()) {
+        QCOMPARE(controller.vehicleForSlot(vehicle.simIndex), &vehicle);
+        QCOMPARE(vehicle.posX, kinematics.posX[vehicle.simIndex]);
+    }
+}
+
+void TestVehicleController::targetAndProximityChangesBindAppendedVehicles() {
+    TacticalVehicleData data;
+    data.appendVehicles(makeBatch(0, 6));
+    TacticalVehicleController controller(data);
+    controller.runSteps(1, 0.0, 0.0);
+
+    controller.appendVehicles(makeBatch(6, 4));
+    controller.setMissionTargets({{0.0, 0.0}, {5000.0, 0.0}});
+    QVERIFY(slotsAreBound(data, controller));
+    for (const TacticalVehicle& vehicle : data.vehicles()) {
+        QVERIFY(vehicle.nearestTargetIndex >= 0);
+    }
+
+    controller.appendVehicles(makeBatch(10, 3));
+    controller.setProximityRadius(400.0);
+    QVERIFY(slotsAreBound(data, controller));
+}
+
+void TestVehicleController::replayIsBitExact() {
+    recordAndReplay({1, 1, 1, 1});
+}
+
+void TestVehicleController::replayIsBitExactWithRateGroups() {
+    recordAndReplay({1, 2, 3, 4});
+}
+
+void TestVehicleController::recordingFixesRateDivisors() {
+    TacticalVehicleData data;
+    data.appendVehicles(makeBatch(0, 4));
+    TacticalVehicleController controller(data);
+    controller.setRateDivisors({1, 2, 3, 4});
+
+    controller.startRecording(0.0, 0.0);
+    controller.setRateDivisors({1, 1, 1, 1});
+    QVERIFY(controller.rateDivisors() == RateScheduler::Divisors({1, 2, 3, 4}));
+    controller.stopRecording();
+
+    controller.setRateDivisors({1, 1, 1, 1});
+    QVERIFY(controller.rateDivisors() == RateScheduler::Divisors({1, 1, 1, 1}));
+}
+
+void TestVehicleController::proximitySweepsMovesBetweenPublishes() {
+    // Head-on at 20 m/s from 2 km apart: they pass each other after 50 s
+    // and are 2 km apart again when the 100 steps are published
+    TacticalVehicle friendly = makeVehicle(0);
+    friendly.affiliation = "Friendly";
+    friendly.posX = -1000.0;
+    friendly.posY = 0.0;
+    friendly.heading = 90.0;
+    friendly.speed = friendly.targetSpeed = 72.0;
+    TacticalVehicle hostile = makeVehicle(1);
+    hostile.affiliation = "Hostile";
+    hostile.posX = 1000.0;
+    hostile.posY = 0.0;
+    hostile.heading = 270.0;
+    hostile.speed = hostile.targetSpeed = 72.0;
+
+    TacticalVehicleData data;
+    TacticalVehicleData::VehicleBatch batch;
+    batch.vehicles = {friendly, hostile};
+    data.appendVehicles(std::move(batch));
+    TacticalVehicleController controller(data);
+    controller.setTimestep(1.0);
+    controller.setProximityRadius(300.0);
+    controller.runSteps(1, 0.0, 0.0);
+    QVERIFY(controller.proximityPairs().empty());
+
+    controller.advanceSteps(100, 0.0, 0.0);
+    controller.publish();
+    const TacticalVehicle& first = data.vehicles()[0];
+    const TacticalVehicle& second = data.vehicles()[1];
+    QVERIFY(std::hypot(first.posX - second.posX, first.posY - second.posY) > 300.0);
+    QCOMPARE(controller.proximityPairs().size(), std::size_t(1));
+    QVERIFY(controller.proximityPairs()[0].distance <= 300.0);
+    QCOMPARE(first.proximityContacts, 1);
+}
+
+QTEST_APPLESS_MAIN(TestVehicleController)
+
+#include "tst_vehiclecontroller.moc"
@@ -0,0 +1,30 @@
+TEMPLATE = app
+TARGET = tst_vehiclecontroller
+
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    ../../ClusterIndex.cpp \
+    ../../ConsumptionModel.cpp \
+    ../../GeoProjection.cpp \
+    ../../InterceptEngine.cpp \
+    ../../PerformanceMonitor.cpp \
+    ../../ProximityGrid.cpp \
+    ../../RateScheduler.cpp \
+    ../../SimulationKernel.cpp \
+    ../../SimulationRecording.cpp \
+    ../../TacticalVehicleController.cpp \
+    ../../TacticalVehicleData.cpp \
+    ../../TaskScheduler.cpp \
+    ../../ValueHistogram.cpp \
+    ../../VehicleChangeSet.cpp \
+    tst_vehiclecontroller.cpp
+
+HEADERS += \
+    ../../SimulationRecording.h \
+    ../../TacticalVehicleController.h \
+    ../../TacticalVehicleData.h